@@ -3,8 +3,15 @@
 #include "futils.h"
 
 LineGenerator::LineGenerator(int resolution) : points_(), powers_(), num_points_(2), resolution_(resolution),
-                                               loop_(false), smooth_(false), linear_(true), render_count_(0) {
-  buffer_ = std::make_unique<vital::mono_float[]>(resolution + kExtraValues);
+                                               write_index_(0), rendered_index_(0), ready_index_(1), read_index_(2),
+                                               render_all_(true), dirty_from_(-1), dirty_to_(-1),
+                                               loop_(false), smooth_(false), linear_(true), render_count_(0),
+                                               state_version_(0), cached_state_version_(-1) {
+  buffer_memory_ = std::make_unique<vital::mono_float[]>(kNumBuffers * (resolution + kExtraValues));
+  for (int i = 0; i < kNumBuffers; ++i) {
+    stale_start_[i] = 0;
+    stale_end_[i] = resolution;
+  }
   initLinear();
 }
 
@@ -17,6 +24,7 @@ void LineGenerator::initLinear() {
   linear_ = true;
   name_ = "Linear";
   smooth_ = false;
+  render_all_ = true;
   render();
 }
 
@@ -31,6 +39,7 @@ void LineGenerator::initTriangle() {
   linear_ = false;
   name_ = "Triangle";
   smooth_ = false;
+  render_all_ = true;
   render();
 }
 
@@ -48,6 +57,7 @@ void LineGenerator::initSquare() {
   linear_ = false;
   name_ = "Square";
   smooth_ = false;
+  render_all_ = true;
   render();
 }
 
@@ -62,6 +72,7 @@ void LineGenerator::initSin() {
   linear_ = false;
   name_ = "Sin";
   smooth_ = true;
+  render_all_ = true;
   render();
 }
 
@@ -76,6 +87,7 @@ void LineGenerator::initSawUp() {
   linear_ = false;
   name_ = "Saw Up";
   smooth_ = false;
+  render_all_ = true;
   render();
 }
 
@@ -90,10 +102,14 @@ void LineGenerator::initSawDown() {
   linear_ = false;
   name_ = "Saw Down";
   smooth_ = false;
+  render_all_ = true;
   render();
 }
 
 json LineGenerator::stateToJson() {
+  if (cached_state_version_ == state_version_)
+    return cached_state_;
+
   json point_data;
   json power_data;
 
@@ -110,6 +126,9 @@ json LineGenerator::stateToJson() {
   data["powers"] = power_data;
   data["name"] = name_;
   data["smooth"] = smooth_;
+
+  cached_state_ = data;
+  cached_state_version_ = state_version_;
   return data;
 }
 
@@ -143,12 +162,54 @@ void LineGenerator::jsonToState(json data) {
   }
 
   checkLineIsLinear();
+  render_all_ = true;
   render();
 }
 
 void LineGenerator::render() {
   render_count_++;
+  state_version_++;
+
+  int start = 0;
+  int end = resolution_;
+  if (!render_all_ && dirty_from_ >= 0) {
+    // Samples outside the segments touching the changed points keep their values. The margins cover the
+    // renderer only moving to the next segment after the sample that passes a point.
+    float scale = resolution_ - 1.0f;
+    start = std::max(0, static_cast<int>(points_[dirty_from_ - 1].first * scale) - 1);
+    end = std::min(resolution_, static_cast<int>(points_[dirty_to_ + 1].first * scale) + 3);
+  }
+
+  // Each buffer also missed whatever was rendered into the others since it was last written.
+  for (int i = 0; i < kNumBuffers; ++i) {
+    stale_start_[i] = std::min(stale_start_[i], start);
+    stale_end_[i] = std::max(stale_end_[i], end);
+  }
+
+  vital::mono_float* back = renderedBuffer(write_index_);
+  renderRange(back, stale_start_[write_index_], stale_end_[write_index_]);
+  stale_start_[write_index_] = resolution_;
+  stale_end_[write_index_] = 0;
+
+  if (loop_) {
+    back[0] = back[resolution_];
+    back[resolution_ + 1] = back[1];
+    back[resolution_ + 2] = back[2];
+  }
+  else {
+    back[0] = back[1];
+    back[resolution_ + 1] = back[resolution_];
+    back[resolution_ + 2] = back[resolution_];
+  }
 
+  rendered_index_ = write_index_;
+  write_index_ = ready_index_.exchange(write_index_ | kFreshMask) & kIndexMask;
+  render_all_ = false;
+  dirty_from_ = -1;
+  dirty_to_ = -1;
+}
+
+void LineGenerator::renderRange(vital::mono_float* buffer, int start, int end) {
   int point_index = 0;
   std::pair<float, float> last_point = points_[point_index];
   float current_power = 0.0f;
@@ -158,20 +219,8 @@ void LineGenerator::render() {
     last_point.first -= 1.0f;
     current_power = powers_[num_points_ - 1];
   }
-  for (int i = 0; i < resolution_; ++i) {
-    float x = i / (resolution_ - 1.0f);
-    float t = 1.0f;
-    if (current_point.first > last_point.first)
-      t = (x - last_point.first) / (current_point.first - last_point.first);
-
-    if (smooth_)
-      t = smoothTransition(t);
-
-    t = vital::utils::clamp(vital::futils::powerScale(t, current_power), 0.0f, 1.0f);
-
-    float y = last_point.second + t * (current_point.second - last_point.second);
-    buffer_[i + 1] = 1.0f - y;
 
+  auto advance = [&](float x) {
     while (x > current_point.first && point_index < num_points_) {
       current_power = powers_[point_index % num_points_];
       point_index++;
@@ -182,24 +231,53 @@ void LineGenerator::render() {
         break;
       }
     }
-  }
+  };
 
-  if (loop_) {
-    buffer_[0] = buffer_[resolution_];
-    buffer_[resolution_ + 1] = buffer_[1];
-    buffer_[resolution_ + 2] = buffer_[2];
-  }
-  else {
-    buffer_[0] = buffer_[1];
-    buffer_[resolution_ + 1] = buffer_[resolution_];
-    buffer_[resolution_ + 2] = buffer_[resolution_];
+  if (start > 0)
+    advance((start - 1) / (resolution_ - 1.0f));
+
+  for (int i = start; i < end; ++i) {
+    float x = i / (resolution_ - 1.0f);
+    float t = 1.0f;
+    if (current_point.first > last_point.first)
+      t = (x - last_point.first) / (current_point.first - last_point.first);
+
+    if (smooth_)
+      t = smoothTransition(t);
+
+    t = vital::utils::clamp(vital::futils::powerScale(t, current_power), 0.0f, 1.0f);
+
+    float y = last_point.second + t * (current_point.second - last_point.second);
+    buffer[i + 1] = 1.0f - y;
+    advance(x);
   }
 }
 
 float LineGenerator::valueAtPhase(float phase) {
   float scaled_phase = vital::utils::clamp(phase, 0.0f, 1.0f) * resolution_;
   int index = scaled_phase;
-  return vital::utils::interpolate(buffer_[index + 1], buffer_[index + 2], scaled_phase - index);
+  vital::mono_float* buffer = getBuffer();
+  return vital::utils::interpolate(buffer[index], buffer[index + 1], scaled_phase - index);
+}
+
+void LineGenerator::markPointChanged(int index) {
+  state_version_++;
+  bool between_neighbors = index > 0 && index < num_points_ - 1 &&
+                           points_[index - 1].first <= points_[index].first &&
+                           points_[index].first <= points_[index + 1].first;
+  if (!between_neighbors) {
+    render_all_ = true;
+    return;
+  }
+
+  if (dirty_from_ < 0) {
+    dirty_from_ = index;
+    dirty_to_ = index;
+  }
+  else {
+    dirty_from_ = std::min(dirty_from_, index);
+    dirty_to_ = std::max(dirty_to_, index);
+  }
 }
 
 void LineGenerator::checkLineIsLinear() {
@@ -245,6 +323,8 @@ void LineGenerator::addPoint(int index, std::pair<float, float> position) {
   num_points_++;
   points_[index] = position;
   powers_[index] = 0.0f;
+  render_all_ = true;
+  state_version_++;
   checkLineIsLinear();
 }
 
@@ -262,6 +342,8 @@ void LineGenerator::removePoint(int index) {
     points_[i] = points_[i + 1];
     powers_[i] = powers_[i + 1];
   }
+  render_all_ = true;
+  state_version_++;
   checkLineIsLinear();
 }
 
@@ -279,6 +361,7 @@ void LineGenerator::flipHorizontal() {
     powers_[i] = -powers_[num_points_ - i - 2];
     powers_[num_points_ - i - 2] = -tmp_power;
   }
+  render_all_ = true;
   render();
   checkLineIsLinear();
 }
@@ -287,6 +370,7 @@ void LineGenerator::flipVertical() {
   for (int i = 0; i < num_points_; ++i)
     points_[i].second = 1.0f - points_[i].second;
 
+  render_all_ = true;
   render();
   checkLineIsLinear();
 }
@@ -4,6 +4,8 @@
 #include "common.h"
 #include "json/json.h"
 
+#include <atomic>
+
 using json = nlohmann::json;
 
 /**
@@ -16,6 +18,11 @@ using json = nlohmann::json;
  * The class supports various presets (linear, triangle, square, sine, sawtooth), optional looping behavior, and
  * configurable smoothing. It also provides JSON serialization and deserialization to save and load states, as well
  * as utility methods to flip the line horizontally or vertically.
+ *
+ * The rendered curve is triple buffered. render() writes into a buffer the audio thread doesn't hold and hands it
+ * over, and the audio thread only gives up its buffer when it picks up a newer one, so it always sees a complete
+ * shape while the line is edited. When only setPoint() and setPower() were called since the last render, just the
+ * samples next to the changed points are rendered again.
  */
 class LineGenerator {
 public:
@@ -38,6 +45,11 @@ public:
      */
     static constexpr int kExtraValues = 3;
 
+    /**
+     * @brief Number of rendered buffers, one each for render(), the audio thread and the hand over between them.
+     */
+    static constexpr int kNumBuffers = 3;
+
     /**
      * @brief Smooth transition function for smoothing between points.
      *
@@ -69,14 +81,14 @@ public:
      *
      * @param loop True to enable looping, false otherwise.
      */
-    void setLoop(bool loop) { loop_ = loop; render(); }
+    void setLoop(bool loop) { loop_ = loop; render_all_ = true; render(); }
 
     /**
      * @brief Sets a name identifier for the line.
      *
      * @param name A string representing the line's name.
      */
-    void setName(const std::string& name) { name_ = name; }
+    void setName(const std::string& name) { name_ = name; state_version_++; }
 
     /**
      * @brief Stores the last browsed file path associated with this line.
@@ -93,7 +105,7 @@ public:
      *
      * @param smooth True to enable smoothing, false to disable.
      */
-    void setSmooth(bool smooth) { smooth_ = smooth; checkLineIsLinear(); render(); }
+    void setSmooth(bool smooth) { smooth_ = smooth; render_all_ = true; checkLineIsLinear(); render(); }
 
     /**
      * @brief Initializes the line to a simple linear shape (from 1.0 at x=0 to 0.0 at x=1).
@@ -129,7 +141,8 @@ public:
      * @brief Renders the line into the internal buffer based on the current points and settings.
      *
      * This method should be called after modifying points, powers, or other parameters. It updates the internal buffer
-     * used for fast lookups.
+     * used for fast lookups, only rendering the region around the points changed with setPoint() or setPower() when
+     * possible.
      */
     void render();
 
@@ -137,11 +150,17 @@ public:
      * @brief Converts the current state of the line into a JSON object.
      *
      * The JSON includes the number of points, their positions, powers, name, and smooth setting.
+     * It's cached until the line changes again, so repeated saves of an unchanged line don't rebuild it.
      *
      * @return A JSON object representing the current line state.
      */
     json stateToJson();
 
+    /**
+     * @brief Drops the cached result of stateToJson() so the next call builds it again.
+     */
+    void clearStateCache() { cached_state_version_ = -1; }
+
     /**
      * @brief Checks if a given JSON object contains valid line data.
      *
@@ -282,20 +301,27 @@ public:
     /**
      * @brief Gets a pointer to the internal buffer used for interpolation.
      *
-     * This returns the buffer starting from index 1, which is typically how the lookup is performed.
+     * This returns the last rendered buffer starting from index 1, which is typically how the lookup is performed.
+     * Only use this on the thread that edits the line, the audio thread uses getCubicInterpolationBuffer().
      *
      * @return A pointer to the buffer.
      */
-    force_inline vital::mono_float* getBuffer() const { return buffer_.get() + 1; }
+    force_inline vital::mono_float* getBuffer() const { return renderedBuffer(rendered_index_) + 1; }
 
     /**
-     * @brief Gets a pointer to the buffer used for cubic interpolation.
+     * @brief Gets a pointer to the buffer used for cubic interpolation on the audio thread.
      *
-     * This returns the buffer from index 0, allowing for additional interpolation techniques.
+     * This returns the buffer from index 0, allowing for additional interpolation techniques. Picks up the newest
+     * render if there is one, and the previous buffer is only handed back to render() when that happens. The
+     * pointer stays valid until the next call, so read it once per block.
      *
      * @return A pointer to the buffer.
      */
-    force_inline vital::mono_float* getCubicInterpolationBuffer() const { return buffer_.get(); }
+    force_inline vital::mono_float* getCubicInterpolationBuffer() {
+        if (ready_index_.load() & kFreshMask)
+            read_index_ = ready_index_.exchange(read_index_) & kIndexMask;
+        return renderedBuffer(read_index_);
+    }
 
     /**
      * @brief Returns a point at the given index.
@@ -337,6 +363,7 @@ public:
     force_inline void setPoint(int index, std::pair<float, float> point) {
         VITAL_ASSERT(index < kMaxPoints && index >= 0);
         points_[index] = point;
+        markPointChanged(index);
         checkLineIsLinear();
     }
 
@@ -349,6 +376,7 @@ public:
     force_inline void setPower(int index, float power) {
         VITAL_ASSERT(index < kMaxPoints && index >= 0);
         powers_[index] = power;
+        markPointChanged(index);
         checkLineIsLinear();
     }
 
@@ -360,6 +388,8 @@ public:
     force_inline void setNumPoints(int num_points) {
         VITAL_ASSERT(num_points <= kMaxPoints && num_points >= 0);
         num_points_ = num_points;
+        render_all_ = true;
+        state_version_++;
         checkLineIsLinear();
     }
 
@@ -370,7 +400,43 @@ public:
      */
     int getRenderCount() const { return render_count_; }
 
+    /**
+     * @brief Gets a number that changes whenever anything stored by stateToJson() may have changed.
+     *
+     * @return The state version.
+     */
+    int getStateVersion() const { return state_version_; }
+
 protected:
+    /**
+     * @brief Records that a point or its power changed so render() can limit itself to the neighboring segments.
+     *
+     * @param index The index of the changed point.
+     */
+    void markPointChanged(int index);
+
+    /**
+     * @brief Renders samples [start, end) of the line into the given buffer, excluding the extra edge values.
+     *
+     * @param buffer The buffer to render into, including the leading extra value.
+     * @param start The first sample to render.
+     * @param end One past the last sample to render.
+     */
+    void renderRange(vital::mono_float* buffer, int start, int end);
+
+    /**
+     * @brief Returns the start of one of the rendered buffers, including the leading extra value.
+     *
+     * @param index The buffer index, less than kNumBuffers.
+     * @return A pointer to the buffer.
+     */
+    force_inline vital::mono_float* renderedBuffer(int index) const {
+        return buffer_memory_.get() + index * (resolution_ + kExtraValues);
+    }
+
+    static constexpr int kIndexMask = 3;  ///< Bits of ready_index_ holding the buffer index.
+    static constexpr int kFreshMask = 4;  ///< Set in ready_index_ until the audio thread picks the buffer up.
+
     std::string name_;                   ///< The name of the line shape.
     std::string last_browsed_file_;      ///< The last browsed file path for saving/loading this line.
     std::pair<float, float> points_[kMaxPoints];  ///< Array of points defining the line shape.
@@ -378,11 +444,23 @@ protected:
     int num_points_;                     ///< Current number of points.
     int resolution_;                     ///< Resolution of the internal buffer.
 
-    std::unique_ptr<vital::mono_float[]> buffer_; ///< Internal buffer holding the rendered line values.
+    std::unique_ptr<vital::mono_float[]> buffer_memory_; ///< Storage for all rendered buffers.
+    int write_index_;                   ///< Buffer the next render() writes into.
+    int rendered_index_;                ///< Buffer the last render() wrote into.
+    std::atomic<int> ready_index_;      ///< Buffer waiting for the audio thread, with kFreshMask if it's new.
+    int read_index_;                    ///< Buffer the audio thread is reading.
+    bool render_all_;                   ///< Whether the next render needs to redo the whole line.
+    int dirty_from_;                    ///< First point changed since the last render, or -1.
+    int dirty_to_;                      ///< Last point changed since the last render.
+    int stale_start_[kNumBuffers];      ///< First sample each buffer is missing.
+    int stale_end_[kNumBuffers];        ///< One past the last sample each buffer is missing.
     bool loop_;                         ///< Whether the line loops at the end.
     bool smooth_;                       ///< Whether to apply smoothing between points.
     bool linear_;                       ///< Whether the line is the simple linear shape.
     int render_count_;                  ///< Count of how many times render() was called.
+    int state_version_;                 ///< Bumped on every change to the saved state.
+    int cached_state_version_;          ///< State version cached_state_ was built at, or -1.
+    json cached_state_;                 ///< The last result of stateToJson().
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LineGenerator)
 };
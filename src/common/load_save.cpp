@@ -1,4 +1,5 @@
 #include "load_save.h"
+#include "convolution_reverb.h"
 #include "modulation_connection_processor.h"
 #include "sound_engine.h"
 #include "midi_manager.h"
@@ -85,6 +86,10 @@ json LoadSave::stateToJson(SynthBase* synth, const CriticalSection& critical_sec
   if (sample)
     settings_data["sample"] = sample->stateToJson();
 
+  vital::ImpulseResponse* impulse_response = synth->getReverbImpulseResponse();
+  if (impulse_response && !impulse_response->isDefault())
+    settings_data["reverb_impulse_response"] = impulse_response->stateToJson();
+
   json modulations;
   vital::ModulationConnectionBank& modulation_bank = synth->getModulationBank();
   for (int i = 0; i < vital::kMaxModulationConnections; ++i) {
@@ -185,6 +190,17 @@ void LoadSave::loadSample(SynthBase* synth, const json& json_sample) {
     sample->jsonToState(json_sample);
 }
 
+void LoadSave::loadReverbImpulseResponse(SynthBase* synth, const json& settings) {
+  vital::ImpulseResponse* impulse_response = synth->getReverbImpulseResponse();
+  if (impulse_response == nullptr)
+    return;
+
+  if (settings.count("reverb_impulse_response"))
+    impulse_response->jsonToState(settings["reverb_impulse_response"]);
+  else if (!impulse_response->isDefault())
+    impulse_response->init();
+}
+
 void LoadSave::loadWavetables(SynthBase* synth, const json& wavetables) {
   if (synth->getWavetableCreator(0) == nullptr)
     return;
@@ -1008,7 +1024,7 @@ json LoadSave::updateFromOldVersion(json state) {
   return state;
 }
 
-bool LoadSave::jsonToState(SynthBase* synth, std::map<std::string, String>& save_info, json data) {
+bool LoadSave::updateToCurrentVersion(json& data) {
   std::string version = data["synth_version"];
 
   int compare_feature_versions = compareFeatureVersionStrings(version, ProjectInfo::versionString);
@@ -1019,6 +1035,13 @@ bool LoadSave::jsonToState(SynthBase* synth, std::map<std::string, String>& save
   if (compare_versions < 0 || data["settings"].count("sub_octave"))
     data = updateFromOldVersion(data);
 
+  return true;
+}
+
+bool LoadSave::jsonToState(SynthBase* synth, std::map<std::string, String>& save_info, json data) {
+  if (!updateToCurrentVersion(data))
+    return false;
+
   json settings = data["settings"];
   json modulations = settings["modulations"];
   json sample = settings["sample"];
@@ -1028,6 +1051,7 @@ bool LoadSave::jsonToState(SynthBase* synth, std::map<std::string, String>& save
   loadControls(synth, settings);
   loadModulations(synth, modulations);
   loadSample(synth, sample);
+  loadReverbImpulseResponse(synth, settings);
   loadWavetables(synth, wavetables);
   loadLfos(synth, lfos);
   loadSaveState(save_info, data);
@@ -1036,6 +1060,69 @@ bool LoadSave::jsonToState(SynthBase* synth, std::map<std::string, String>& save
   return true;
 }
 
+LoadSave::PreparedState::PreparedState() { }
+
+LoadSave::PreparedState::~PreparedState() { }
+
+bool LoadSave::prepareState(SynthBase* synth, const std::map<std::string, String>& save_info, json data,
+                            PreparedState& prepared) {
+  if (!updateToCurrentVersion(data))
+    return false;
+
+  json& settings = data["settings"];
+  vital::ImpulseResponse* impulse_response = synth->getReverbImpulseResponse();
+  if (impulse_response && (settings.count("reverb_impulse_response") || !impulse_response->isDefault())) {
+    prepared.impulse_response = std::make_unique<vital::ImpulseResponse>();
+    if (settings.count("reverb_impulse_response"))
+      prepared.impulse_response->jsonToState(settings["reverb_impulse_response"]);
+  }
+
+  if (synth->getWavetableCreator(0)) {
+    int i = 0;
+    for (const json& wavetable : settings["wavetables"]) {
+      prepared.wavetables[i] = std::make_unique<vital::Wavetable>(vital::kNumOscillatorWaveFrames);
+      prepared.wavetable_creators[i] = std::make_unique<WavetableCreator>(prepared.wavetables[i].get());
+      prepared.wavetable_creators[i]->jsonToState(wavetable);
+      prepared.wavetable_creators[i]->render();
+      i++;
+    }
+  }
+
+  if (synth->getSample()) {
+    prepared.sample = std::make_unique<vital::Sample>();
+    prepared.sample->jsonToState(settings["sample"]);
+  }
+
+  prepared.save_info = save_info;
+  loadSaveState(prepared.save_info, data);
+  prepared.data = std::move(data);
+  return true;
+}
+
+void LoadSave::applyPreparedState(SynthBase* synth, std::map<std::string, String>& save_info,
+                                  PreparedState& prepared) {
+  json& settings = prepared.data["settings"];
+  loadControls(synth, settings);
+  loadModulations(synth, settings["modulations"]);
+
+  if (prepared.sample)
+    synth->getSample()->swapData(prepared.sample.get());
+
+  for (int i = 0; i < vital::kNumOscillators; ++i) {
+    if (prepared.wavetable_creators[i])
+      synth->getWavetableCreator(i)->swapState(prepared.wavetable_creators[i].get());
+  }
+
+  loadLfos(synth, settings["lfos"]);
+  save_info.swap(prepared.save_info);
+  synth->checkOversampling();
+}
+
+void LoadSave::applyPreparedImpulseResponse(SynthBase* synth, PreparedState& prepared) {
+  if (prepared.impulse_response)
+    synth->getReverbImpulseResponse()->swapData(*prepared.impulse_response);
+}
+
 String LoadSave::getAuthorFromFile(const File& file) {
   static constexpr int kMaxCharacters = 40;
   static constexpr int kMinSize = 60;
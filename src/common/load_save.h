@@ -2,6 +2,7 @@
 
 #include "JuceHeader.h"
 #include "json/json.h"
+#include "synth_constants.h"
 
 #include <map>
 #include <set>
@@ -10,11 +11,15 @@
 using json = nlohmann::json;
 
 namespace vital {
+    class ImpulseResponse;
+    class Sample;
     class StringLayout;
+    class Wavetable;
 }
 
 class MidiManager;
 class SynthBase;
+class WavetableCreator;
 
 /**
  * @brief A utility class for loading and saving configuration, preset, and state data for the Vital synthesizer.
@@ -69,6 +74,26 @@ public:
     /// Maximum length of preset comments.
     static const int kMaxCommentLength = 500;
 
+    /**
+     * @brief A preset decoded ahead of time so it can be swapped into a running engine.
+     *
+     * prepareState() fills this in without touching the synth. applyPreparedImpulseResponse() and
+     * applyPreparedState() then swap it in.
+     */
+    struct PreparedState {
+        PreparedState();
+        ~PreparedState();
+
+        json data;
+        std::map<std::string, String> save_info;
+        std::unique_ptr<vital::Wavetable> wavetables[vital::kNumOscillators];
+        std::unique_ptr<WavetableCreator> wavetable_creators[vital::kNumOscillators];
+        std::unique_ptr<vital::Sample> sample;
+        std::unique_ptr<vital::ImpulseResponse> impulse_response;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PreparedState)
+    };
+
     /// Various folder and directory name constants.
     static const std::string kUserDirectoryName;
     static const std::string kPresetFolderName;
@@ -134,6 +159,16 @@ public:
      */
     static void loadSample(SynthBase* synth, const json& sample);
 
+    /**
+     * @brief Loads the convolution reverb impulse response from a JSON object.
+     *
+     * Restores the default response if the preset doesn't contain one.
+     *
+     * @param synth A pointer to the SynthBase.
+     * @param settings The settings JSON object that may contain the impulse response.
+     */
+    static void loadReverbImpulseResponse(SynthBase* synth, const json& settings);
+
     /**
      * @brief Loads wavetable configurations into a SynthBase from a JSON array.
      *
@@ -175,6 +210,14 @@ public:
      */
     static json updateFromOldVersion(json state);
 
+    /**
+     * @brief Brings a JSON state up to the current version in place.
+     *
+     * @param data The JSON state, replaced by its updated version if it came from an older release.
+     * @return False if the state is from a newer feature version and can't be loaded.
+     */
+    static bool updateToCurrentVersion(json& data);
+
     /**
      * @brief Loads a JSON state into the given SynthBase, applying older version updates if necessary.
      *
@@ -185,6 +228,47 @@ public:
      */
     static bool jsonToState(SynthBase* synth, std::map<std::string, String>& save_info, json state);
 
+    /**
+     * @brief Does the expensive part of loading a JSON state while the engine keeps running.
+     *
+     * Decodes and renders the wavetables, sample and reverb impulse response into new objects owned by
+     * @p prepared. Nothing in @p synth is changed. Call this off the audio thread and then apply the result with
+     * applyPreparedImpulseResponse() and applyPreparedState().
+     *
+     * @param synth A pointer to the SynthBase the state will be loaded into.
+     * @param save_info The current preset information, copied and updated into @p prepared.
+     * @param state The JSON state to load.
+     * @param prepared Receives the decoded state.
+     * @return True if successful, false if the version is incompatible.
+     */
+    static bool prepareState(SynthBase* synth, const std::map<std::string, String>& save_info, json state,
+                             PreparedState& prepared);
+
+    /**
+     * @brief Finishes loading a state from prepareState() by swapping it into the synth.
+     *
+     * Sets the controls, modulations and LFO shapes and exchanges the prepared wavetables and sample with the
+     * engine's. Audio processing must not run at the same time, but this is short enough to do between two blocks.
+     * The engine's previous data ends up in @p prepared so it can be freed off the audio thread.
+     *
+     * @param synth A pointer to the SynthBase.
+     * @param save_info A map to store extracted preset information.
+     * @param prepared The state filled in by prepareState().
+     */
+    static void applyPreparedState(SynthBase* synth, std::map<std::string, String>& save_info,
+                                   PreparedState& prepared);
+
+    /**
+     * @brief Swaps the reverb impulse response from prepareState() into the synth.
+     *
+     * The reverb rebuilds its partitioned response on the calling thread and publishes it to the audio thread
+     * itself, so call this outside the audio lock. Does nothing if the response is unchanged.
+     *
+     * @param synth A pointer to the SynthBase.
+     * @param prepared The state filled in by prepareState().
+     */
+    static void applyPreparedImpulseResponse(SynthBase* synth, PreparedState& prepared);
+
     /**
      * @brief Extracts the author's name from a given preset file.
      *
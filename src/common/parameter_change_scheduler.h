@@ -0,0 +1,133 @@
+/*
+Summary:
+ParameterChangeScheduler holds host parameter changes that belong at a sample inside the next audio block. It keeps them sorted by sample, hands them back as processing reaches them and tells the caller where to split processing so each change lands close to its sample.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+/**
+ * @brief Schedules timestamped host parameter changes within one audio block.
+ *
+ * Changes are scheduled by parameter index before the block is processed. While the block is
+ * processed in chunks, getNextChange() returns the changes each chunk starts at and
+ * getSplitSamples() shortens chunks so they end at the next change. Scheduling never allocates
+ * because the change list is reserved up front.
+ */
+class ParameterChangeScheduler {
+public:
+    static constexpr int kMaxChanges = 4096;     ///< Most changes held for one block.
+    static constexpr int kMinChangeSamples = 16; ///< Fewest samples processed between changes.
+    static constexpr int kEndOfBlock = INT_MAX;  ///< Sample offset past every change in a block.
+
+    /**
+     * @struct Change
+     * @brief A parameter change waiting for processing to reach its sample.
+     */
+    struct Change {
+        int parameter_index;
+        float value;
+        int sample_offset;
+    };
+
+    /**
+     * @brief Constructs an empty scheduler with room for kMaxChanges changes.
+     */
+    ParameterChangeScheduler() : bypass_index_(-1), next_change_(0) {
+        changes_.reserve(kMaxChanges);
+    }
+
+    /**
+     * @brief Sets the parameter whose changes are never scheduled.
+     *
+     * Bypass decides whether the block is processed at all, so it applies at the start of the block.
+     *
+     * @param parameter_index The index of the bypass parameter.
+     */
+    void setBypassParameter(int parameter_index) { bypass_index_ = parameter_index; }
+
+    /**
+     * @brief Schedules a change for a sample in the next block.
+     *
+     * Changes at the same sample are returned in the order they were scheduled.
+     *
+     * @param parameter_index The index of the parameter that changes.
+     * @param value The new normalized value.
+     * @param sample_offset The sample in the next block the change belongs at.
+     * @return False if the change wasn't scheduled and should be applied now. That's the case for
+     *         bypass, for changes at the start of the block and once the list is full.
+     */
+    bool schedule(int parameter_index, float value, int sample_offset) {
+        bool full = static_cast<int>(changes_.size()) >= kMaxChanges;
+        if (parameter_index == bypass_index_ || sample_offset <= 0 || full)
+            return false;
+
+        // Hosts send changes parameter by parameter, so keep them sorted by sample as they come in.
+        auto position = std::upper_bound(changes_.begin(), changes_.end(), sample_offset,
+                                         [](int offset, const Change& change) {
+                                             return offset < change.sample_offset;
+                                         });
+        changes_.insert(position, { parameter_index, value, sample_offset });
+        return true;
+    }
+
+    /**
+     * @brief Removes the next change that belongs at or before a sample.
+     *
+     * @param sample_offset The sample processing has reached, or kEndOfBlock for every remaining change.
+     * @param change Set to the change if there is one.
+     * @return True if a change was removed, false if none are due.
+     */
+    bool getNextChange(int sample_offset, Change& change) {
+        int num_changes = static_cast<int>(changes_.size());
+        if (next_change_ < num_changes && changes_[next_change_].sample_offset <= sample_offset) {
+            change = changes_[next_change_++];
+            return true;
+        }
+
+        if (next_change_ >= num_changes) {
+            changes_.clear();
+            next_change_ = 0;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns how many samples to process before the next change is due.
+     *
+     * The result is never below kMinChangeSamples, so hosts that send a point on every sample don't
+     * force single sample processing. Changes inside that minimum are applied with the next chunk.
+     *
+     * @param sample_offset The sample processing has reached.
+     * @param max_samples The most samples the next chunk may hold.
+     * @return The number of samples to process, at most max_samples.
+     */
+    int getSplitSamples(int sample_offset, int max_samples) const {
+        int next_offset = getNextChangeOffset();
+        if (next_offset >= sample_offset + max_samples)
+            return max_samples;
+        return std::min(max_samples, std::max(next_offset - sample_offset, kMinChangeSamples));
+    }
+
+    /**
+     * @brief Returns where the next change belongs, or kEndOfBlock if there are none.
+     */
+    int getNextChangeOffset() const {
+        if (next_change_ < static_cast<int>(changes_.size()))
+            return changes_[next_change_].sample_offset;
+        return kEndOfBlock;
+    }
+
+    /**
+     * @brief Returns the number of changes that haven't been returned yet.
+     */
+    int getNumPendingChanges() const { return static_cast<int>(changes_.size()) - next_change_; }
+
+private:
+    std::vector<Change> changes_; ///< Changes for the next block, sorted by sample.
+    int bypass_index_;            ///< Index of the parameter that is never scheduled.
+    int next_change_;             ///< Index of the first change that hasn't been returned.
+};
@@ -10,7 +10,8 @@
 #include "synth_parameters.h"
 #include "utils.h"
 
-SynthBase::SynthBase() : expired_(false) {
+SynthBase::SynthBase() : render_block_size_(vital::kMaxBufferSize), expired_(false), swap_fade_requested_(false),
+                         audio_blocks_processed_(0), max_audio_block_samples_(0), swap_fade_gain_(1.0f) {
   expired_ = LoadSave::isExpired();
   self_reference_ = std::make_shared<SynthBase*>();
   *self_reference_ = this;
@@ -34,8 +35,10 @@ SynthBase::SynthBase() : expired_(false) {
   last_played_note_ = 0.0f;
   last_num_pressed_ = 0;
   audio_memory_ = std::make_unique<vital::StereoMemory>(vital::kAudioMemorySamples);
-  memset(oscilloscope_memory_, 0, 2 * vital::kOscilloscopeMemoryResolution * sizeof(vital::poly_float));
-  memset(oscilloscope_memory_write_, 0, 2 * vital::kOscilloscopeMemoryResolution * sizeof(vital::poly_float));
+  oscilloscope_memory_ = std::make_unique<vital::SnapshotMemory>(2 * vital::kOscilloscopeMemoryResolution);
+  memory_readers_ = 0;
+  memory_output_suspended_ = false;
+  capturing_memory_ = false;
   memory_reset_period_ = vital::kOscilloscopeMemoryResolution;
   memory_input_offset_ = 0;
   memory_index_ = 0;
@@ -275,6 +278,15 @@ vital::Sample* SynthBase::getSample() {
   return engine_->getSample();
 }
 
+vital::ImpulseResponse* SynthBase::getReverbImpulseResponse() {
+  return engine_->getReverbImpulseResponse();
+}
+
+std::map<std::string, float> SynthBase::getProcessorLoads() {
+  ScopedLock lock(getCriticalSection());
+  return engine_->getProcessorLoads();
+}
+
 LineGenerator* SynthBase::getLfoSource(int index) {
   return engine_->getLfoSource(index);
 }
@@ -335,6 +347,22 @@ bool SynthBase::loadFromJson(const json& data) {
   }
 }
 
+bool SynthBase::loadFromJsonWithFade(const json& data) {
+  LoadSave::PreparedState prepared;
+  if (!LoadSave::prepareState(this, save_info_, data, prepared))
+    return false;
+
+  fadeOutForSwap();
+  LoadSave::applyPreparedImpulseResponse(this, prepared);
+  {
+    ScopedLock lock(getCriticalSection());
+    engine_->clearEffects();
+    LoadSave::applyPreparedState(this, save_info_, prepared);
+    swap_fade_requested_ = false;
+  }
+  return true;
+}
+
 bool SynthBase::loadFromFile(File preset, std::string& error) {
   if (!preset.exists())
     return false;
@@ -364,11 +392,10 @@ bool SynthBase::loadFromFile(File preset, std::string& error) {
   return true;
 }
 
-void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vector<int> notes, bool render_images) {
+bool SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vector<int> notes, bool render_images) {
   static constexpr int kSampleRate = 44100;
   static constexpr int kPreProcessSamples = 44100;
   static constexpr int kFadeSamples = 200;
-  static constexpr int kBufferSize = 64;
   static constexpr int kVideoRate = 30;
   static constexpr int kImageNumberPlaces = 3;
   static constexpr int kImageWidth = 500;
@@ -376,6 +403,21 @@ void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vect
   static constexpr int kOscilloscopeResolution = 512;
   static constexpr float kFadeRatio = 0.3f;
 
+  AudioFormatManager format_manager;
+  format_manager.registerBasicFormats();
+  AudioFormat* format = format_manager.findFormatForFileExtension(file.getFileExtension());
+  if (format == nullptr)
+    format = format_manager.getDefaultFormat();
+
+  file.deleteFile();
+  std::unique_ptr<FileOutputStream> file_stream = file.createOutputStream();
+  if (file_stream == nullptr)
+    return false;
+
+  std::unique_ptr<AudioFormatWriter> writer(format->createWriterFor(file_stream.get(), kSampleRate, 2, 16, {}, 0));
+  if (writer == nullptr)
+    return false;
+
   ScopedLock lock(getCriticalSection());
 
   processModulationChanges();
@@ -386,24 +428,22 @@ void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vect
   double sample_time = 1.0 / getSampleRate();
   double current_time = -kPreProcessSamples * sample_time;
 
-  for (int samples = 0; samples < kPreProcessSamples; samples += kBufferSize) {
+  // The engine always steps kMaxBufferSize samples like it does in a host, so the block size the file is written
+  // in never changes how control-rate values move.
+  for (int samples = 0; samples < kPreProcessSamples; samples += vital::kMaxBufferSize) {
     engine_->correctToTime(current_time);
-    current_time += kBufferSize * sample_time;
-    engine_->process(kBufferSize);
+    current_time += vital::kMaxBufferSize * sample_time;
+    engine_->process(vital::kMaxBufferSize);
   }
 
   for (int note : notes)
     engine_->noteOn(note, 0.7f, 0, 0);
 
-  file.deleteFile();
-  std::unique_ptr<FileOutputStream> file_stream = file.createOutputStream();
-  WavAudioFormat wav_format;
-  std::unique_ptr<AudioFormatWriter> writer(wav_format.createWriterFor(file_stream.get(), kSampleRate, 2, 16, {}, 0));
-
   int on_samples = seconds * kSampleRate;
   int total_samples = on_samples + seconds * kSampleRate * kFadeRatio;
-  std::unique_ptr<float[]> left_buffer = std::make_unique<float[]>(kBufferSize);
-  std::unique_ptr<float[]> right_buffer = std::make_unique<float[]>(kBufferSize);
+  int block_size = render_block_size_;
+  std::unique_ptr<float[]> left_buffer = std::make_unique<float[]>(block_size);
+  std::unique_ptr<float[]> right_buffer = std::make_unique<float[]>(block_size);
   float* buffers[2] = { left_buffer.get(), right_buffer.get() };
   const vital::mono_float* engine_output = (const vital::mono_float*)engine_->output(0)->buffer;
 
@@ -413,28 +453,32 @@ void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vect
   File images_folder = File::getCurrentWorkingDirectory().getChildFile("images");
   if (!images_folder.exists() && render_images)
     images_folder.createDirectory();
-  const vital::poly_float* memory = getOscilloscopeMemory();
 #endif
 
-  for (int samples = 0; samples < total_samples; samples += kBufferSize) {
+  for (int samples = 0; samples < total_samples; samples += vital::kMaxBufferSize) {
+    int num_samples = std::min(vital::kMaxBufferSize, total_samples - samples);
     engine_->correctToTime(current_time);
-    current_time += kBufferSize * sample_time;
-    engine_->process(kBufferSize);
-    updateMemoryOutput(kBufferSize, engine_->output(0)->buffer);
+    current_time += num_samples * sample_time;
+    engine_->process(num_samples);
+    if (render_images)
+      updateMemoryOutput(num_samples, engine_->output(0)->buffer);
 
-    if (on_samples > samples && on_samples <= samples + kBufferSize) {
+    if (on_samples > samples && on_samples <= samples + num_samples) {
       for (int note : notes)
         engine_->noteOff(note, 0.5f, 0, 0);
     }
 
-    for (int i = 0; i < kBufferSize; ++i) {
+    int block_offset = samples % block_size;
+    for (int i = 0; i < num_samples; ++i) {
       vital::mono_float t = (total_samples - samples) / (1.0f * kFadeSamples);
       t = vital::utils::min(t, 1.0f);
-      left_buffer[i] = t * engine_output[vital::poly_float::kSize * i];
-      right_buffer[i] = t * engine_output[vital::poly_float::kSize * i + 1];
+      left_buffer[block_offset + i] = t * engine_output[vital::poly_float::kSize * i];
+      right_buffer[block_offset + i] = t * engine_output[vital::poly_float::kSize * i + 1];
     }
 
-    writer->writeFromFloatArrays(buffers, 2, kBufferSize);
+    int block_samples = block_offset + num_samples;
+    if (block_samples == block_size || samples + num_samples == total_samples)
+      writer->writeFromFloatArrays(buffers, 2, block_samples);
 
   #if JUCE_MODULE_AVAILABLE_juce_graphics
     int image_index = (samples * kVideoRate) / kSampleRate;
@@ -455,6 +499,7 @@ void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vect
       left_path.startNewSubPath(-2.0f, kImageHeight / 2);
       right_path.startNewSubPath(-2.0f, kImageHeight / 2);
 
+      const vital::poly_float* memory = oscilloscope_memory_->getReadBuffer();
       for (int i = 0; i < kOscilloscopeResolution; ++i) {
         float t = i / (kOscilloscopeResolution - 1.0f);
         float memory_spot = (1.0f * i * vital::kOscilloscopeMemoryResolution) / kOscilloscopeResolution;
@@ -487,6 +532,7 @@ void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vect
 
   writer = nullptr;
   file_stream.release();
+  return true;
 }
 
 void SynthBase::renderAudioForResynthesis(float* data, int samples, int note) {
@@ -561,10 +607,16 @@ void SynthBase::setMpeEnabled(bool enabled) {
   midi_manager_->setMpeEnabled(enabled);
 }
 
+void SynthBase::setRenderBlockSize(int block_size) {
+  block_size = vital::utils::iclamp(block_size, vital::kMaxBufferSize, kMaxRenderBlockSize);
+  render_block_size_ = block_size - block_size % vital::kMaxBufferSize;
+}
+
 void SynthBase::processAudio(AudioSampleBuffer* buffer, int channels, int samples, int offset) {
   if (expired_)
     return;
 
+  updateMemoryCapture();
   engine_->process(samples);
   writeAudio(buffer, channels, samples, offset);
 }
@@ -574,6 +626,7 @@ void SynthBase::processAudioWithInput(AudioSampleBuffer* buffer, const vital::po
   if (expired_)
     return;
 
+  updateMemoryCapture();
   engine_->processWithInput(input_buffer, samples);
   writeAudio(buffer, channels, samples, offset);
 }
@@ -589,7 +642,45 @@ void SynthBase::writeAudio(AudioSampleBuffer* buffer, int channels, int samples,
     }
   }
 
-  updateMemoryOutput(samples, engine_->output(0)->buffer);
+  if (swap_fade_gain_ < 1.0f || swap_fade_requested_.load())
+    applySwapFade(buffer, channels, samples, offset);
+
+  audio_blocks_processed_++;
+  if (offset + samples > max_audio_block_samples_.load())
+    max_audio_block_samples_ = offset + samples;
+
+  if (capturing_memory_)
+    updateMemoryOutput(samples, engine_->output(0)->buffer);
+}
+
+void SynthBase::applySwapFade(AudioSampleBuffer* buffer, int channels, int samples, int offset) {
+  bool fading_out = swap_fade_requested_.load();
+  float max_delta = samples / std::max(1.0f, kSwapFadeSeconds * engine_->getSampleRate());
+  float start_gain = swap_fade_gain_;
+  float end_gain = fading_out ? std::max(0.0f, start_gain - max_delta) : std::min(1.0f, start_gain + max_delta);
+
+  for (int channel = 0; channel < channels; ++channel)
+    buffer->applyGainRamp(channel, offset, samples, start_gain, end_gain);
+
+  swap_fade_gain_ = end_gain;
+  if (fading_out && end_gain == 0.0f)
+    swap_faded_out_.signal();
+}
+
+void SynthBase::fadeOutForSwap() {
+  swap_faded_out_.reset();
+  swap_fade_requested_ = true;
+
+  // Host blocks can be split into several calls, so allow for two of the longest we've seen between checks.
+  int sample_rate = std::max(1, engine_->getSampleRate());
+  int wait_ms = std::max(kSwapFadeMinWaitMs, 2 * 1000 * max_audio_block_samples_.load() / sample_rate + 1);
+  int blocks_processed = audio_blocks_processed_.load();
+  while (!swap_faded_out_.wait(wait_ms)) {
+    int new_blocks_processed = audio_blocks_processed_.load();
+    if (new_blocks_processed == blocks_processed)
+      return;
+    blocks_processed = new_blocks_processed;
+  }
 }
 
 void SynthBase::processMidi(MidiBuffer& midi_messages, int start_sample, int end_sample) {
@@ -615,9 +706,17 @@ void SynthBase::processModulationChanges() {
   }
 }
 
+void SynthBase::updateMemoryCapture() {
+  bool capture = memory_readers_.load() > 0 && !memory_output_suspended_.load();
+  if (capture == capturing_memory_)
+    return;
+
+  capturing_memory_ = capture;
+  engine_->enableEqualizerMemory(capture);
+}
+
 void SynthBase::updateMemoryOutput(int samples, const vital::poly_float* audio) {
-  for (int i = 0; i < samples; ++i)
-    audio_memory_->push(audio[i]);
+  audio_memory_->pushBlock(audio, samples);
 
   vital::mono_float last_played = engine_->getLastActiveNote();
   last_played = vital::utils::clamp(last_played, kOutputWindowMinNote, kOutputWindowMaxNote);
@@ -639,10 +738,12 @@ void SynthBase::updateMemoryOutput(int samples, const vital::poly_float* audio)
 
     memory_reset_period_ = std::min(memory_reset_period_, 2.0f * window_length);
     memory_index_ = 0;
-    vital::utils::copyBuffer(oscilloscope_memory_, oscilloscope_memory_write_, oscilloscope_samples);
+    oscilloscope_memory_->publish();
   }
   last_num_pressed_ = num_pressed;
 
+  vital::poly_float* oscilloscope_write = oscilloscope_memory_->getWriteBuffer();
+
   for (; memory_input_offset_ < samples; memory_input_offset_ += output_inc) {
     int input_index = vital::utils::iclamp(memory_input_offset_, 0, samples);
     memory_index_ = vital::utils::iclamp(memory_index_, 0, oscilloscope_samples - 1);
@@ -650,12 +751,13 @@ void SynthBase::updateMemoryOutput(int samples, const vital::poly_float* audio)
     VITAL_ASSERT(input_index < samples);
     VITAL_ASSERT(memory_index_ >= 0);
     VITAL_ASSERT(memory_index_ < oscilloscope_samples);
-    oscilloscope_memory_write_[memory_index_++] = audio[input_index];
+    oscilloscope_write[memory_index_++] = audio[input_index];
 
     if (memory_index_ * output_inc >= memory_reset_period_) {
       memory_input_offset_ += memory_reset_period_ - memory_index_ * output_inc;
       memory_index_ = 0;
-      vital::utils::copyBuffer(oscilloscope_memory_, oscilloscope_memory_write_, oscilloscope_samples);
+      oscilloscope_memory_->publish();
+      oscilloscope_write = oscilloscope_memory_->getWriteBuffer();
     }
   }
 
@@ -9,13 +9,16 @@
 #include "tuning.h"
 #include "wavetable_creator.h"
 
+#include <atomic>
 #include <set>
 #include <string>
 
 namespace vital {
+    class ImpulseResponse;
     class SoundEngine;
     struct Output;
     class StatusOutput;
+    class SnapshotMemory;
     class StereoMemory;
     class Sample;
     class WaveFrame;
@@ -45,6 +48,13 @@ public:
     static constexpr float kOutputWindowMinNote = 16.0f;
     static constexpr float kOutputWindowMaxNote = 128.0f;
 
+    /// Length of the fade out and back in around swapping in a preset with loadFromJsonWithFade().
+    static constexpr float kSwapFadeSeconds = 0.005f;
+    /// Shortest time to wait for the audio thread to process a block before deciding it isn't running.
+    static constexpr int kSwapFadeMinWaitMs = 10;
+    /// Largest block size renderAudioToFile() can write the file in.
+    static constexpr int kMaxRenderBlockSize = 2048;
+
     /**
      * @brief Constructs a SynthBase, initializing the sound engine, MIDI manager, wavetables, and settings.
      */
@@ -253,6 +263,22 @@ public:
      */
     vital::Sample* getSample();
 
+    /**
+     * @brief Retrieves the impulse response used by the convolution reverb.
+     *
+     * @return A pointer to the ImpulseResponse.
+     */
+    vital::ImpulseResponse* getReverbImpulseResponse();
+
+    /**
+     * @brief Retrieves the average CPU load of each profiled module as a fraction of real time.
+     *
+     * Only filled in when built with VITAL_PROFILE. Read it while audio isn't being processed.
+     *
+     * @return A map of module names to their average loads.
+     */
+    std::map<std::string, float> getProcessorLoads();
+
     /**
      * @brief Retrieves an LFO source by index.
      *
@@ -295,15 +321,29 @@ public:
     bool loadFromFile(File preset, std::string& error);
 
     /**
-     * @brief Renders audio to a WAV file for a given duration and note sequence.
+     * @brief Renders audio to a file for a given duration and note sequence.
+     *
+     * The audio format is picked from the file extension (wav, aiff, flac or ogg) and defaults to WAV.
      *
-     * @param file The output WAV file.
+     * @param file The output audio file.
      * @param seconds The duration in seconds.
      * @param bpm The tempo in beats per minute.
      * @param notes A vector of MIDI notes to play.
      * @param render_images Whether to render oscilloscope images alongside.
+     * @return True if the file was written, false if it couldn't be opened.
+     */
+    bool renderAudioToFile(File file, float seconds, float bpm, std::vector<int> notes, bool render_images);
+
+    /**
+     * @brief Sets the block size renderAudioToFile() collects output in before writing it to the file.
+     *
+     * The engine still processes kMaxBufferSize samples at a time, so the rendered audio is the same for every
+     * block size and only the number of writes changes.
+     *
+     * @param block_size The block size, rounded down to a multiple of kMaxBufferSize and capped at
+     *        kMaxRenderBlockSize.
      */
-    void renderAudioToFile(File file, float seconds, float bpm, std::vector<int> notes, bool render_images);
+    void setRenderBlockSize(int block_size);
 
     /**
      * @brief Renders audio for the purpose of resynthesis into a provided buffer.
@@ -493,9 +533,11 @@ public:
     /**
      * @brief Retrieves the oscilloscope memory for visualization of audio output waveforms.
      *
-     * @return A pointer to an array of poly_float samples representing the oscilloscope memory.
+     * The interface reads snapshots of 2 * kOscilloscopeMemoryResolution samples from it on its own thread.
+     *
+     * @return A pointer to the SnapshotMemory holding the oscilloscope samples.
      */
-    const vital::poly_float* getOscilloscopeMemory() { return oscilloscope_memory_; }
+    vital::SnapshotMemory* getOscilloscopeMemory() { return oscilloscope_memory_.get(); }
 
     /**
      * @brief Retrieves stereo memory holding recent audio output samples for visualization.
@@ -511,6 +553,26 @@ public:
      */
     const vital::StereoMemory* getEqualizerMemory();
 
+    /**
+     * @brief Registers something that reads the oscilloscope, audio and equalizer memories.
+     *
+     * The memories are only written while at least one reader is registered, so headless use and
+     * plugins without an open editor don't spend time on them.
+     */
+    void addMemoryReader() { memory_readers_++; }
+
+    /**
+     * @brief Unregisters a reader added with addMemoryReader().
+     */
+    void removeMemoryReader() { memory_readers_--; }
+
+    /**
+     * @brief Stops writing the memories even with readers registered, e.g. while rendering offline.
+     *
+     * @param suspend True to stop writing the memories.
+     */
+    void suspendMemoryOutput(bool suspend) { memory_output_suspended_ = suspend; }
+
     /**
      * @brief Retrieves the ModulationConnectionBank managing all modulation connections.
      *
@@ -606,6 +668,21 @@ protected:
      */
     bool loadFromJson(const json& state);
 
+    /**
+     * @brief Deserializes and applies the synth state from a JSON object without pausing processing.
+     *
+     * The expensive parts of the state (wavetable rendering, sample and impulse response decoding) are prepared
+     * on the calling thread while the old patch keeps playing. The output then fades to silence, the prepared
+     * state is swapped in under the critical section between two audio blocks and the output fades back in.
+     * This is a dip rather than a crossfade: the old and new patch never sound together, which would take a
+     * second engine running next to the one the interface and host parameters are attached to. Held notes
+     * carry on into the new patch, only the effect tails are cleared.
+     *
+     * @param state The JSON object to load.
+     * @return True if successful, false if incompatible.
+     */
+    bool loadFromJsonWithFade(const json& state);
+
     /**
      * @brief Finds a ModulationConnection by source and destination names.
      *
@@ -666,6 +743,23 @@ protected:
      */
     void writeAudio(AudioSampleBuffer* buffer, int channels, int samples, int offset);
 
+    /**
+     * @brief Ramps the output gain toward silence while a preset swap is pending and back up afterwards.
+     *
+     * @param buffer The output AudioSampleBuffer.
+     * @param channels Number of output channels.
+     * @param samples Number of samples written.
+     * @param offset The sample offset in the output buffer.
+     */
+    void applySwapFade(AudioSampleBuffer* buffer, int channels, int samples, int offset);
+
+    /**
+     * @brief Asks the audio thread to fade out and waits until it has.
+     *
+     * Returns early if the audio thread stops processing blocks, since then there is nothing to fade.
+     */
+    void fadeOutForSwap();
+
     /**
      * @brief Processes MIDI messages from a MidiBuffer, applying them to the engine’s sound generation.
      *
@@ -688,6 +782,13 @@ protected:
      */
     void processModulationChanges();
 
+    /**
+     * @brief Starts or stops writing the memories depending on whether anything reads them.
+     *
+     * Called from the audio thread before processing a block.
+     */
+    void updateMemoryCapture();
+
     /**
      * @brief Updates the oscilloscope memory with the latest audio samples.
      *
@@ -704,16 +805,25 @@ protected:
     std::shared_ptr<SynthBase*> self_reference_;
 
     File active_file_;
-    vital::poly_float oscilloscope_memory_[2 * vital::kOscilloscopeMemoryResolution];
-    vital::poly_float oscilloscope_memory_write_[2 * vital::kOscilloscopeMemoryResolution];
+    std::unique_ptr<vital::SnapshotMemory> oscilloscope_memory_;
     std::unique_ptr<vital::StereoMemory> audio_memory_;
+    std::atomic<int> memory_readers_;
+    std::atomic<bool> memory_output_suspended_;
+    bool capturing_memory_;
     vital::mono_float last_played_note_;
     int last_num_pressed_;
     vital::mono_float memory_reset_period_;
     vital::mono_float memory_input_offset_;
     int memory_index_;
+    int render_block_size_;
     bool expired_;
 
+    std::atomic<bool> swap_fade_requested_;
+    WaitableEvent swap_faded_out_;
+    std::atomic<int> audio_blocks_processed_;
+    std::atomic<int> max_audio_block_samples_;
+    vital::mono_float swap_fade_gain_;
+
     std::map<std::string, String> save_info_;
     vital::control_map controls_;
     vital::CircularQueue<vital::ModulationConnection*> mod_connections_;
@@ -732,6 +842,16 @@ protected:
  */
 class HeadlessSynth : public SynthBase {
 public:
+    /**
+     * @brief Loads a preset from its JSON state, like loadFromFile() without the file.
+     *
+     * @param state The preset state.
+     * @return True if successful, false if the preset is from a newer version.
+     */
+    bool loadFromState(const json& state) {
+        return loadFromJson(state);
+    }
+
     const CriticalSection& getCriticalSection() override {
         return critical_section_;
     }
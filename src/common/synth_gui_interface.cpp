@@ -54,10 +54,14 @@ SynthGuiInterface::SynthGuiInterface(SynthBase* synth, bool use_gui) : synth_(sy
       lfo_sources[i] = synth->getLfoSource(i);
     SynthGuiData synth_data(synth_);
     gui_ = std::make_unique<FullInterface>(&synth_data);
+    synth_->addMemoryReader();
   }
 }
 
-SynthGuiInterface::~SynthGuiInterface() { }
+SynthGuiInterface::~SynthGuiInterface() {
+  if (gui_)
+    synth_->removeMemoryReader();
+}
 
 void SynthGuiInterface::updateFullGui() {
   if (gui_ == nullptr)
@@ -89,6 +89,8 @@ namespace vital {
       ValueDetails::kIndexed, false, "", "Distortion Switch", strings::kOffOnNames },
     { "distortion_type", 0x000000, 0.0, 5.0, 0.0, 0.0, 1.0,
       ValueDetails::kIndexed, false, "", "Distortion Type", strings::kDistortionTypeNames },
+    { "distortion_anti_alias", 0x010006, 0.0, 1.0, 0.0, 0.0, 1.0,
+      ValueDetails::kIndexed, false, "", "Distortion Anti-Alias", strings::kOffOnNames },
     { "distortion_drive", 0x000000, Distortion::kMinDrive, Distortion::kMaxDrive, 0.0, 0.0, 1.0,
       ValueDetails::kLinear, false, " dB", "Distortion Drive", nullptr },
     { "distortion_mix", 0x000000, 0.0, 1.0, 1.0, 0.0, 1.0,
@@ -159,6 +161,8 @@ namespace vital {
       ValueDetails::kExponential, false, " Hz", "Reverb Chorus Frequency", nullptr },
     { "reverb_on", 0x000000, 0.0, 1.0, 0.0, 0.0, 1.0,
       ValueDetails::kIndexed, false, "", "Reverb Switch", strings::kOffOnNames },
+    { "reverb_style", 0x010006, 0.0, 1.0, 0.0, 0.0, 1.0,
+      ValueDetails::kIndexed, false, "", "Reverb Style", strings::kReverbStyleNames },
     { "sub_on", 0x000000, 0.0, 1.0, 0.0, 0.0, 1.0,
       ValueDetails::kIndexed, false, "", "Sub Switch", strings::kOffOnNames },
     { "sub_direct_out", 0x000000, 0.0, 1.0, 0.0, 0.0, 1.0,
@@ -55,6 +55,41 @@ force_inline float FileSource::FileSourceKeyframe::getScaledInterpolatedSample(f
   return interpolation_matrix.multiplyAndSumRows(value_matrix)[0];
 }
 
+void FileSource::FileSourceKeyframe::getScaledInterpolatedSamples(float* dest, double start_position,
+                                                                  double delta, int num_samples) {
+  static constexpr int kSize = vital::poly_float::kSize;
+
+  // Same cubic interpolation as getScaledInterpolatedSample but with one output point per lane.
+  // Each vector's start is found in double precision and only the small offsets within it are floats,
+  // so positions don't lose precision far into the buffer or far into the window.
+  const float* buffer = getCubicInterpolationBuffer();
+  vital::poly_float lane_offsets;
+  for (int v = 0; v < kSize; ++v)
+    lane_offsets.set(v, v * delta);
+
+  for (int i = 0; i < num_samples; i += kSize) {
+    // Sample indices are unsigned so the vector's base sample is kept inside the buffer.
+    double vector_start = start_position + i * delta;
+    double vector_floor = std::min(std::max(std::floor(vector_start), 0.0), sample_buffer_->size - 1.0);
+    vital::poly_float min_position = -vector_floor;
+    vital::poly_float max_position = sample_buffer_->size - 1 - vector_floor;
+
+    vital::poly_float position = lane_offsets + static_cast<float>(vector_start - vector_floor);
+    position = vital::utils::clamp(position, min_position, max_position);
+    vital::poly_int start_indices = vital::utils::floorToInt(position);
+    vital::poly_float t = position - vital::utils::toFloat(start_indices);
+
+    vital::matrix interpolation_matrix = vital::utils::getCatmullInterpolationMatrix(t);
+    vital::matrix value_matrix = vital::utils::getValueMatrix(buffer + static_cast<int>(vector_floor), start_indices);
+    value_matrix.transpose();
+    vital::poly_float result = interpolation_matrix.multiplyAndSumRows(value_matrix);
+
+    int num_lanes = std::min(kSize, num_samples - i);
+    for (int v = 0; v < num_lanes; ++v)
+      dest[i + v] = result[v];
+  }
+}
+
 float FileSource::FileSourceKeyframe::getNormalizationScale() {
   // Finds max and min sample values to compute a scaling factor for normalization.
   const float* buffer = getDataBuffer();
@@ -106,13 +141,13 @@ void FileSource::FileSourceKeyframe::render(vital::WaveFrame* wave_frame) {
 
   if (phase_style_ == kClear || phase_style_ == kVocode) {
     // Override phases in frequency domain.
+    wave_frame->ensureFrequencyDomain();
     for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
       float amplitude = std::abs(wave_frame->frequency_domain[i]);
       wave_frame->frequency_domain[i] = std::polar(amplitude, overridden_phase_[i]);
     }
+    wave_frame->markFrequencyDomainChanged();
   }
-
-  wave_frame->toTimeDomain();
 }
 
 // Blend one segment of the wave with another using a windowed overlap technique.
@@ -122,26 +157,26 @@ void FileSource::FileSourceKeyframe::renderWaveBlend(vital::WaveFrame* wave_fram
   int start_index = start_position_ / window_ratio + window_size_ / 2.0f + waveform_middle;
   start_index = start_index % vital::WaveFrame::kWaveformSize;
 
+  float samples[vital::WaveFrame::kWaveformSize];
+  getScaledInterpolatedSamples(samples, start_position_, window_ratio, vital::WaveFrame::kWaveformSize);
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
-    double t = i / (vital::WaveFrame::kWaveformSize * 1.0);
-    double position = start_position_ + t * window_size_;
     int write_index = (start_index + i) % vital::WaveFrame::kWaveformSize;
-    wave_frame->time_domain[write_index] = getScaledInterpolatedSample(position);
+    wave_frame->time_domain[write_index] = samples[i];
   }
 
   int fade_samples = window_fade_ * vital::WaveFrame::kWaveformSize;
   double fade_size = fade_samples * window_ratio;
+  double fade_delta = fade_samples > 1 ? fade_size / (fade_samples - 1.0) : 0.0;
+  getScaledInterpolatedSamples(samples, start_position_ + window_size_, fade_delta, fade_samples);
   for (int i = 0; i < fade_samples; ++i) {
     double t = i / (fade_samples - 1.0f);
     double fade = 0.5 + 0.5 * cos(vital::kPi * t);
 
     int write_index = (start_index + i) % vital::WaveFrame::kWaveformSize;
-    double position = start_position_ + window_size_ + t * fade_size;
     double existing_value = wave_frame->time_domain[write_index];
-    double fade_value = getScaledInterpolatedSample(position);
-    wave_frame->time_domain[write_index] = linearTween(existing_value, fade_value, fade);
+    wave_frame->time_domain[write_index] = linearTween(existing_value, samples[i], fade);
   }
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 // Use a single cycle from the buffer without interpolation between cycles.
@@ -150,14 +185,10 @@ void FileSource::FileSourceKeyframe::renderNoInterpolate(vital::WaveFrame* wave_
   int cycle = cycles_in;
 
   double start_index = cycle * window_size_;
+  double delta = window_size_ / vital::WaveFrame::kWaveformSize;
+  getScaledInterpolatedSamples(wave_frame->time_domain, start_index, delta, vital::WaveFrame::kWaveformSize);
 
-  for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
-    double t = i / (vital::WaveFrame::kWaveformSize * 1.0);
-    double position = start_index + t * window_size_;
-    wave_frame->time_domain[i] = getScaledInterpolatedSample(position);
-  }
-
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 // Interpolate between two adjacent cycles in time domain.
@@ -170,16 +201,15 @@ void FileSource::FileSourceKeyframe::renderTimeInterpolate(vital::WaveFrame* wav
   double start_index_from = from_cycle * window_size_;
   double start_index_to = to_cycle * window_size_;
 
-  for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
-    double t = i / (vital::WaveFrame::kWaveformSize * 1.0);
-    double from_position = start_index_from + t * window_size_;
-    double to_position = start_index_to + t * window_size_;
-    float from_sample = getScaledInterpolatedSample(from_position);
-    float to_sample = getScaledInterpolatedSample(to_position);
-    wave_frame->time_domain[i] = vital::utils::interpolate(from_sample, to_sample, transition);
-  }
+  double delta = window_size_ / vital::WaveFrame::kWaveformSize;
 
-  wave_frame->toFrequencyDomain();
+  float to_samples[vital::WaveFrame::kWaveformSize];
+  getScaledInterpolatedSamples(wave_frame->time_domain, start_index_from, delta, vital::WaveFrame::kWaveformSize);
+  getScaledInterpolatedSamples(to_samples, start_index_to, delta, vital::WaveFrame::kWaveformSize);
+  for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
+    wave_frame->time_domain[i] = vital::utils::interpolate(wave_frame->time_domain[i], to_samples[i], transition);
+
+  wave_frame->markTimeDomainChanged();
 }
 
 // Interpolate between cycles in frequency domain using two WaveSourceKeyframes.
@@ -194,13 +224,9 @@ void FileSource::FileSourceKeyframe::renderFreqInterpolate(vital::WaveFrame* wav
 
   vital::WaveFrame* from_wave_frame = interpolate_from_frame_->wave_frame();
   vital::WaveFrame* to_wave_frame = interpolate_to_frame_->wave_frame();
-  for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
-    double t = i / (vital::WaveFrame::kWaveformSize * 1.0);
-    double from_position = start_index_from + t * window_size_;
-    double to_position = start_index_to + t * window_size_;
-    from_wave_frame->time_domain[i] = getScaledInterpolatedSample(from_position);
-    to_wave_frame->time_domain[i] = getScaledInterpolatedSample(to_position);
-  }
+  double delta = window_size_ / vital::WaveFrame::kWaveformSize;
+  getScaledInterpolatedSamples(from_wave_frame->time_domain, start_index_from, delta, vital::WaveFrame::kWaveformSize);
+  getScaledInterpolatedSamples(to_wave_frame->time_domain, start_index_to, delta, vital::WaveFrame::kWaveformSize);
 
   from_wave_frame->toFrequencyDomain();
   to_wave_frame->toFrequencyDomain();
@@ -253,7 +279,6 @@ void FileSource::render(vital::WaveFrame* wave_frame, float position) {
     wave_frame->setSampleRate(sample_buffer_.sample_rate);
     if (normalize_mult_)
       wave_frame->normalize(normalize_gain_);
-    wave_frame->toFrequencyDomain();
   }
 }
 
@@ -343,6 +368,7 @@ void FileSource::setPhaseStyle(PhaseStyle phase_style) {
     random_seed_++;
 
   writePhaseOverrideBuffer();
+  markChanged();
 }
 
 void FileSource::writePhaseOverrideBuffer() {
@@ -371,6 +397,7 @@ void FileSource::loadBuffer(const float* buffer, int size, int sample_rate) {
   // Duplicate samples at edges for safe interpolation.
   for (int i = 1; i < kExtraBufferSamples; ++i)
     sample_buffer_.data[sample_buffer_.size + i] = sample_buffer_.data[size];
+  markChanged();
 }
 
 void FileSource::detectPitch(int max_period) {
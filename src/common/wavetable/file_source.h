@@ -116,11 +116,11 @@ class FileSource : public WavetableComponent {
         double getWindowFadeSamples() { return window_fade_ * window_size_; }
         int getSamplesNeeded() { return getWindowSize() + getWindowFadeSamples(); }
 
-        force_inline void setStartPosition(double start_position) { start_position_ = start_position; }
-        force_inline void setWindowFade(double window_fade) { window_fade_ = window_fade; }
-        force_inline void setWindowSize(double window_size) { window_size_ = window_size; }
-        force_inline void setFadeStyle(FadeStyle fade_style) { fade_style_ = fade_style; }
-        force_inline void setPhaseStyle(PhaseStyle phase_style) { phase_style_ = phase_style; }
+        force_inline void setStartPosition(double start_position) { start_position_ = start_position; markChanged(); }
+        force_inline void setWindowFade(double window_fade) { window_fade_ = window_fade; markChanged(); }
+        force_inline void setWindowSize(double window_size) { window_size_ = window_size; markChanged(); }
+        force_inline void setFadeStyle(FadeStyle fade_style) { fade_style_ = fade_style; markChanged(); }
+        force_inline void setPhaseStyle(PhaseStyle phase_style) { phase_style_ = phase_style; markChanged(); }
         force_inline void setOverriddenPhaseBuffer(const float* buffer) { overridden_phase_ = buffer; }
         force_inline const float* getDataBuffer() {
           if (sample_buffer_ == nullptr || sample_buffer_->data == nullptr)
@@ -135,6 +135,16 @@ class FileSource : public WavetableComponent {
 
         float getScaledInterpolatedSample(float time);
 
+        /**
+         * @brief Fills a buffer with evenly spaced cubic interpolated samples, several output points at a time.
+         *
+         * @param dest Buffer to write num_samples samples into.
+         * @param start_position Position in the sample buffer of the first output sample.
+         * @param delta Distance in the sample buffer between consecutive output samples.
+         * @param num_samples Number of samples to write.
+         */
+        void getScaledInterpolatedSamples(float* dest, double start_position, double delta, int num_samples);
+
         void setInterpolateFromFrame(WaveSourceKeyframe* frame) {
           interpolate_from_frame_ = frame;
         }
@@ -173,9 +183,9 @@ class FileSource : public WavetableComponent {
     PhaseStyle getPhaseStyle() { return phase_style_; }
     bool getNormalizeGain() { return normalize_gain_; }
 
-    void setNormalizeGain(bool normalize_gain) { normalize_gain_ = normalize_gain; }
-    void setWindowSize(double window_size) { window_size_ = window_size; }
-    void setFadeStyle(FadeStyle fade_style) { fade_style_ = fade_style; }
+    void setNormalizeGain(bool normalize_gain) { normalize_gain_ = normalize_gain; markChanged(); }
+    void setWindowSize(double window_size) { window_size_ = window_size; markChanged(); }
+    void setFadeStyle(FadeStyle fade_style) { fade_style_ = fade_style; markChanged(); }
     void setPhaseStyle(PhaseStyle phase_style);
     void writePhaseOverrideBuffer();
     double getWindowSize() { return window_size_; }
@@ -65,16 +65,15 @@ void FrequencyFilterModifier::FrequencyFilterModifierKeyframe::interpolate(const
 
 void FrequencyFilterModifier::FrequencyFilterModifierKeyframe::render(vital::WaveFrame* wave_frame) {
   // Apply the multiplier to each frequency bin in the wave_frame's frequency domain representation.
+  wave_frame->ensureFrequencyDomain();
   for (int i = 0; i < vital::WaveFrame::kNumRealComplex; ++i)
     wave_frame->frequency_domain[i] *= getMultiplier(i);
 
-  wave_frame->toTimeDomain();
+  wave_frame->markFrequencyDomainChanged();
 
-  // Optionally normalize the wave after applying the filter.
-  if (normalize_) {
+  // Optionally normalize the wave after applying the filter. This scales both domains.
+  if (normalize_)
     wave_frame->normalize(true);
-    wave_frame->toFrequencyDomain();
-  }
 }
 
 json FrequencyFilterModifier::FrequencyFilterModifierKeyframe::stateToJson() {
@@ -64,10 +64,10 @@ class FrequencyFilterModifier : public WavetableComponent {
         float getCutoff() { return cutoff_; }
         float getShape() { return shape_; }
 
-        void setStyle(FilterStyle style) { style_ = style; }
-        void setCutoff(float cutoff) { cutoff_ = cutoff; }
-        void setShape(float shape) { shape_ = shape; }
-        void setNormalize(bool normalize) { normalize_ = normalize; }
+        void setStyle(FilterStyle style) { style_ = style; markChanged(); }
+        void setCutoff(float cutoff) { cutoff_ = cutoff; markChanged(); }
+        void setShape(float shape) { shape_ = shape; markChanged(); }
+        void setNormalize(bool normalize) { normalize_ = normalize; markChanged(); }
 
       protected:
         FilterStyle style_;  ///< Current filter style applied by this keyframe.
@@ -95,8 +95,8 @@ class FrequencyFilterModifier : public WavetableComponent {
       FilterStyle getStyle() { return style_; }
       bool getNormalize() { return normalize_; }
 
-      void setStyle(FilterStyle style) { style_ = style; }
-      void setNormalize(bool normalize) { normalize_ = normalize; }
+      void setStyle(FilterStyle style) { style_ = style; markChanged(); }
+      void setNormalize(bool normalize) { normalize_ = normalize; markChanged(); }
 
     protected:
     FilterStyle style_;                     ///< The filtering style currently used.
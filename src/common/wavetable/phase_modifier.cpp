@@ -43,6 +43,7 @@ void PhaseModifier::PhaseModifierKeyframe::interpolate(const WavetableKeyframe*
 void PhaseModifier::PhaseModifierKeyframe::render(vital::WaveFrame* wave_frame) {
   // Depending on phase_style_, apply different phase transformations to the frequency domain.
   std::complex<float> phase_shift = std::polar(1.0f, -phase_);
+  wave_frame->ensureFrequencyDomain();
 
   if (phase_style_ == kHarmonic) {
     // Uniform phase shift to all harmonics.
@@ -82,7 +83,7 @@ void PhaseModifier::PhaseModifierKeyframe::render(vital::WaveFrame* wave_frame)
     for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
       wave_frame->frequency_domain[i] = std::abs(wave_frame->frequency_domain[i]);
   }
-  wave_frame->toTimeDomain();
+  wave_frame->markFrequencyDomainChanged();
 }
 
 json PhaseModifier::PhaseModifierKeyframe::stateToJson() {
@@ -72,21 +72,21 @@ class PhaseModifier : public WavetableComponent {
          *
          * @param phase The new phase offset.
          */
-        void setPhase(float phase) { phase_ = phase; }
+        void setPhase(float phase) { phase_ = phase; markChanged(); }
 
         /**
          * @brief Sets the mix ratio.
          *
          * @param mix The blend between original and modified signal.
          */
-        void setMix(float mix) { mix_ = mix; }
+        void setMix(float mix) { mix_ = mix; markChanged(); }
 
         /**
          * @brief Sets the phase modification style.
          *
          * @param style The chosen PhaseStyle.
          */
-        void setPhaseStyle(PhaseStyle style) { phase_style_ = style; }
+        void setPhaseStyle(PhaseStyle style) { phase_style_ = style; markChanged(); }
 
       protected:
         float phase_;       ///< The phase offset in radians.
@@ -121,7 +121,7 @@ class PhaseModifier : public WavetableComponent {
      *
      * @param style The chosen PhaseStyle.
      */
-    void setPhaseStyle(PhaseStyle style) { phase_style_ = style; }
+    void setPhaseStyle(PhaseStyle style) { phase_style_ = style; markChanged(); }
 
         /**
      * @brief Gets the current phase modification style.
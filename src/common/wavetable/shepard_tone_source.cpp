@@ -29,7 +29,10 @@ void ShepardToneSource::render(vital::WaveFrame* wave_frame, float position) {
     loop_wave_frame->frequency_domain[i * 2 + 1] = 0.0f;
   }
 
-  loop_wave_frame->toTimeDomain();
+  // The loop frame only needs a time domain if we interpolate there.
+  loop_wave_frame->markFrequencyDomainChanged();
+  if (interpolation_mode_ == kTime)
+    loop_wave_frame->ensureTimeDomain();
 
   // Use compute_frame_ (inherited from WaveSource) to interpolate between keyframe and loop_frame_
   // based on the given position, producing a stable Shepard tone-like result.
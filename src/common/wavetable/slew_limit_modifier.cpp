@@ -36,6 +36,7 @@ void SlewLimitModifier::SlewLimitModifierKeyframe::render(vital::WaveFrame* wave
   float max_up_delta = (2.0f / vital::WaveFrame::kWaveformSize) / std::max(slew_up_run_rise_, min_slew_limit);
   float max_down_delta = (2.0f / vital::WaveFrame::kWaveformSize) / std::max(slew_down_run_rise_, min_slew_limit);
 
+  wave_frame->ensureTimeDomain();
   float current_value = wave_frame->time_domain[0];
   // Iterate through the waveform's samples, limiting upward and downward changes.
   for (int i = 1; i < 2 * vital::WaveFrame::kWaveformSize; ++i) {
@@ -50,7 +51,7 @@ void SlewLimitModifier::SlewLimitModifierKeyframe::render(vital::WaveFrame* wave
 
     wave_frame->time_domain[index] = current_value;
   }
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 json SlewLimitModifier::SlewLimitModifierKeyframe::stateToJson() {
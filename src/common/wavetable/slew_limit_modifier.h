@@ -62,14 +62,14 @@ public:
          *
          * @param slew_up_limit The new upward slew limit.
          */
-        void setSlewUpLimit(float slew_up_limit) { slew_up_run_rise_ = slew_up_limit; }
+        void setSlewUpLimit(float slew_up_limit) { slew_up_run_rise_ = slew_up_limit; markChanged(); }
 
         /**
          * @brief Sets the downward slew limit parameter.
          *
          * @param slew_down_limit The new downward slew limit.
          */
-        void setSlewDownLimit(float slew_down_limit) { slew_down_run_rise_ = slew_down_limit; }
+        void setSlewDownLimit(float slew_down_limit) { slew_down_run_rise_ = slew_down_limit; markChanged(); }
 
     protected:
         float slew_up_run_rise_;   ///< Parameter controlling upward slew rate.
@@ -30,6 +30,7 @@ void WaveFoldModifier::WaveFoldModifierKeyframe::interpolate(const WavetableKeyf
 
 void WaveFoldModifier::WaveFoldModifierKeyframe::render(vital::WaveFrame* wave_frame) {
   // Wave-folding is achieved by scaling and mapping the waveform’s amplitude through a nonlinear transform.
+  wave_frame->ensureTimeDomain();
   float max_value = std::max(1.0f, wave_frame->getMaxZeroOffset());
 
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
@@ -39,7 +40,7 @@ void WaveFoldModifier::WaveFoldModifierKeyframe::render(vital::WaveFrame* wave_f
 
     wave_frame->time_domain[i] = sinf(adjusted_value);
   }
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 json WaveFoldModifier::WaveFoldModifierKeyframe::stateToJson() {
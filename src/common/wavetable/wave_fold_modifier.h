@@ -54,7 +54,7 @@ public:
          *
          * @param boost The new fold boost factor.
          */
-        void setWaveFoldBoost(float boost) { wave_fold_boost_ = boost; }
+        void setWaveFoldBoost(float boost) { wave_fold_boost_ = boost; markChanged(); }
 
     protected:
         float wave_fold_boost_; ///< The factor by which the wave is folded.
@@ -63,7 +63,7 @@ void WaveLineSource::WaveLineSourceKeyframe::render(vital::WaveFrame* wave_frame
   memcpy(wave_frame->time_domain, line_generator_.getBuffer(), vital::WaveFrame::kWaveformSize * sizeof(float));
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
     wave_frame->time_domain[i] = wave_frame->time_domain[i] * 2.0f - 1.0f;
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 json WaveLineSource::WaveLineSourceKeyframe::stateToJson() {
@@ -111,6 +111,7 @@ void WaveLineSource::jsonToState(json data) {
 
 void WaveLineSource::setNumPoints(int num_points) {
   num_points_ = num_points;
+  markChanged();
 }
 
 WaveLineSource::WaveLineSourceKeyframe* WaveLineSource::getKeyframe(int index) {
@@ -72,7 +72,10 @@ public:
          * @param point The new (x, y) coordinates for the point.
          * @param index The point index to modify.
          */
-        inline void setPoint(std::pair<float, float> point, int index) { line_generator_.setPoint(index, point); }
+        inline void setPoint(std::pair<float, float> point, int index) {
+            line_generator_.setPoint(index, point);
+            markChanged();
+        }
 
         /**
          * @brief Sets the power for a given point.
@@ -80,7 +83,7 @@ public:
          * @param power The new power value.
          * @param index The point index.
          */
-        inline void setPower(float power, int index) { line_generator_.setPower(index, power); }
+        inline void setPower(float power, int index) { line_generator_.setPower(index, power); markChanged(); }
 
         /**
          * @brief Removes a point from the line definition.
@@ -110,14 +113,14 @@ public:
          *
          * @param smooth True to enable smoothing, false otherwise.
          */
-        inline void setSmooth(bool smooth) { line_generator_.setSmooth(smooth); }
+        inline void setSmooth(bool smooth) { line_generator_.setSmooth(smooth); markChanged(); }
 
         /**
          * @brief Sets the pull power, which influences how interpolation occurs between keyframes.
          *
          * @param power The new pull power value.
          */
-        void setPullPower(float power) { pull_power_ = power; }
+        void setPullPower(float power) { pull_power_ = power; markChanged(); }
 
         /**
          * @brief Gets the current pull power value.
@@ -17,7 +17,9 @@ WaveSource::~WaveSource() { }
 WavetableKeyframe* WaveSource::createKeyframe(int position) {
   WaveSourceKeyframe* keyframe = new WaveSourceKeyframe();
   // Renders the initial WaveFrame at this position into the keyframe's frame.
+  // Stored keyframes are read by the editors and interpolation, so both domains are kept current.
   render(keyframe->wave_frame(), position);
+  keyframe->wave_frame()->ensureBothDomains();
   return keyframe;
 }
 
@@ -60,15 +62,18 @@ void WaveSourceKeyframe::copy(const WavetableKeyframe* keyframe) {
 }
 
 void WaveSourceKeyframe::linearTimeInterpolate(const vital::WaveFrame* from, const vital::WaveFrame* to, float t) {
+  VITAL_ASSERT(from->isTimeDomainCurrent() && to->isTimeDomainCurrent());
   // Perform a simple linear interpolation of time-domain samples between two WaveFrames.
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
     wave_frame_->time_domain[i] = linearTween(from->time_domain[i], to->time_domain[i], t);
-  wave_frame_->toFrequencyDomain();
+  wave_frame_->markTimeDomainChanged();
 }
 
 void WaveSourceKeyframe::cubicTimeInterpolate(const vital::WaveFrame* prev, const vital::WaveFrame* from,
                                               const vital::WaveFrame* to, const vital::WaveFrame* next,
                                               float range_prev, float range, float range_next, float t) {
+  VITAL_ASSERT(prev->isTimeDomainCurrent() && from->isTimeDomainCurrent() &&
+               to->isTimeDomainCurrent() && next->isTimeDomainCurrent());
 
   // Cubic interpolation for an even smoother transition in the time domain.
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
@@ -76,11 +81,12 @@ void WaveSourceKeyframe::cubicTimeInterpolate(const vital::WaveFrame* prev, cons
                                              to->time_domain[i], next->time_domain[i],
                                              range_prev, range, range_next, t);
   }
-  wave_frame_->toFrequencyDomain();
+  wave_frame_->markTimeDomainChanged();
 }
 
 void WaveSourceKeyframe::linearFrequencyInterpolate(const vital::WaveFrame* from,
                                                     const vital::WaveFrame* to, float t) {
+  VITAL_ASSERT(from->isFrequencyDomainCurrent() && to->isFrequencyDomainCurrent());
   // Linear interpolation in frequency domain: smoothly blend magnitudes and phases of harmonics.
   for (int i = 0; i < vital::WaveFrame::kNumRealComplex; ++i) {
     float amplitude_from = sqrtf(std::abs(from->frequency_domain[i]));
@@ -106,12 +112,15 @@ void WaveSourceKeyframe::linearFrequencyInterpolate(const vital::WaveFrame* from
   float last_harmonic_to = to->frequency_domain[last].real();
   wave_frame_->frequency_domain[last] = linearTween(last_harmonic_from, last_harmonic_to, t);
 
-  wave_frame_->toTimeDomain();
+  wave_frame_->markFrequencyDomainChanged();
 }
 
 void WaveSourceKeyframe::cubicFrequencyInterpolate(const vital::WaveFrame* prev, const vital::WaveFrame* from,
                                                    const vital::WaveFrame* to, const vital::WaveFrame* next,
                                                    float range_prev, float range, float range_next, float t) {
+  VITAL_ASSERT(prev->isFrequencyDomainCurrent() && from->isFrequencyDomainCurrent() &&
+               to->isFrequencyDomainCurrent() && next->isFrequencyDomainCurrent());
+
   // Cubic interpolation in frequency domain for very smooth harmonic transitions across multiple frames.
   for (int i = 0; i < vital::WaveFrame::kNumRealComplex; ++i) {
     float amplitude_prev = sqrtf(std::abs(prev->frequency_domain[i]));
@@ -156,7 +165,7 @@ void WaveSourceKeyframe::cubicFrequencyInterpolate(const vital::WaveFrame* prev,
   wave_frame_->frequency_domain[last] = cubicTween(last_harmonic_prev, last_harmonic_from,
                                                    last_harmonic_to, last_harmonic_next,
                                                    range_prev, range, range_next, t);
-  wave_frame_->toTimeDomain();
+  wave_frame_->markFrequencyDomainChanged();
 }
 
 void WaveSourceKeyframe::interpolate(const WavetableKeyframe* from_keyframe,
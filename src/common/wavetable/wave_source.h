@@ -66,7 +66,7 @@ class WaveSource : public WavetableComponent {
      *
      * @param mode The InterpolationMode to use (time or frequency).
      */
-    void setInterpolationMode(InterpolationMode mode) { interpolation_mode_ = mode; }
+    void setInterpolationMode(InterpolationMode mode) { interpolation_mode_ = mode; markChanged(); }
 
     /**
      * @brief Gets the current interpolation mode.
@@ -185,7 +185,7 @@ public:
      *
      * @param mode The interpolation mode (time or frequency).
      */
-    void setInterpolationMode(WaveSource::InterpolationMode mode) { interpolation_mode_ = mode; }
+    void setInterpolationMode(WaveSource::InterpolationMode mode) { interpolation_mode_ = mode; markChanged(); }
 
     /**
      * @brief Gets the current interpolation mode for this keyframe.
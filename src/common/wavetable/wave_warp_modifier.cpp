@@ -58,6 +58,7 @@ void WaveWarpModifier::WaveWarpModifierKeyframe::interpolate(const WavetableKeyf
 
 void WaveWarpModifier::WaveWarpModifierKeyframe::render(vital::WaveFrame* wave_frame) {
   // Initially copy time_domain into frequency_domain as a buffer.
+  wave_frame->ensureTimeDomain();
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
     wave_frame->frequency_domain[i] = wave_frame->time_domain[i];
 
@@ -89,7 +90,7 @@ void WaveWarpModifier::WaveWarpModifierKeyframe::render(vital::WaveFrame* wave_f
     else
       wave_frame->time_domain[i] = highResPowerScale(vertical, vertical_power_);
   }
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 json WaveWarpModifier::WaveWarpModifierKeyframe::stateToJson() {
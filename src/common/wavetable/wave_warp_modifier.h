@@ -66,14 +66,14 @@ public:
          *
          * @param horizontal_power The new horizontal warp power.
          */
-        void setHorizontalPower(float horizontal_power) { horizontal_power_ = horizontal_power; }
+        void setHorizontalPower(float horizontal_power) { horizontal_power_ = horizontal_power; markChanged(); }
 
         /**
          * @brief Sets the vertical warp power.
          *
          * @param vertical_power The new vertical warp power.
          */
-        void setVerticalPower(float vertical_power) { vertical_power_ = vertical_power; }
+        void setVerticalPower(float vertical_power) { vertical_power_ = vertical_power; markChanged(); }
 
         /**
          * @brief Sets whether horizontal warping is asymmetric.
@@ -82,14 +82,20 @@ public:
          *
          * @param horizontal_asymmetric True for asymmetric, false for symmetric.
          */
-        void setHorizontalAsymmetric(bool horizontal_asymmetric) { horizontal_asymmetric_ = horizontal_asymmetric; }
+        void setHorizontalAsymmetric(bool horizontal_asymmetric) {
+            horizontal_asymmetric_ = horizontal_asymmetric;
+            markChanged();
+        }
 
         /**
          * @brief Sets whether vertical warping is asymmetric.
          *
          * @param vertical_asymmetric True for asymmetric, false for symmetric.
          */
-        void setVerticalAsymmetric(bool vertical_asymmetric) { vertical_asymmetric_ = vertical_asymmetric; }
+        void setVerticalAsymmetric(bool vertical_asymmetric) {
+            vertical_asymmetric_ = vertical_asymmetric;
+            markChanged();
+        }
 
     protected:
         float horizontal_power_; ///< Controls horizontal (time-axis) warping.
@@ -118,14 +124,17 @@ public:
      *
      * @param horizontal_asymmetric True for asymmetric, false for symmetric.
      */
-    void setHorizontalAsymmetric(bool horizontal_asymmetric) { horizontal_asymmetric_ = horizontal_asymmetric; }
+    void setHorizontalAsymmetric(bool horizontal_asymmetric) {
+        horizontal_asymmetric_ = horizontal_asymmetric;
+        markChanged();
+    }
 
     /**
      * @brief Sets whether vertical warping is asymmetric.
      *
      * @param vertical_asymmetric True for asymmetric, false for symmetric.
      */
-    void setVerticalAsymmetric(bool vertical_asymmetric) { vertical_asymmetric_ = vertical_asymmetric; }
+    void setVerticalAsymmetric(bool vertical_asymmetric) { vertical_asymmetric_ = vertical_asymmetric; markChanged(); }
 
     /**
      * @brief Checks if horizontal warping is asymmetric.
@@ -48,6 +48,7 @@ void WaveWindowModifier::WaveWindowModifierKeyframe::interpolate(const Wavetable
 
 void WaveWindowModifier::WaveWindowModifierKeyframe::render(vital::WaveFrame* wave_frame) {
   // Apply the window shape at the start (up to left_position_) and end (after right_position_) of the wave.
+  wave_frame->ensureTimeDomain();
   for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
     float t = i / (vital::WaveFrame::kWaveformSize - 1.0f);
     if (t >= left_position_)
@@ -65,7 +66,7 @@ void WaveWindowModifier::WaveWindowModifierKeyframe::render(vital::WaveFrame* wa
     wave_frame->time_domain[i] *= applyWindow((1.0f - t) / (1.0f - right_position_));
   }
 
-  wave_frame->toFrequencyDomain();
+  wave_frame->markTimeDomainChanged();
 }
 
 json WaveWindowModifier::WaveWindowModifierKeyframe::stateToJson() {
@@ -70,7 +70,7 @@ public:
          *
          * @param left The new left position.
          */
-        void setLeft(float left) { left_position_ = left; }
+        void setLeft(float left) { left_position_ = left; markChanged(); }
 
         /**
          * @brief Sets the right position of the window (0 to 1).
@@ -79,7 +79,7 @@ public:
          *
          * @param right The new right position.
          */
-        void setRight(float right) { right_position_ = right; }
+        void setRight(float right) { right_position_ = right; markChanged(); }
 
         /**
          * @brief Gets the left window position.
@@ -100,7 +100,7 @@ public:
          *
          * @param window_shape The WindowShape to apply.
          */
-        void setWindowShape(WindowShape window_shape) { window_shape_ = window_shape; }
+        void setWindowShape(WindowShape window_shape) { window_shape_ = window_shape; markChanged(); }
 
     protected:
         /**
@@ -143,7 +143,7 @@ public:
      *
      * @param window_shape The WindowShape to use.
      */
-    void setWindowShape(WindowShape window_shape) { window_shape_ = window_shape; }
+    void setWindowShape(WindowShape window_shape) { window_shape_ = window_shape; markChanged(); }
 
     /**
      * @brief Gets the current window shape.
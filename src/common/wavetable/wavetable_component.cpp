@@ -15,6 +15,7 @@ WavetableKeyframe* WavetableComponent::insertNewKeyframe(int position) {
 
   int index = getIndexFromPosition(position);
   keyframes_.insert(keyframes_.begin() + index, std::unique_ptr<WavetableKeyframe>(keyframe));
+  markChanged();
   return keyframe;
 }
 
@@ -26,12 +27,14 @@ void WavetableComponent::reposition(WavetableKeyframe* keyframe) {
 
   int new_index = getIndexFromPosition(keyframe->position());
   keyframes_.insert(keyframes_.begin() + new_index, std::unique_ptr<WavetableKeyframe>(keyframe));
+  markChanged();
 }
 
 void WavetableComponent::remove(WavetableKeyframe* keyframe) {
   // Erase a keyframe from the vector.
   int start_index = indexOf(keyframe);
   keyframes_.erase(keyframes_.begin() + start_index);
+  markChanged();
 }
 
 void WavetableComponent::jsonToState(json data) {
@@ -44,6 +47,7 @@ void WavetableComponent::jsonToState(json data) {
 
   if (data.count("interpolation_style"))
     interpolation_style_ = data["interpolation_style"];
+  markChanged();
 }
 
 json WavetableComponent::stateToJson() {
@@ -45,7 +45,7 @@ public:
     /**
      * @brief Constructs a WavetableComponent with a default linear interpolation style.
      */
-    WavetableComponent() : interpolation_style_(kLinear) { }
+    WavetableComponent() : interpolation_style_(kLinear), state_version_(0) { }
     virtual ~WavetableComponent() { }
 
     /**
@@ -206,7 +206,7 @@ public:
      *
      * @param type The InterpolationStyle (none, linear, cubic).
      */
-    void setInterpolationStyle(InterpolationStyle type) { interpolation_style_ = type; }
+    void setInterpolationStyle(InterpolationStyle type) { interpolation_style_ = type; markChanged(); }
 
     /**
      * @brief Gets the current global interpolation style.
@@ -215,9 +215,25 @@ public:
      */
     InterpolationStyle getInterpolationStyle() const { return interpolation_style_; }
 
+    /**
+     * @brief Records that something saved by stateToJson() changed.
+     *
+     * Called by the component's and its keyframes' setters. Editors that write into keyframe data directly
+     * call it when they're done.
+     */
+    void markChanged() { state_version_++; }
+
+    /**
+     * @brief Gets a number that changes whenever the saved state of this component or its keyframes changes.
+     *
+     * @return The state version.
+     */
+    int getStateVersion() const { return state_version_; }
+
 protected:
     std::vector<std::unique_ptr<WavetableKeyframe>> keyframes_; ///< The list of keyframes sorted by position.
     InterpolationStyle interpolation_style_; ///< Current interpolation style (none, linear, cubic).
+    int state_version_; ///< Bumped on every change to the saved state.
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableComponent)
 };
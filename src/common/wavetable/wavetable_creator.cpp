@@ -39,6 +39,7 @@ void WavetableCreator::moveUp(int index) {
     return;
 
   groups_[index].swap(groups_[index - 1]);
+  state_version_++;
 }
 
 void WavetableCreator::moveDown(int index) {
@@ -46,6 +47,7 @@ void WavetableCreator::moveDown(int index) {
     return;
 
   groups_[index].swap(groups_[index + 1]);
+  state_version_++;
 }
 
 void WavetableCreator::removeGroup(int index) {
@@ -54,6 +56,7 @@ void WavetableCreator::removeGroup(int index) {
 
   std::unique_ptr<WavetableGroup> group = std::move(groups_[index]);
   groups_.erase(groups_.begin() + index);
+  state_version_++;
 }
 
 float WavetableCreator::render(int position) {
@@ -156,10 +159,21 @@ void WavetableCreator::init() {
 
 void WavetableCreator::clear() {
   groups_.clear();
+  state_version_++;
   remove_all_dc_ = true;
   full_normalize_ = true;
 }
 
+void WavetableCreator::swapState(WavetableCreator* other) {
+  groups_.swap(other->groups_);
+  last_file_loaded_.swap(other->last_file_loaded_);
+  std::swap(full_normalize_, other->full_normalize_);
+  std::swap(remove_all_dc_, other->remove_all_dc_);
+  state_version_++;
+  other->state_version_++;
+  wavetable_->swapData(other->wavetable_);
+}
+
 void WavetableCreator::loadDefaultCreator() {
   // Create a default "Init" wavetable with a default group and render it.
   wavetable_->setName("Init");
@@ -476,12 +490,19 @@ json WavetableCreator::updateJson(json data) {
 
 json WavetableCreator::stateToJson() {
   // Serialize the current wavetable creator state, including all groups and parameters.
-  json json_groups;
-  for (auto& group : groups_)
-    json_groups.push_back(group->stateToJson());
+  // Encoding the groups is the expensive part so it's only redone after they changed.
+  std::vector<int> state_versions = getStateVersions();
+  if (state_versions != cached_groups_versions_) {
+    json json_groups;
+    for (auto& group : groups_)
+      json_groups.push_back(group->stateToJson());
+
+    cached_groups_ = json_groups;
+    cached_groups_versions_ = state_versions;
+  }
 
   return {
-    { "groups", json_groups },
+    { "groups", cached_groups_ },
     { "name", wavetable_->getName() },
     { "author", wavetable_->getAuthor() },
     { "version", ProjectInfo::versionString },
@@ -490,6 +511,23 @@ json WavetableCreator::stateToJson() {
   };
 }
 
+void WavetableCreator::clearStateCache() {
+  cached_groups_versions_.clear();
+  cached_groups_ = json();
+}
+
+std::vector<int> WavetableCreator::getStateVersions() const {
+  // Adding, removing or reordering changes the version of the list that holds it, so comparing the versions
+  // in order catches every change to the saved groups.
+  std::vector<int> versions = { state_version_ };
+  for (auto& group : groups_) {
+    versions.push_back(group->getStateVersion());
+    for (int i = 0; i < group->numComponents(); ++i)
+      versions.push_back(group->getComponent(i)->getStateVersion());
+  }
+  return versions;
+}
+
 void WavetableCreator::jsonToState(json data) {
   // If data matches a single LineGenerator, treat this as a line-based initialization.
   if (LineGenerator::isValidJson(data)) {
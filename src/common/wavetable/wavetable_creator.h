@@ -47,10 +47,14 @@ public:
      * @param wavetable A pointer to the Wavetable to be created or modified.
      */
     WavetableCreator(vital::Wavetable* wavetable) : wavetable_(wavetable),
-                                                    full_normalize_(true), remove_all_dc_(true) { }
+                                                    full_normalize_(true), remove_all_dc_(true),
+                                                    state_version_(0) { }
 
     int getGroupIndex(WavetableGroup* group);
-    void addGroup(WavetableGroup* group) { groups_.push_back(std::unique_ptr<WavetableGroup>(group)); }
+    void addGroup(WavetableGroup* group) {
+        groups_.push_back(std::unique_ptr<WavetableGroup>(group));
+        state_version_++;
+    }
     void removeGroup(int index);
     void moveUp(int index);
     void moveDown(int index);
@@ -133,9 +137,33 @@ public:
     static bool isValidJson(json data);
 
     json updateJson(json data);
+
+    /**
+     * @brief Serializes the creator state.
+     *
+     * The encoded groups are cached and reused until the creator, a group or a component reports a change
+     * through its state version. Keyframe setters report to their component.
+     *
+     * @return A JSON object with the groups, name, author and render settings.
+     */
     json stateToJson();
     void jsonToState(json data);
 
+    /**
+     * @brief Drops the encoded groups so the next stateToJson() encodes everything again.
+     */
+    void clearStateCache();
+
+    /**
+     * @brief Exchanges groups, settings and rendered wavetable data with another creator.
+     *
+     * Lets a preset be decoded and rendered into a separate creator off the audio thread and then swapped in
+     * between audio blocks without allocating. See vital::Wavetable::swapData().
+     *
+     * @param other The creator to exchange state with.
+     */
+    void swapState(WavetableCreator* other);
+
     /**
      * @brief Gets the internal wavetable object being created.
      *
@@ -150,6 +178,13 @@ protected:
     void initFromPitchedAudioFile(const float* audio_buffer, int num_samples, int sample_rate);
     void initFromLineGenerator(LineGenerator* line_generator);
 
+    /**
+     * @brief Collects the state versions of this creator, its groups and their components, in order.
+     *
+     * @return The versions the encoded groups are cached against.
+     */
+    std::vector<int> getStateVersions() const;
+
     vital::WaveFrame compute_frame_combine_;
     vital::WaveFrame compute_frame_;
     std::vector<std::unique_ptr<WavetableGroup>> groups_;
@@ -159,5 +194,9 @@ protected:
     bool full_normalize_;
     bool remove_all_dc_;
 
+    int state_version_;
+    std::vector<int> cached_groups_versions_;
+    json cached_groups_;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableCreator)
 };
@@ -23,6 +23,7 @@ void WavetableGroup::moveUp(int index) {
     return;
 
   components_[index].swap(components_[index - 1]);
+  state_version_++;
 }
 
 void WavetableGroup::moveDown(int index) {
@@ -31,6 +32,7 @@ void WavetableGroup::moveDown(int index) {
     return;
 
   components_[index].swap(components_[index + 1]);
+  state_version_++;
 }
 
 void WavetableGroup::removeComponent(int index) {
@@ -39,11 +41,13 @@ void WavetableGroup::removeComponent(int index) {
 
   std::unique_ptr<WavetableComponent> component = std::move(components_[index]);
   components_.erase(components_.begin() + index);
+  state_version_++;
 }
 
 void WavetableGroup::reset() {
   // Clear all components and load a default configuration.
   components_.clear();
+  state_version_++;
   loadDefaultGroup();
 }
 
@@ -79,6 +83,7 @@ void WavetableGroup::renderTo(vital::Wavetable* wavetable) {
     for (auto& component : components_)
       component->render(&compute_frame_, i);
 
+    compute_frame_.ensureBothDomains();
     wavetable->loadWaveFrame(&compute_frame_);
   }
 }
@@ -121,6 +126,7 @@ json WavetableGroup::stateToJson() {
 void WavetableGroup::jsonToState(json data) {
   // Clear existing components and restore from JSON data.
   components_.clear();
+  state_version_++;
 
   json json_components = data["components"];
   for (json json_component : json_components) {
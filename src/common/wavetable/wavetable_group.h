@@ -26,7 +26,7 @@ public:
     /**
      * @brief Constructs an empty WavetableGroup.
      */
-    WavetableGroup() { }
+    WavetableGroup() : state_version_(0) { }
 
     /**
      * @brief Gets the index of a particular WavetableComponent within this group.
@@ -43,6 +43,7 @@ public:
      */
     void addComponent(WavetableComponent* component) {
         components_.push_back(std::unique_ptr<WavetableComponent>(component));
+        state_version_++;
     }
 
     /**
@@ -147,9 +148,19 @@ public:
      */
     void jsonToState(json data);
 
+    /**
+     * @brief Gets a number that changes whenever components are added, removed or reordered.
+     *
+     * Changes inside a component are tracked by the component's own state version.
+     *
+     * @return The state version.
+     */
+    int getStateVersion() const { return state_version_; }
+
 protected:
     vital::WaveFrame compute_frame_; ///< Temporary WaveFrame for combining component outputs.
     std::vector<std::unique_ptr<WavetableComponent>> components_; ///< The list of components in this group.
+    int state_version_; ///< Bumped whenever the list of components changes.
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableGroup)
 };
@@ -8,6 +8,11 @@ WavetableKeyframe defines a single point in a wavetable where the waveform confi
 #include "utils.h"
 #include "wavetable_component.h"
 
+void WavetableKeyframe::markChanged() {
+  if (owner_)
+    owner_->markChanged();
+}
+
 float WavetableKeyframe::linearTween(float point_from, float point_to, float t) {
   // Uses a simple linear interpolation from utils.
   return vital::utils::interpolate(point_from, point_to, t);
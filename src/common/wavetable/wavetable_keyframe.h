@@ -88,6 +88,7 @@ public:
     void setPosition(int position) {
         VITAL_ASSERT(position >= 0 && position < vital::kNumOscillatorWaveFrames);
         position_ = position;
+        markChanged();
     }
 
     /**
@@ -158,6 +159,13 @@ public:
      */
     void setOwner(WavetableComponent* owner) { owner_ = owner; }
 
+    /**
+     * @brief Tells the owner component that this keyframe's saved state changed.
+     *
+     * Keyframes without an owner, like the ones components render into, are never saved and ignore this.
+     */
+    void markChanged();
+
 protected:
     int position_;             ///< The position of this keyframe along the wavetable dimension.
     WavetableComponent* owner_;///< The component that owns this keyframe.
@@ -0,0 +1,253 @@
+#include "effects_processor.h"
+
+#include "effects_engine.h"
+#include "line_generator.h"
+#include "load_save.h"
+#include "modulation_connection_processor.h"
+#include "synth_parameters.h"
+
+namespace {
+    constexpr int kHeldMidiNote = 60;
+    constexpr float kHeldNoteVelocity = 0.7f;
+    constexpr double kPreProcessSeconds = 0.5;
+    constexpr int kDefaultBitDepth = 16;
+
+    /**
+     * @brief Builds the engine side description of a modulation connection.
+     */
+    vital::modulation_change createModulationChange(vital::EffectsEngine* engine,
+                                                    vital::ModulationConnection* connection) {
+        vital::modulation_change change;
+        change.source = engine->getModulationSource(connection->source_name);
+        change.mono_destination = engine->getMonoModulationDestination(connection->destination_name);
+        change.mono_modulation_switch = engine->getMonoModulationSwitch(connection->destination_name);
+        change.destination_scale = vital::Parameters::getParameterRange(connection->destination_name);
+        change.poly_modulation_switch = engine->getPolyModulationSwitch(connection->destination_name);
+        change.poly_destination = engine->getPolyModulationDestination(connection->destination_name);
+        change.modulation_processor = connection->modulation_processor.get();
+        change.disconnecting = false;
+        change.num_audio_rate = 0;
+        return change;
+    }
+
+    /**
+     * @brief Creates a writer for the output file, keeping the input bit depth when the format supports it.
+     */
+    std::unique_ptr<AudioFormatWriter> createWriter(AudioFormat* format, FileOutputStream* stream,
+                                                    double sample_rate, int bit_depth) {
+        std::unique_ptr<AudioFormatWriter> writer(format->createWriterFor(stream, sample_rate, 2, bit_depth, {}, 0));
+        if (writer == nullptr && bit_depth != kDefaultBitDepth)
+            writer.reset(format->createWriterFor(stream, sample_rate, 2, kDefaultBitDepth, {}, 0));
+        return writer;
+    }
+}
+
+EffectsProcessor::EffectsProcessor() : engine_(std::make_unique<vital::EffectsEngine>()) {
+    loadControls(json::object());
+}
+
+EffectsProcessor::~EffectsProcessor() { }
+
+bool EffectsProcessor::loadPreset(const File& preset_file, std::string& error) {
+    if (!preset_file.existsAsFile()) {
+        error = "Preset file doesn't exist.";
+        return false;
+    }
+
+    try {
+        json state = json::parse(preset_file.loadFileAsString().toStdString(), nullptr);
+        return loadState(state, error);
+    }
+    catch (const json::exception& e) {
+        error = "Preset file is corrupted.";
+    }
+    return false;
+}
+
+bool EffectsProcessor::loadState(json state, std::string& error) {
+    try {
+        if (!LoadSave::updateToCurrentVersion(state)) {
+            error = "Preset is from a newer version.";
+            return false;
+        }
+
+        json settings = state["settings"];
+        loadControls(settings);
+        loadModulations(settings["modulations"]);
+        loadLfos(settings["lfos"]);
+    }
+    catch (const json::exception& e) {
+        error = "Preset state is corrupted.";
+        return false;
+    }
+
+    engine_->checkOversampling();
+    return true;
+}
+
+bool EffectsProcessor::processFile(const File& input_file, const File& output_file, float bpm, float tail_seconds,
+                                   std::string& error) {
+    AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+
+    std::unique_ptr<AudioFormatReader> reader(format_manager.createReaderFor(input_file));
+    if (reader == nullptr) {
+        error = "Couldn't read input audio file.";
+        return false;
+    }
+
+    AudioFormat* format = format_manager.findFormatForFileExtension(output_file.getFileExtension());
+    if (format == nullptr)
+        format = format_manager.getDefaultFormat();
+
+    output_file.deleteFile();
+    std::unique_ptr<FileOutputStream> file_stream = output_file.createOutputStream();
+    if (file_stream == nullptr) {
+        error = "Couldn't create output file.";
+        return false;
+    }
+
+    double sample_rate = reader->sampleRate;
+    std::unique_ptr<AudioFormatWriter> writer = createWriter(format, file_stream.get(), sample_rate,
+                                                             reader->bitsPerSample);
+    if (writer == nullptr) {
+        error = "Output format doesn't support the input sample rate.";
+        return false;
+    }
+    file_stream.release();
+
+    engine_->setSampleRate(sample_rate);
+    engine_->checkOversampling();
+    engine_->setBpm(bpm);
+    engine_->updateAllModulationSwitches();
+    engine_->allSoundsOff();
+
+    int buffer_size = vital::kMaxBufferSize;
+    std::unique_ptr<vital::poly_float[]> engine_input = std::make_unique<vital::poly_float[]>(buffer_size);
+    const vital::poly_float* engine_output = engine_->output(0)->buffer;
+    AudioBuffer<float> buffer(2, buffer_size);
+
+    // Let smoothed controls reach the preset values before any audio goes through.
+    double sample_time = 1.0 / sample_rate;
+    double current_time = -kPreProcessSeconds;
+    int pre_process_samples = kPreProcessSeconds * sample_rate;
+    for (int samples = 0; samples < pre_process_samples; samples += buffer_size) {
+        engine_->correctToTime(current_time);
+        current_time += buffer_size * sample_time;
+        engine_->processWithInput(engine_input.get(), buffer_size);
+    }
+
+    engine_->noteOn(kHeldMidiNote, kHeldNoteVelocity, 0, 0);
+
+    int64 input_samples = reader->lengthInSamples;
+    float tail = vital::utils::clamp(tail_seconds, 0.0f, kMaxTailLength);
+    int64 total_samples = input_samples + static_cast<int64>(tail * sample_rate);
+    bool stereo_input = reader->numChannels > 1;
+    for (int64 samples = 0; samples < total_samples; samples += buffer_size) {
+        int num_samples = static_cast<int>(std::min<int64>(buffer_size, total_samples - samples));
+        buffer.clear();
+        if (samples < input_samples)
+            reader->read(&buffer, 0, num_samples, samples, true, stereo_input);
+        if (!stereo_input)
+            buffer.copyFrom(1, 0, buffer, 0, 0, num_samples);
+
+        const float* left = buffer.getReadPointer(0);
+        const float* right = buffer.getReadPointer(1);
+        for (int i = 0; i < num_samples; ++i) {
+            engine_input[i] = 0.0f;
+            engine_input[i].set(0, left[i]);
+            engine_input[i].set(1, right[i]);
+        }
+
+        engine_->correctToTime(current_time);
+        current_time += num_samples * sample_time;
+        engine_->processWithInput(engine_input.get(), num_samples);
+
+        float* left_output = buffer.getWritePointer(0);
+        float* right_output = buffer.getWritePointer(1);
+        for (int i = 0; i < num_samples; ++i) {
+            left_output[i] = engine_output[i][0];
+            right_output[i] = engine_output[i][1];
+        }
+
+        if (!writer->writeFromAudioSampleBuffer(buffer, 0, num_samples)) {
+            error = "Couldn't write output file.";
+            engine_->allNotesOff(0);
+            return false;
+        }
+    }
+
+    engine_->allNotesOff(0);
+    return true;
+}
+
+void EffectsProcessor::loadControls(const json& settings) {
+    vital::control_map controls = engine_->getControls();
+    for (auto& control : controls) {
+        std::string name = control.first;
+        if (settings.count(name)) {
+            vital::mono_float value = settings[name];
+            control.second->set(value);
+        }
+        else {
+            vital::ValueDetails details = vital::Parameters::getDetails(name);
+            control.second->set(details.default_value);
+        }
+    }
+}
+
+void EffectsProcessor::loadModulations(const json& modulations) {
+    vital::ModulationConnectionBank& modulation_bank = engine_->getModulationBank();
+    for (int i = 0; i < vital::kMaxModulationConnections; ++i) {
+        vital::ModulationConnection* connection = modulation_bank.atIndex(i);
+        if (!connection->source_name.empty() && !connection->destination_name.empty()) {
+            vital::modulation_change change = createModulationChange(engine_.get(), connection);
+            change.disconnecting = true;
+            engine_->disconnectModulation(change);
+        }
+        connection->source_name = "";
+        connection->destination_name = "";
+        connection->modulation_processor->lineMapGenerator()->initLinear();
+    }
+    engine_->disableUnnecessaryModSources();
+
+    // Presets fill connection slots in order, so they keep their index even when skipped here.
+    int index = 0;
+    for (const json& modulation : modulations) {
+        vital::ModulationConnection* connection = modulation_bank.atIndex(index);
+        index++;
+
+        std::string source = modulation["source"];
+        std::string destination = modulation["destination"];
+        if (engine_->getModulationSource(source) == nullptr ||
+            engine_->getMonoModulationDestination(destination) == nullptr) {
+            continue;
+        }
+
+        connection->source_name = source;
+        connection->destination_name = destination;
+        vital::modulation_change change = createModulationChange(engine_.get(), connection);
+        if (change.poly_destination && change.poly_destination->router() == change.modulation_processor) {
+            connection->source_name = "";
+            connection->destination_name = "";
+            continue;
+        }
+
+        if (modulation.count("line_mapping"))
+            connection->modulation_processor->lineMapGenerator()->jsonToState(modulation["line_mapping"]);
+        engine_->connectModulation(change);
+    }
+}
+
+void EffectsProcessor::loadLfos(const json& lfos) {
+    int i = 0;
+    for (const json& lfo : lfos) {
+        if (i >= vital::kNumLfos)
+            break;
+
+        LineGenerator* lfo_source = engine_->getLfoSource(i);
+        lfo_source->jsonToState(lfo);
+        lfo_source->render();
+        i++;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "JuceHeader.h"
+#include "json/json.h"
+
+#include <memory>
+#include <string>
+
+using json = nlohmann::json;
+
+namespace vital {
+    class EffectsEngine;
+}
+
+/**
+ * @class EffectsProcessor
+ * @brief Offline headless mode that runs an audio file through a preset's effect chain and modulators.
+ *
+ * Uses the EffectsEngine, which has the preset's effect chain, LFOs, envelopes, random modulators and macros but
+ * no oscillators or synth voices, so a file processes much faster than real time. Modulations are loaded when
+ * both their source and destination exist in the effects engine and skipped otherwise. One note is held for the
+ * whole file so envelopes and note triggered LFOs run.
+ *
+ * @code
+ * EffectsProcessor processor;
+ * std::string error;
+ * if (processor.loadPreset(preset_file, error))
+ *     processor.processFile(input_file, output_file, 120.0f, 2.0f, error);
+ * @endcode
+ */
+class EffectsProcessor {
+public:
+    /// Longest effect tail that may be rendered after the input ends, in seconds.
+    static constexpr float kMaxTailLength = 30.0f;
+
+    /// Builds the effects engine. Loads the init settings until a preset is loaded.
+    EffectsProcessor();
+    ~EffectsProcessor();
+
+    /**
+     * @brief Loads a preset's controls, modulations and LFO shapes from a file.
+     *
+     * @param preset_file The .vital preset file.
+     * @param error Set to the reason loading failed.
+     * @return True if the preset loaded.
+     */
+    bool loadPreset(const File& preset_file, std::string& error);
+
+    /**
+     * @brief Loads a preset's controls, modulations and LFO shapes from its JSON state.
+     *
+     * @param state The preset state.
+     * @param error Set to the reason loading failed.
+     * @return True if the preset loaded.
+     */
+    bool loadState(json state, std::string& error);
+
+    /**
+     * @brief Processes an audio file through the loaded effects and writes the result.
+     *
+     * The output has the input's sample rate, two channels and is as long as the input plus the tail. Mono input
+     * feeds both channels. The output format comes from the output file extension.
+     *
+     * @param input_file The audio file to read.
+     * @param output_file The file to write.
+     * @param bpm Tempo for tempo synced effects and modulators.
+     * @param tail_seconds How long to keep processing silence after the input ends so delays and reverbs ring out.
+     * @param error Set to the reason processing failed.
+     * @return True if the output was written.
+     */
+    bool processFile(const File& input_file, const File& output_file, float bpm, float tail_seconds,
+                     std::string& error);
+
+private:
+    void loadControls(const json& settings);
+    void loadModulations(const json& modulations);
+    void loadLfos(const json& lfos);
+
+    std::unique_ptr<vital::EffectsEngine> engine_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EffectsProcessor)
+};
@@ -1,5 +1,7 @@
 #include "JuceHeader.h"
+#include "effects_processor.h"
 #include "load_save.h"
+#include "render_daemon.h"
 #include "tuning.h"
 #include "synth_base.h"
 
@@ -123,6 +125,61 @@ float getRenderBpm(int argc, const char* argv[]) {
     return std::max(bpm, kMinBpm);
 }
 
+/**
+ * @brief Retrieves the block size to write the rendered file in from command-line arguments.
+ *
+ * Defaults to vital::kMaxBufferSize. The engine always processes vital::kMaxBufferSize samples at a time, so this
+ * doesn't change the rendered audio. See SynthBase::setRenderBlockSize().
+ *
+ * @param argc The number of arguments.
+ * @param argv The argument vector.
+ * @return The block size to write the file in.
+ */
+int getRenderBlockSize(int argc, const char* argv[]) {
+    String string_block_size = getArgumentValue(argc, argv, "-s", "--block-size");
+    if (string_block_size.isEmpty())
+        return vital::kMaxBufferSize;
+
+    return string_block_size.getIntValue();
+}
+
+/**
+ * @brief Retrieves the number of synths the render daemon should keep from command-line arguments.
+ *
+ * Defaults to one synth per CPU core. Capped at RenderDaemon::kMaxEngines.
+ *
+ * @param argc The number of arguments.
+ * @param argv The argument vector.
+ * @return The number of synths to build.
+ */
+int getDaemonEngineCount(int argc, const char* argv[]) {
+    String string_jobs = getArgumentValue(argc, argv, "-j", "--jobs");
+    int jobs = SystemStats::getNumCpus();
+    if (!string_jobs.isEmpty())
+        jobs = string_jobs.getIntValue();
+
+    return vital::utils::iclamp(jobs, 1, RenderDaemon::kMaxEngines);
+}
+
+/**
+ * @brief Retrieves how long to keep processing after the input ends in effects mode from command-line arguments.
+ *
+ * Defaults to 2.0 seconds. Capped at EffectsProcessor::kMaxTailLength.
+ *
+ * @param argc The number of arguments.
+ * @param argv The argument vector.
+ * @return The tail length in seconds.
+ */
+float getEffectsTailLength(int argc, const char* argv[]) {
+    static constexpr float kDefaultTailLength = 2.0f;
+
+    String string_tail = getArgumentValue(argc, argv, "-t", "--tail");
+    if (string_tail.isEmpty())
+        return kDefaultTailLength;
+
+    return vital::utils::clamp(string_tail.getFloatValue(), 0.0f, EffectsProcessor::kMaxTailLength);
+}
+
 /**
  * @brief Renders the loaded synth configuration to an audio file if output is specified.
  *
@@ -153,9 +210,91 @@ void doRenderToFile(HeadlessSynth& headless_synth, int argc, const char* argv[])
     float bpm = getRenderBpm(argc, argv);
     std::vector<int> midi_notes = getRenderMidiNotes(argc, argv);
 
+    headless_synth.setRenderBlockSize(getRenderBlockSize(argc, argv));
     headless_synth.renderAudioToFile(output_file, length, bpm, midi_notes, render_images);
 }
 
+/**
+ * @brief Prints the CPU load of each profiled module if requested on the command line.
+ *
+ * Loads are averages over everything the synth has processed, as a percentage of real time. They're only
+ * available when built with VITAL_PROFILE.
+ *
+ * @param headless_synth The synth that was rendered.
+ * @param argc The number of arguments.
+ * @param argv The argument vector.
+ */
+void doPrintProfile(HeadlessSynth& headless_synth, int argc, const char* argv[]) {
+    if (!hasFlag(argc, argv, "-p", "--profile"))
+        return;
+
+    std::map<std::string, float> loads = headless_synth.getProcessorLoads();
+    if (loads.empty()) {
+        std::cout << "No CPU profile available, build with VITAL_PROFILE=1." << newLine;
+        return;
+    }
+
+    std::vector<std::pair<float, std::string>> sorted_loads;
+    for (auto& load : loads)
+        sorted_loads.emplace_back(load.second, load.first);
+    std::sort(sorted_loads.rbegin(), sorted_loads.rend());
+
+    for (auto& load : sorted_loads)
+        std::cout << String(100.0f * load.first, 2).paddedLeft(' ', 8) << "%  " << load.second << newLine;
+}
+
+/**
+ * @brief Runs an audio file through a preset's effects and writes the result.
+ *
+ * The input file follows -e/--effects and the result is written to -o/--output. The preset is the first
+ * argument that isn't an option, and the init settings are used without one.
+ *
+ * @param argc The number of arguments.
+ * @param argv The argument vector.
+ * @return True if the output was written.
+ */
+bool doProcessEffects(int argc, const char* argv[]) {
+    String string_input_file = getArgumentValue(argc, argv, "-e", "--effects");
+    String string_output_file = getArgumentValue(argc, argv, "-o", "--output");
+    if (string_input_file.isEmpty() || string_output_file.isEmpty()) {
+        std::cout << "Error: Effects mode needs an input and an output file." << newLine;
+        return false;
+    }
+
+    File input_file = File::getCurrentWorkingDirectory().getChildFile(string_input_file);
+    File output_file = File::getCurrentWorkingDirectory().getChildFile(string_output_file);
+    if (!output_file.hasWriteAccess()) {
+        std::cout << "Error: Don't have permission to write output file." << newLine;
+        return false;
+    }
+
+    EffectsProcessor processor;
+    std::string error;
+
+    bool last_arg_was_option = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg != "" && arg[0] != '-' && !last_arg_was_option) {
+            File preset_file = File::getCurrentWorkingDirectory().getChildFile(arg);
+            if (!processor.loadPreset(preset_file, error)) {
+                std::cout << "Error: " << error << newLine;
+                return false;
+            }
+            break;
+        }
+
+        last_arg_was_option = arg[0] == '-' && arg != "--headless";
+    }
+
+    float bpm = getRenderBpm(argc, argv);
+    float tail = getEffectsTailLength(argc, argv);
+    if (!processor.processFile(input_file, output_file, bpm, tail, error)) {
+        std::cout << "Error: " << error << newLine;
+        return false;
+    }
+    return true;
+}
+
 /**
  * @brief Attempts to load a file from the command line into the HeadlessSynth.
  *
@@ -186,13 +325,26 @@ bool loadFromCommandLine(HeadlessSynth& synth, const String& command_line) {
  * Usage:
  * - Provide a file path to load as a preset/wavetable.
  * - Use flags like -o/--output for output file, -l/--length for render length, -m/--midi for MIDI notes,
- *   -b/--bpm for BPM, and -i/--render-images to produce image frames.
+ *   -b/--bpm for BPM, -i/--render-images to produce image frames, -s/--block-size for the block size the file is
+ *   written in and -p/--profile to print the CPU load of each module after rendering.
+ * - Use -d/--daemon to keep running and render jobs read from stdin on -j/--jobs warm synths. See RenderDaemon.
+ * - Use -e/--effects with an input audio file to run it through the preset's effects instead of rendering notes,
+ *   ringing out for -t/--tail seconds after the input ends. See EffectsProcessor.
  *
  * @param argc The number of arguments.
  * @param argv The argument vector.
  * @return Returns 0 on success.
  */
 int main(int argc, const char* argv[]) {
+    if (hasFlag(argc, argv, "-d", "--daemon")) {
+        RenderDaemon daemon(getDaemonEngineCount(argc, argv));
+        daemon.run(std::cin, std::cout);
+        return 0;
+    }
+
+    if (hasFlag(argc, argv, "-e", "--effects"))
+        return doProcessEffects(argc, argv) ? 0 : 1;
+
     HeadlessSynth headless_synth;
 
     bool last_arg_was_option = false;
@@ -205,4 +357,5 @@ int main(int argc, const char* argv[]) {
     }
 
     doRenderToFile(headless_synth, argc, argv);
+    doPrintProfile(headless_synth, argc, argv);
 }
@@ -0,0 +1,205 @@
+#include "render_daemon.h"
+
+#include "sound_engine.h"
+#include "synth_base.h"
+#include "tuning.h"
+
+#include <iostream>
+
+namespace {
+    constexpr int kDefaultMidiNote = 48;
+    constexpr float kDefaultRenderLength = 5.0f;
+    constexpr float kDefaultBpm = 120.0f;
+    constexpr float kMinBpm = 5.0f;
+    constexpr float kMaxBpm = 900.0f;
+
+    /**
+     * @brief Reads the notes of a job. Notes can be MIDI numbers or note names like "C3".
+     *
+     * @param job The parsed job.
+     * @return The MIDI notes to play, or the default note if none were given.
+     */
+    std::vector<int> getJobNotes(const json& job) {
+        std::vector<int> notes;
+        if (job.count("notes") && job["notes"].is_array()) {
+            for (const json& note : job["notes"]) {
+                int midi = -1;
+                if (note.is_number())
+                    midi = note.get<int>();
+                else if (note.is_string())
+                    midi = Tuning::noteToMidiKey(note.get<std::string>());
+
+                if (midi >= 0 && midi < vital::kMidiSize)
+                    notes.push_back(midi);
+            }
+        }
+
+        if (notes.empty())
+            notes.push_back(kDefaultMidiNote);
+
+        return notes;
+    }
+
+    /**
+     * @brief Reads a number from a job, falling back to a default when missing.
+     */
+    float getJobFloat(const json& job, const std::string& key, float default_value) {
+        if (job.count(key) && job[key].is_number())
+            return job[key].get<float>();
+        return default_value;
+    }
+
+    /**
+     * @brief Resolves a job path against the working directory.
+     */
+    File getJobFile(const std::string& path) {
+        return File::getCurrentWorkingDirectory().getChildFile(path);
+    }
+}
+
+RenderDaemon::RenderDaemon(int num_engines) :
+        output_(&std::cout), thread_pool_(vital::utils::iclamp(num_engines, 1, kMaxEngines)) {
+    int total_engines = vital::utils::iclamp(num_engines, 1, kMaxEngines);
+    for (int i = 0; i < total_engines; ++i) {
+        synths_.push_back(std::make_unique<HeadlessSynth>());
+        free_synths_.push_back(synths_.back().get());
+    }
+}
+
+RenderDaemon::~RenderDaemon() {
+    thread_pool_.removeAllJobs(false, -1);
+}
+
+void RenderDaemon::run(std::istream& input, std::ostream& output) {
+    output_ = &output;
+
+    std::string line;
+    while (std::getline(input, line)) {
+        String trimmed = String(line).trim();
+        if (trimmed.isEmpty())
+            continue;
+        if (trimmed == "quit")
+            break;
+
+        json job;
+        try {
+            job = json::parse(trimmed.toStdString(), nullptr);
+        }
+        catch (const json::exception& e) {
+            writeResult({ { "ok", false }, { "error", "Job is not valid JSON." } });
+            continue;
+        }
+
+        double queued_time = Time::getMillisecondCounterHiRes();
+        thread_pool_.addJob([this, job, queued_time]() {
+            json result = render(job);
+            result["total_ms"] = Time::getMillisecondCounterHiRes() - queued_time;
+            writeResult(result);
+        });
+    }
+
+    while (thread_pool_.getNumJobs() > 0)
+        Thread::sleep(1);
+}
+
+json RenderDaemon::render(const json& job) {
+    json result;
+    if (job.count("id"))
+        result["id"] = job["id"];
+
+    if (!job.count("output") || !job["output"].is_string()) {
+        result["ok"] = false;
+        result["error"] = "Job has no output file.";
+        return result;
+    }
+
+    File output_file = getJobFile(job["output"].get<std::string>());
+    if (job.count("format") && job["format"].is_string())
+        output_file = output_file.withFileExtension(job["format"].get<std::string>());
+    result["output"] = output_file.getFullPathName().toStdString();
+
+    float length = vital::utils::clamp(getJobFloat(job, "length", kDefaultRenderLength), 0.0f, kMaxRenderLength);
+    float bpm = vital::utils::clamp(getJobFloat(job, "bpm", kDefaultBpm), kMinBpm, kMaxBpm);
+    std::vector<int> notes = getJobNotes(job);
+
+    HeadlessSynth* synth = acquireSynth();
+    for (int i = 0; i < getNumEngines(); ++i) {
+        if (synths_[i].get() == synth)
+            result["engine"] = i;
+    }
+
+    double start_time = Time::getMillisecondCounterHiRes();
+    std::string error;
+    bool loaded = loadJobPreset(synth, job, error);
+    // Rewind every processor so a job renders the same no matter which jobs this synth ran before.
+    if (loaded)
+        synth->getEngine()->hardReset();
+    double loaded_time = Time::getMillisecondCounterHiRes();
+    result["load_ms"] = loaded_time - start_time;
+
+    bool rendered = false;
+    if (loaded) {
+        rendered = synth->renderAudioToFile(output_file, length, bpm, notes, false);
+        result["render_ms"] = Time::getMillisecondCounterHiRes() - loaded_time;
+        if (!rendered)
+            error = "Couldn't write output file.";
+    }
+
+    releaseSynth(synth);
+
+    result["ok"] = rendered;
+    if (!rendered)
+        result["error"] = error;
+    return result;
+}
+
+bool RenderDaemon::loadJobPreset(HeadlessSynth* synth, const json& job, std::string& error) {
+    if (!job.count("preset") || job["preset"].is_null()) {
+        synth->loadInitPreset();
+        return true;
+    }
+
+    const json& preset = job["preset"];
+    if (preset.is_string()) {
+        File preset_file = getJobFile(preset.get<std::string>());
+        if (!preset_file.existsAsFile()) {
+            error = "Preset file doesn't exist.";
+            return false;
+        }
+        if (!synth->loadFromFile(preset_file, error)) {
+            if (error.empty())
+                error = "Couldn't load preset file.";
+            return false;
+        }
+        return true;
+    }
+
+    try {
+        if (preset.is_object() && synth->loadFromState(preset))
+            return true;
+        error = "Preset state is invalid or from a newer version.";
+    }
+    catch (const json::exception& e) {
+        error = "Preset state is corrupted.";
+    }
+    return false;
+}
+
+HeadlessSynth* RenderDaemon::acquireSynth() {
+    ScopedLock lock(synth_lock_);
+    // The pool has one thread per synth so there's always a free one here.
+    VITAL_ASSERT(!free_synths_.empty());
+    HeadlessSynth* synth = free_synths_.back();
+    free_synths_.pop_back();
+    return synth;
+}
+
+void RenderDaemon::releaseSynth(HeadlessSynth* synth) {
+    ScopedLock lock(synth_lock_);
+    free_synths_.push_back(synth);
+}
+
+void RenderDaemon::writeResult(const json& result) {
+    ScopedLock lock(output_lock_);
+    *output_ << result.dump() << std::endl;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "JuceHeader.h"
+#include "json/json.h"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using json = nlohmann::json;
+
+class HeadlessSynth;
+
+/**
+ * @class RenderDaemon
+ * @brief Long running headless mode that renders jobs on a pool of already constructed synths.
+ *
+ * Building a SoundEngine and cloning its voices costs far more than a short preview render, so the daemon builds
+ * its synths once and reuses them. Jobs are read from an input stream one JSON object per line:
+ *
+ * @code
+ * {"id": 1, "preset": "bass.vital", "output": "bass.flac", "notes": ["C3", 55], "length": 2.0, "bpm": 120}
+ * @endcode
+ *
+ * "preset" is a preset path or the preset JSON itself and loads the init preset when missing. "format" optionally
+ * replaces the output file extension (wav, aiff, flac or ogg). Each finished job writes one JSON line to the output
+ * stream with its id, whether it succeeded and how long loading and rendering took in milliseconds.
+ */
+class RenderDaemon {
+public:
+    /// Largest number of synths the daemon will build.
+    static constexpr int kMaxEngines = 16;
+    /// Longest render a job may request, in seconds.
+    static constexpr float kMaxRenderLength = 15.0f;
+
+    /**
+     * @brief Builds the synths. This is the slow part and only happens once.
+     *
+     * @param num_engines The number of synths, which is also the number of jobs that can render at once.
+     */
+    RenderDaemon(int num_engines);
+    ~RenderDaemon();
+
+    /**
+     * @brief Reads jobs from the input stream until it ends and waits for all of them to finish.
+     *
+     * @param input Stream to read job lines from.
+     * @param output Stream to write job results to.
+     */
+    void run(std::istream& input, std::ostream& output);
+
+    /// Returns the number of synths in the pool.
+    int getNumEngines() const { return static_cast<int>(synths_.size()); }
+
+private:
+    /**
+     * @brief Loads and renders one job on a free synth.
+     *
+     * @param job The parsed job.
+     * @return The result line to report.
+     */
+    json render(const json& job);
+
+    /**
+     * @brief Loads a job's preset into a synth, or the init preset if the job has none.
+     *
+     * @param synth The synth to load into.
+     * @param job The parsed job.
+     * @param error Set to the reason loading failed.
+     * @return True if the preset loaded.
+     */
+    bool loadJobPreset(HeadlessSynth* synth, const json& job, std::string& error);
+
+    HeadlessSynth* acquireSynth();
+    void releaseSynth(HeadlessSynth* synth);
+    void writeResult(const json& result);
+
+    std::vector<std::unique_ptr<HeadlessSynth>> synths_;
+    std::vector<HeadlessSynth*> free_synths_;
+    CriticalSection synth_lock_;
+    CriticalSection output_lock_;
+    std::ostream* output_;
+    ThreadPool thread_pool_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderDaemon)
+};
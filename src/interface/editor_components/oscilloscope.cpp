@@ -14,17 +14,17 @@ Oscilloscope::Oscilloscope() : OpenGlLineRenderer(kResolution) {
 
 Oscilloscope::~Oscilloscope() { }
 
-void Oscilloscope::drawWaveform(OpenGlWrapper& open_gl, int index) {
+void Oscilloscope::drawWaveform(OpenGlWrapper& open_gl, const vital::poly_float* memory, int index) {
   float y_adjust = getHeight() / 2.0f;
   float width = getWidth();
-  if (memory_) {
+  if (memory) {
     for (int i = 0; i < kResolution; ++i) {
       float t = i / (kResolution - 1.0f);
       float memory_spot = (1.0f * i * vital::kOscilloscopeMemoryResolution) / kResolution;
       int memory_index = memory_spot;
       float remainder = memory_spot - memory_index;
-      float from = memory_[memory_index][index];
-      float to = memory_[memory_index + 1][index];
+      float from = memory[memory_index][index];
+      float to = memory[memory_index + 1][index];
       setXAt(i, t * width);
       setYAt(i, (1.0f - vital::utils::interpolate(from, to, remainder)) * y_adjust);
     }
@@ -44,8 +44,10 @@ void Oscilloscope::render(OpenGlWrapper& open_gl, bool animate) {
     fill_fade = parent_->findValue(Skin::kWidgetFillFade);
   setFillColors(fill_color.withMultipliedAlpha(1.0f - fill_fade), fill_color);
 
-  drawWaveform(open_gl, 0);
-  drawWaveform(open_gl, 1);
+  // Both channels come from the same snapshot.
+  const vital::poly_float* memory = memory_ ? memory_->getReadBuffer() : nullptr;
+  drawWaveform(open_gl, memory, 0);
+  drawWaveform(open_gl, memory, 1);
   renderCorners(open_gl, animate);
 }
 
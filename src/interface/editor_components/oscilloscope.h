@@ -29,9 +29,10 @@ public:
     /**
      * @brief Draws the waveform line for a given channel index.
      * @param open_gl The OpenGlWrapper providing the current OpenGL context.
+     * @param memory The oscilloscope snapshot to draw, or nullptr to keep the last line.
      * @param index The channel index (0 or 1).
      */
-    void drawWaveform(OpenGlWrapper& open_gl, int index);
+    void drawWaveform(OpenGlWrapper& open_gl, const vital::poly_float* memory, int index);
 
     /**
      * @brief Renders the oscilloscope line for both channels.
@@ -42,12 +43,12 @@ public:
 
     /**
      * @brief Sets the memory buffer that the oscilloscope reads from.
-     * @param memory A pointer to a vital::poly_float array of audio data.
+     * @param memory The SnapshotMemory the synth publishes waveform snapshots to.
      */
-    void setOscilloscopeMemory(const vital::poly_float* memory) { memory_ = memory; }
+    void setOscilloscopeMemory(vital::SnapshotMemory* memory) { memory_ = memory; }
 
 private:
-    const vital::poly_float* memory_; ///< Pointer to memory buffer holding waveform samples.
+    vital::SnapshotMemory* memory_; ///< Memory the waveform snapshots are read from.
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Oscilloscope)
 };
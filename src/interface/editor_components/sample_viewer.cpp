@@ -51,7 +51,14 @@ void SampleViewer::setLinePositions() {
     return;
 
   double sample_length = sample_->originalLength();
-  const vital::mono_float* buffer = sample_->buffer();
+  const vital::mono_float* buffer = nullptr;
+  if (sample_->isStreaming()) {
+    sample_length = vital::SampleStream::kOverviewSize;
+    buffer = sample_->stream()->overview();
+  }
+  else
+    buffer = sample_->buffer();
+
   float center = getHeight() / 2.0f;
   for (int i = 0; i < kResolution; ++i) {
     int start_index = std::min<int>(sample_length * i / kResolution, sample_length);
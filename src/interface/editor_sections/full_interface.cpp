@@ -501,7 +501,7 @@ void FullInterface::resized() {
     redoBackground();
 }
 
-void FullInterface::setOscilloscopeMemory(const vital::poly_float* memory) {
+void FullInterface::setOscilloscopeMemory(vital::SnapshotMemory* memory) {
   if (header_)
     header_->setOscilloscopeMemory(memory);
   if (master_controls_interface_)
@@ -85,9 +85,9 @@ class FullInterface : public SynthSection, public AuthenticationSection::Listene
 
     /**
      * @brief Assigns memory for oscilloscope visualization.
-     * @param memory A pointer to poly_float memory holding oscilloscope data.
+     * @param memory A pointer to the SnapshotMemory holding oscilloscope data.
      */
-    void setOscilloscopeMemory(const vital::poly_float* memory);
+    void setOscilloscopeMemory(vital::SnapshotMemory* memory);
 
     /**
      * @brief Assigns stereo audio memory for visualization.
@@ -326,7 +326,7 @@ void HeaderSection::setTemporaryTab(String name) {
   repaintBackground();
 }
 
-void HeaderSection::setOscilloscopeMemory(const vital::poly_float* memory) {
+void HeaderSection::setOscilloscopeMemory(vital::SnapshotMemory* memory) {
   oscilloscope_->setOscilloscopeMemory(memory);
 }
 
@@ -224,9 +224,9 @@ class HeaderSection : public SynthSection, public SaveSection::Listener,
 
     /**
      * @brief Sets the memory used by the oscilloscope for visualization.
-     * @param memory Pointer to poly_float memory used by the oscilloscope.
+     * @param memory Pointer to the SnapshotMemory used by the oscilloscope.
      */
-    void setOscilloscopeMemory(const vital::poly_float* memory);
+    void setOscilloscopeMemory(vital::SnapshotMemory* memory);
 
     /**
      * @brief Sets the memory used by the spectrogram for visualization.
@@ -545,7 +545,7 @@ class OutputDisplays : public SynthSection {
       spectrogram_->setBounds(x, spectrogram_y, width, spectrogram_height);
     }
 
-    void setOscilloscopeMemory(const vital::poly_float* memory) {
+    void setOscilloscopeMemory(vital::SnapshotMemory* memory) {
       oscilloscope_->setOscilloscopeMemory(memory);
     }
 
@@ -632,7 +632,7 @@ void MasterControlsInterface::passOscillatorSection(int index, const OscillatorS
   oscillator_advanceds_[index]->passOscillatorSection(oscillator);
 }
 
-void MasterControlsInterface::setOscilloscopeMemory(const vital::poly_float* memory) {
+void MasterControlsInterface::setOscilloscopeMemory(vital::SnapshotMemory* memory) {
   output_displays_->setOscilloscopeMemory(memory);
 }
 
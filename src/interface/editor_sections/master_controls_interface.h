@@ -183,9 +183,9 @@ public:
     /**
      * @brief Sets the oscilloscope memory for audio visualization.
      *
-     * @param memory Pointer to the poly_float buffer used by the oscilloscope.
+     * @param memory Pointer to the SnapshotMemory used by the oscilloscope.
      */
-    void setOscilloscopeMemory(const vital::poly_float* memory);
+    void setOscilloscopeMemory(vital::SnapshotMemory* memory);
 
     /**
      * @brief Sets the audio memory for spectrogram analysis.
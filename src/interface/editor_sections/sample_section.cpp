@@ -247,7 +247,11 @@ void SampleSection::loadFile(const File& file) {
 
   std::unique_ptr<AudioFormatReader> format_reader(sample_viewer_->formatManager().createReaderFor(file));
 
-  if (format_reader) {
+  if (format_reader && format_reader->lengthInSamples > vital::Sample::kMaxSize &&
+      sample_->loadStream(file.getFullPathName().toStdString())) {
+    sample_->setName(file.getFileNameWithoutExtension().toStdString());
+  }
+  else if (format_reader) {
     int num_samples = (int)std::min<long long>(format_reader->lengthInSamples, kMaxFileSamples);
     sample_buffer_.setSize(format_reader->numChannels, num_samples);
     format_reader->read(&sample_buffer_, 0, num_samples, 0, true, true);
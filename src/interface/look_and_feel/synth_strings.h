@@ -52,6 +52,15 @@ namespace strings {
             "Mid Ping Pong",
     };
 
+    /**
+     * @var kReverbStyleNames
+     * @brief Names for reverb styles (feedback network or convolution).
+     */
+    const std::string kReverbStyleNames[] = {
+            "Network",
+            "Convolution",
+    };
+
     /**
      * @var kCompressorBandNames
      * @brief Full names for compressor band modes.
@@ -84,6 +84,10 @@ void WavetableComponentOverlay::setComponent(WavetableComponent* component) {
 }
 
 void WavetableComponentOverlay::notifyChanged(bool mouse_up) {
+  // Editors can write straight into keyframe data, so the saved wavetable state is marked changed here.
+  if (current_component_)
+    current_component_->markChanged();
+
   if (mouse_up) {
     for (WavetableComponentOverlay::Listener* listener : listeners_)
       listener->frameDoneEditing();
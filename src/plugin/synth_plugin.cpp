@@ -27,6 +27,7 @@ SynthPlugin::SynthPlugin() {
   }
 
   bypass_parameter_ = bridge_lookup_["bypass"];
+  scheduled_changes_.setBypassParameter(bypass_parameter_->getParameterIndex());
 }
 
 SynthPlugin::~SynthPlugin() {
@@ -141,11 +142,18 @@ void SynthPlugin::processBlock(AudioSampleBuffer& buffer, MidiBuffer& midi_messa
 
   // Check if bypassed
   if (bypass_parameter_->getValue()) {
+    applyScheduledChanges(ParameterChangeScheduler::kEndOfBlock);
     processBlockBypassed(buffer, midi_messages);
     return;
   }
 
+  // Hosts can flush parameter changes with an empty block. There's nothing to split, so apply them all.
   int total_samples = buffer.getNumSamples();
+  if (total_samples == 0) {
+    applyScheduledChanges(ParameterChangeScheduler::kEndOfBlock);
+    return;
+  }
+
   int num_channels = getTotalNumOutputChannels();
   AudioPlayHead* play_head = getPlayHead();
   if (play_head) {
@@ -159,13 +167,20 @@ void SynthPlugin::processBlock(AudioSampleBuffer& buffer, MidiBuffer& midi_messa
     }
   }
 
+  // Nobody watches the displays during an offline bounce.
+  suspendMemoryOutput(isNonRealtime());
+
   processModulationChanges();
   if (total_samples)
     processKeyboardEvents(midi_messages, total_samples);
 
   double sample_time = 1.0 / AudioProcessor::getSampleRate();
   for (int sample_offset = 0; sample_offset < total_samples;) {
-    int num_samples = std::min<int>(total_samples - sample_offset, vital::kMaxBufferSize);
+    applyScheduledChanges(sample_offset);
+
+    // Host automation splits processing like MIDI so each change lands on its own sample.
+    int max_samples = std::min<int>(total_samples - sample_offset, vital::kMaxBufferSize);
+    int num_samples = scheduled_changes_.getSplitSamples(sample_offset, max_samples);
 
     engine_->correctToTime(last_seconds_time_);
     processMidi(midi_messages, sample_offset, sample_offset + num_samples);
@@ -174,6 +189,8 @@ void SynthPlugin::processBlock(AudioSampleBuffer& buffer, MidiBuffer& midi_messa
     last_seconds_time_ += num_samples * sample_time;
     sample_offset += num_samples;
   }
+
+  applyScheduledChanges(ParameterChangeScheduler::kEndOfBlock);
 }
 
 bool SynthPlugin::hasEditor() const {
@@ -190,15 +207,27 @@ void SynthPlugin::parameterChanged(std::string name, vital::mono_float value) {
   valueChangedExternal(name, value);
 }
 
+void SynthPlugin::parameterChangeScheduled(ValueBridge* bridge, float value, int sample_offset) {
+  if (!scheduled_changes_.schedule(bridge->getParameterIndex(), value, sample_offset))
+    bridge->setValue(value);
+}
+
+void SynthPlugin::applyScheduledChanges(int sample_offset) {
+  const Array<AudioProcessorParameter*>& parameters = getParameters();
+  ParameterChangeScheduler::Change change;
+  while (scheduled_changes_.getNextChange(sample_offset, change))
+    parameters[change.parameter_index]->setValue(change.value);
+}
+
 void SynthPlugin::getStateInformation(MemoryBlock& dest_data) {
   // Save current state to JSON and then to the memory block.
   json data = LoadSave::stateToJson(this, getCallbackLock());
   data["tuning"] = getTuning()->stateToJson();
 
-  String data_string = data.dump();
-  MemoryOutputStream stream;
-  stream.writeString(data_string);
-  dest_data.append(stream.getData(), stream.getDataSize());
+  // Same bytes MemoryOutputStream::writeString would produce, UTF-8 and a null terminator, without the two
+  // extra copies of what can be several megabytes of encoded wavetables and samples.
+  std::string data_string = data.dump();
+  dest_data.append(data_string.c_str(), data_string.size() + 1);
 }
 
 void SynthPlugin::setStateInformation(const void* data, int size_in_bytes) {
@@ -206,19 +235,20 @@ void SynthPlugin::setStateInformation(const void* data, int size_in_bytes) {
   MemoryInputStream stream(data, size_in_bytes, false);
   String data_string = stream.readEntireStreamAsString();
 
-  pauseProcessing(true);
+  // Host program changes are swapped in with a short fade so processing never stops.
   try {
     json json_data = json::parse(data_string.toStdString());
-    LoadSave::jsonToState(this, save_info_, json_data);
+    loadFromJsonWithFade(json_data);
 
-    if (json_data.count("tuning"))
+    if (json_data.count("tuning")) {
+      ScopedLock lock(getCriticalSection());
       getTuning()->jsonToState(json_data["tuning"]);
+    }
   }
   catch (const json::exception& e) {
     std::string error = "There was an error open the preset. Preset file is corrupted.";
     AlertWindow::showNativeDialogBox("Error opening preset", error, false);
   }
-  pauseProcessing(false);
 
   SynthGuiInterface* editor = getGuiInterface();
   if (editor)
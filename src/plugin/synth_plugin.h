@@ -8,6 +8,7 @@ SynthPlugin is the core plugin class handling parameter management, saving/loadi
 
 #include "JuceHeader.h"
 
+#include "parameter_change_scheduler.h"
 #include "synth_base.h"
 #include "value_bridge.h"
 
@@ -225,12 +226,31 @@ class SynthPlugin : public SynthBase, public AudioProcessor, public ValueBridge:
      */
     void parameterChanged(std::string name, vital::mono_float value) override;
 
+    /**
+     * @brief Called when the host schedules a parameter change for a sample in the next block.
+     *
+     * The change is held until processBlock reaches that sample. Changes to bypass, changes at
+     * the start of the block and changes that don't fit are applied immediately.
+     *
+     * @param bridge The parameter that changes.
+     * @param value The new normalized value.
+     * @param sample_offset The sample in the next block the change belongs at.
+     */
+    void parameterChangeScheduled(ValueBridge* bridge, float value, int sample_offset) override;
+
   private:
+    /**
+     * @brief Applies scheduled changes that belong at or before a sample of this block.
+     * @param sample_offset The sample processing has reached, or ParameterChangeScheduler::kEndOfBlock.
+     */
+    void applyScheduledChanges(int sample_offset);
+
     ValueBridge* bypass_parameter_;      ///< Pointer to the bypass parameter bridge.
     double last_seconds_time_;           ///< Tracks the last processed time in seconds.
     AudioPlayHead::CurrentPositionInfo position_info_; ///< Stores current host position information.
 
     std::map<std::string, ValueBridge*> bridge_lookup_; ///< Lookup for parameter name to ValueBridge objects.
+    ParameterChangeScheduler scheduled_changes_; ///< Host changes waiting for their sample in this block.
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SynthPlugin)
 };
@@ -38,6 +38,17 @@ class ValueBridge : public AudioProcessorParameter {
          * @param value The new value of the parameter in the engine's internal range.
          */
         virtual void parameterChanged(std::string name, vital::mono_float value) = 0;
+
+        /**
+         * @brief Called when the host schedules a change for a sample in the next audio block.
+         *
+         * The listener should call @c setValue() on the bridge once processing reaches that sample.
+         *
+         * @param bridge The parameter that changes.
+         * @param value The new normalized value of the parameter.
+         * @param sample_offset The sample in the next block the change belongs at.
+         */
+        virtual void parameterChangeScheduled(ValueBridge* bridge, float value, int sample_offset) = 0;
     };
 
     /**
@@ -86,6 +97,20 @@ class ValueBridge : public AudioProcessorParameter {
       }
     }
 
+    /**
+     * @brief Schedules a host value change for a sample in the next audio block.
+     *
+     * Hosts that timestamp automation call this once per automation point. The listener
+     * decides when the change reaches the engine.
+     *
+     * @param value The new normalized value of the parameter.
+     * @param sample_offset The sample in the next block the change belongs at.
+     */
+    void setValueAtSampleOffset(float value, int sample_offset) override {
+      if (listener_ && !source_changed_)
+        listener_->parameterChangeScheduled(this, value, sample_offset);
+    }
+
     /**
      * @brief Sets a listener to receive parameter change callbacks.
      *
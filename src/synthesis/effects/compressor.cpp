@@ -44,6 +44,55 @@ namespace vital {
      * @brief Minimum envelope size in samples for the compressor’s attack/release calculations.
      */
     constexpr mono_float kMinSampleEnvelope = 5.0f;
+
+    /**
+     * @brief Range of the gain in log2 units, matching a linear gain of 0 to kMaxExpandMult.
+     */
+    constexpr mono_float kMinLogGain = -126.0f;
+    constexpr mono_float kMaxLogGain = 5.0f;
+
+    /**
+     * @brief Decibels per doubling of amplitude.
+     */
+    constexpr mono_float kDbPerLog2 = 6.0205999f;
+
+    /**
+     * @brief Largest log2 gain change each envelope may cause over an interpolated stretch.
+     *
+     * Half of the error bound goes to each envelope so together they stay within kMaxGainErrorDb.
+     */
+    constexpr mono_float kMaxStretchLogGain = 0.5f * Compressor::kMaxGainErrorDb / kDbPerLog2;
+
+    /**
+     * @brief Limits the allowed envelope spread when a ratio is close to zero.
+     */
+    constexpr mono_float kMaxSpreadExponent = 64.0f;
+
+    /**
+     * @brief Evaluates the compressor gain curve in the log domain.
+     *
+     * Equivalent to pow(upper_threshold / high, upper_ratio) * pow(lower_threshold / low, lower_ratio), clamped
+     * to [0, kMaxExpandMult], with a single exp2 and no divisions.
+     */
+    force_inline poly_float computeGain(poly_float high_enveloped_mean_squared,
+                                        poly_float low_enveloped_mean_squared,
+                                        poly_float log_upper_threshold, poly_float log_lower_threshold,
+                                        poly_float upper_ratio, poly_float lower_ratio) {
+      poly_float upper_log_gain = (log_upper_threshold - futils::log2(high_enveloped_mean_squared)) * upper_ratio;
+      poly_float lower_log_gain = (log_lower_threshold - futils::log2(low_enveloped_mean_squared)) * lower_ratio;
+      return futils::exp2(utils::clamp(upper_log_gain + lower_log_gain, kMinLogGain, kMaxLogGain));
+    }
+
+    /**
+     * @brief Returns the largest ratio between the highest and lowest envelope of an interpolated stretch.
+     *
+     * @param ratio The ratio the envelope's log level is scaled by in the gain curve.
+     */
+    force_inline poly_float getMaxEnvelopeSpread(poly_float ratio) {
+      poly_float min_ratio = kMaxStretchLogGain / kMaxSpreadExponent;
+      poly_float exponent = poly_float(kMaxStretchLogGain) / utils::max(poly_float::abs(ratio), min_ratio);
+      return futils::exp2(exponent);
+    }
   } // namespace
 
   //============================================================================
@@ -73,6 +122,7 @@ namespace vital {
                                        constants::kFirstMask);
     output_mult_ = 0.0f;
     mix_ = 0.0f;
+    gain_interval_ = kDefaultGainInterval;
   }
 
   /**
@@ -104,6 +154,10 @@ namespace vital {
   /**
    * @brief Computes a running envelope (RMS) for upper/lower thresholds and applies compression gain.
    *
+   * The envelopes are updated every sample. The gain is evaluated at the end of every gain interval and
+   * interpolated from the previous one, unless an envelope spread too far within the interval for the
+   * interpolation to stay within kMaxGainErrorDb, in which case the gain is evaluated for every sample.
+   *
    * @param audio_in    Pointer to the input buffer.
    * @param num_samples Number of samples to process.
    */
@@ -138,44 +192,83 @@ namespace vital {
     lower_threshold = futils::dbToMagnitude(lower_threshold);
     lower_threshold *= lower_threshold;
 
+    poly_float log_upper_threshold = futils::log2(upper_threshold);
+    poly_float log_lower_threshold = futils::log2(lower_threshold);
+
     // Load compression/expansion ratios
     poly_float upper_ratio = utils::clamp(input(kUpperRatio)->at(0), 0.0f, 1.0f) * 0.5f;
     poly_float lower_ratio = utils::clamp(input(kLowerRatio)->at(0), -1.0f, 1.0f) * 0.5f;
+    poly_float max_high_spread = getMaxEnvelopeSpread(upper_ratio);
+    poly_float max_low_spread = getMaxEnvelopeSpread(lower_ratio);
 
     poly_float low_enveloped_mean_squared = low_enveloped_mean_squared_;
     poly_float high_enveloped_mean_squared = high_enveloped_mean_squared_;
 
-    for (int i = 0; i < num_samples; ++i) {
-      poly_float sample = audio_in[i];
-      poly_float sample_squared = sample * sample;
-
-      // Update high band envelope
-      poly_mask high_attack_mask = poly_float::greaterThan(sample_squared, high_enveloped_mean_squared);
-      poly_float high_samples = utils::maskLoad(envelope_release_samples, envelope_attack_samples, high_attack_mask);
-      poly_float high_scale = utils::maskLoad(release_scale, attack_scale, high_attack_mask);
-      high_enveloped_mean_squared = (sample_squared + high_enveloped_mean_squared * high_samples) * high_scale;
-      high_enveloped_mean_squared = utils::max(high_enveloped_mean_squared, upper_threshold);
-
-      // Compute compression above upper threshold
-      poly_float upper_mag_delta = upper_threshold / high_enveloped_mean_squared;
-      poly_float upper_mult = futils::pow(upper_mag_delta, upper_ratio);
-
-      // Update low band envelope
-      poly_mask low_attack_mask = poly_float::greaterThan(sample_squared, low_enveloped_mean_squared);
-      poly_float low_samples = utils::maskLoad(envelope_release_samples, envelope_attack_samples, low_attack_mask);
-      poly_float low_scale = utils::maskLoad(release_scale, attack_scale, low_attack_mask);
-      low_enveloped_mean_squared = (sample_squared + low_enveloped_mean_squared * low_samples) * low_scale;
-      low_enveloped_mean_squared = utils::min(low_enveloped_mean_squared, lower_threshold);
-
-      // Compute expansion below lower threshold
-      poly_float lower_mag_delta = lower_threshold / low_enveloped_mean_squared;
-      poly_float lower_mult = futils::pow(lower_mag_delta, lower_ratio);
-
-      // Combine gain multipliers and clamp
-      poly_float gain_compression = utils::clamp(upper_mult * lower_mult, 0.0f, kMaxExpandMult);
-      audio_out[i] = gain_compression * sample;
-
-      VITAL_ASSERT(utils::isContained(audio_out[i]));
+    // Gain for the last envelopes with this block's settings so interpolation starts from the right place.
+    poly_float gain = computeGain(high_enveloped_mean_squared, low_enveloped_mean_squared,
+                                  log_upper_threshold, log_lower_threshold, upper_ratio, lower_ratio);
+
+    poly_float high_envelopes[kMaxGainInterval];
+    poly_float low_envelopes[kMaxGainInterval];
+
+    for (int start = 0; start < num_samples; start += gain_interval_) {
+      int stretch = std::min(gain_interval_, num_samples - start);
+      poly_float high_min = high_enveloped_mean_squared;
+      poly_float high_max = high_enveloped_mean_squared;
+      poly_float low_min = low_enveloped_mean_squared;
+      poly_float low_max = low_enveloped_mean_squared;
+
+      for (int i = 0; i < stretch; ++i) {
+        poly_float sample = audio_in[start + i];
+        poly_float sample_squared = sample * sample;
+
+        // Update high band envelope
+        poly_mask high_attack_mask = poly_float::greaterThan(sample_squared, high_enveloped_mean_squared);
+        poly_float high_samples = utils::maskLoad(envelope_release_samples, envelope_attack_samples, high_attack_mask);
+        poly_float high_scale = utils::maskLoad(release_scale, attack_scale, high_attack_mask);
+        high_enveloped_mean_squared = (sample_squared + high_enveloped_mean_squared * high_samples) * high_scale;
+        high_enveloped_mean_squared = utils::max(high_enveloped_mean_squared, upper_threshold);
+
+        // Update low band envelope
+        poly_mask low_attack_mask = poly_float::greaterThan(sample_squared, low_enveloped_mean_squared);
+        poly_float low_samples = utils::maskLoad(envelope_release_samples, envelope_attack_samples, low_attack_mask);
+        poly_float low_scale = utils::maskLoad(release_scale, attack_scale, low_attack_mask);
+        low_enveloped_mean_squared = (sample_squared + low_enveloped_mean_squared * low_samples) * low_scale;
+        low_enveloped_mean_squared = utils::min(low_enveloped_mean_squared, lower_threshold);
+
+        high_envelopes[i] = high_enveloped_mean_squared;
+        low_envelopes[i] = low_enveloped_mean_squared;
+        high_min = utils::min(high_min, high_enveloped_mean_squared);
+        high_max = utils::max(high_max, high_enveloped_mean_squared);
+        low_min = utils::min(low_min, low_enveloped_mean_squared);
+        low_max = utils::max(low_max, low_enveloped_mean_squared);
+      }
+
+      poly_float end_gain = computeGain(high_enveloped_mean_squared, low_enveloped_mean_squared,
+                                        log_upper_threshold, log_lower_threshold, upper_ratio, lower_ratio);
+
+      // Every gain in the stretch lies between the gains at the envelope extremes, and so does the
+      // interpolated gain. Keeping the extremes close bounds the difference between the two.
+      poly_mask spread_mask = poly_float::greaterThan(high_max, high_min * max_high_spread) |
+                              poly_float::greaterThan(low_max, low_min * max_low_spread);
+      if (spread_mask.anyMask()) {
+        for (int i = 0; i < stretch; ++i) {
+          poly_float sample_gain = computeGain(high_envelopes[i], low_envelopes[i],
+                                               log_upper_threshold, log_lower_threshold, upper_ratio, lower_ratio);
+          audio_out[start + i] = sample_gain * audio_in[start + i];
+          VITAL_ASSERT(utils::isContained(audio_out[start + i]));
+        }
+      }
+      else {
+        poly_float delta_gain = (end_gain - gain) * (1.0f / stretch);
+        for (int i = 0; i < stretch; ++i) {
+          gain += delta_gain;
+          audio_out[start + i] = gain * audio_in[start + i];
+          VITAL_ASSERT(utils::isContained(audio_out[start + i]));
+        }
+      }
+
+      gain = end_gain;
     }
 
     // Save updated envelopes
@@ -12,9 +12,21 @@ namespace vital {
    * The Compressor class applies compression/expansion based on two thresholds (upper and lower)
    * and corresponding ratios. It tracks the input and output RMS levels and adjusts audio samples
    * in real time according to configured attack and release times.
+   *
+   * The envelopes are followed every sample but the gain curve is evaluated in the log domain once every
+   * gain interval, with the gain interpolated in between. A stretch is only interpolated when its envelopes
+   * moved little enough that every sample stays within kMaxGainErrorDb of the per sample gain. Stretches with
+   * faster changes, like attacks on transients, fall back to evaluating the gain every sample.
    */
   class Compressor : public Processor {
     public:
+      /// Largest difference in dB between the interpolated gain and the gain evaluated every sample.
+      static constexpr mono_float kMaxGainErrorDb = 0.1f;
+      /// Number of samples the gain curve is evaluated at by default.
+      static constexpr int kDefaultGainInterval = 8;
+      /// Largest allowed gain interval in samples.
+      static constexpr int kMaxGainInterval = 32;
+
       /**
        * @enum InputIndices
        * @brief Enumerates the input indices to the Compressor Processor.
@@ -104,6 +116,20 @@ namespace vital {
        */
       void reset(poly_mask reset_mask) override;
 
+      /**
+       * @brief Sets how many samples apart the gain curve is evaluated.
+       *
+       * @param gain_interval Samples per gain evaluation, 1 evaluates it every sample.
+       */
+      void setGainInterval(int gain_interval) { gain_interval_ = utils::iclamp(gain_interval, 1, kMaxGainInterval); }
+
+      /**
+       * @brief Gets how many samples apart the gain curve is evaluated.
+       *
+       * @return The gain interval in samples.
+       */
+      int getGainInterval() const { return gain_interval_; }
+
       /**
        * @brief Retrieves the current input RMS value (mean squared).
        *
@@ -169,6 +195,11 @@ namespace vital {
        */
       poly_float output_mult_;
 
+      /**
+       * @brief Number of samples between evaluations of the gain curve.
+       */
+      int gain_interval_;
+
       JUCE_LEAK_DETECTOR(Compressor)
   };
 
@@ -289,6 +320,16 @@ namespace vital {
        */
       void reset(poly_mask reset_mask) override;
 
+      /**
+       * @brief Sets how many samples apart the band compressors evaluate their gain curves.
+       *
+       * @param gain_interval Samples per gain evaluation, see Compressor::setGainInterval().
+       */
+      void setGainInterval(int gain_interval) {
+        low_band_compressor_.setGainInterval(gain_interval);
+        band_high_compressor_.setGainInterval(gain_interval);
+      }
+
     protected:
       /**
        * @brief Extracts the LinkwitzRileyFilter’s output into a combined buffer for further processing.
@@ -0,0 +1,760 @@
+#include "convolution_reverb.h"
+
+#include "fourier_transform.h"
+#include "futils.h"
+#include "synth_constants.h"
+
+namespace vital {
+
+  namespace {
+    constexpr int kHeadFftBits = ConvolutionReverb::kHeadPartitionBits + 1;
+    constexpr int kHeadFftSize = 1 << kHeadFftBits;
+    constexpr int kHeadContainers = ConvolutionReverb::kHeadPartitionSize / poly_float::kSize + 1;
+    constexpr int kTailFftBits = ConvolutionReverb::kTailPartitionBits + 1;
+    constexpr int kTailFftSize = 1 << kTailFftBits;
+    constexpr int kTailContainers = ConvolutionReverb::kTailPartitionSize / poly_float::kSize + 1;
+    constexpr mono_float kT60Amplitude = 0.001f;
+    constexpr uint64_t kNoTailJob = 0;
+    constexpr int kMaxKernelId = 0xffff;
+
+    // A tail job is packed into one word so it can be handed between threads atomically: the id of the kernel it
+    // belongs to, how many partitions have valid history and the block it convolves.
+    force_inline uint64_t encodeTailJob(int kernel_id, int num_partitions, int block) {
+      return (static_cast<uint64_t>(kernel_id & 0xffff) << 48) |
+             (static_cast<uint64_t>(num_partitions & 0xffff) << 32) |
+             static_cast<uint32_t>(block);
+    }
+
+    force_inline int tailJobKernelId(uint64_t job) { return static_cast<int>((job >> 48) & 0xffff); }
+    force_inline int tailJobPartitions(uint64_t job) { return static_cast<int>((job >> 32) & 0xffff); }
+    force_inline int tailJobBlock(uint64_t job) { return static_cast<int>(static_cast<uint32_t>(job)); }
+
+    // Spectra are stored split, all real parts followed by all imaginary parts, so the
+    // multiply accumulate runs over whole poly_floats.
+    force_inline void toSplitSpectrum(poly_float* dest, const mono_float* transformed, int containers) {
+      mono_float* real = reinterpret_cast<mono_float*>(dest);
+      mono_float* imaginary = reinterpret_cast<mono_float*>(dest + containers);
+      int num_bins = (containers - 1) * poly_float::kSize + 1;
+      for (int i = 0; i < num_bins; ++i) {
+        real[i] = transformed[2 * i];
+        imaginary[i] = transformed[2 * i + 1];
+      }
+      for (int i = num_bins; i < containers * poly_float::kSize; ++i) {
+        real[i] = 0.0f;
+        imaginary[i] = 0.0f;
+      }
+    }
+
+    force_inline void fromSplitSpectrum(mono_float* transformed, const poly_float* source, int containers) {
+      const mono_float* real = reinterpret_cast<const mono_float*>(source);
+      const mono_float* imaginary = reinterpret_cast<const mono_float*>(source + containers);
+      int num_bins = (containers - 1) * poly_float::kSize + 1;
+      for (int i = 0; i < num_bins; ++i) {
+        transformed[2 * i] = real[i];
+        transformed[2 * i + 1] = imaginary[i];
+      }
+      int fft_size = 2 * (num_bins - 1);
+      for (int i = 2 * num_bins; i < 2 * fft_size; ++i)
+        transformed[i] = 0.0f;
+    }
+
+    force_inline void multiplyAdd(poly_float* accumulator, const poly_float* input,
+                                  const poly_float* response, int containers) {
+      poly_float* accumulator_imaginary = accumulator + containers;
+      const poly_float* input_imaginary = input + containers;
+      const poly_float* response_imaginary = response + containers;
+      for (int i = 0; i < containers; ++i) {
+        poly_float real = input[i] * response[i] - input_imaginary[i] * response_imaginary[i];
+        poly_float imaginary = input[i] * response_imaginary[i] + input_imaginary[i] * response[i];
+        accumulator[i] += real;
+        accumulator_imaginary[i] += imaginary;
+      }
+    }
+
+    // The FFT backends scale differently, so measure the forward gain and round trip gain once and
+    // fold the correction into the stored response spectra.
+    mono_float computeConvolutionScale(FourierTransform* transform, int fft_size) {
+      std::unique_ptr<mono_float[]> buffer = std::make_unique<mono_float[]>(2 * fft_size);
+      buffer[0] = 1.0f;
+      transform->transformRealForward(buffer.get());
+      mono_float forward_gain = buffer[0];
+      transform->transformRealInverse(buffer.get());
+      mono_float round_trip_gain = buffer[0];
+      return 1.0f / (forward_gain * round_trip_gain);
+    }
+
+    force_inline mono_float readCubic(const mono_float* buffer, int size, double position) {
+      int index = static_cast<int>(position);
+      mono_float t = static_cast<mono_float>(position - index);
+      mono_float values[4];
+      for (int i = 0; i < 4; ++i) {
+        int read = index + i - 1;
+        values[i] = (read >= 0 && read < size) ? buffer[read] : 0.0f;
+      }
+
+      mono_float slope1 = 0.5f * (values[2] - values[0]);
+      mono_float slope2 = 0.5f * (values[3] - values[1]);
+      mono_float delta = values[2] - values[1];
+      mono_float a = slope1 + slope2 - 2.0f * delta;
+      mono_float b = 3.0f * delta - 2.0f * slope1 - slope2;
+      return ((a * t + b) * t + slope1) * t + values[1];
+    }
+
+    std::unique_ptr<mono_float[]> decodePcm(const std::string& encoded, int length) {
+      MemoryOutputStream decoded(length * sizeof(int16_t));
+      Base64::convertFromBase64(decoded, encoded);
+      std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(length);
+      memcpy(pcm_data.get(), decoded.getData(), std::min<size_t>(decoded.getDataSize(), length * sizeof(int16_t)));
+      std::unique_ptr<mono_float[]> buffer = std::make_unique<mono_float[]>(length);
+      utils::pcmToFloatData(buffer.get(), pcm_data.get(), length);
+      return buffer;
+    }
+
+    std::string encodePcm(const mono_float* buffer, int length) {
+      std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(length);
+      utils::floatToPcmData(pcm_data.get(), buffer, length);
+      return Base64::toBase64(pcm_data.get(), sizeof(int16_t) * length).toStdString();
+    }
+  } // namespace
+
+  //==================  ImpulseResponse Implementation  =======================//
+
+  ImpulseResponse::ImpulseResponse() : length_(0), sample_rate_(kDefaultSampleRate), stereo_(false), default_(true) {
+    init();
+  }
+
+  void ImpulseResponse::init() {
+    int length = kDefaultLengthSeconds * kDefaultSampleRate;
+    std::unique_ptr<mono_float[]> left = std::make_unique<mono_float[]>(length);
+    std::unique_ptr<mono_float[]> right = std::make_unique<mono_float[]>(length);
+    utils::RandomGenerator random_generator(-1.0f, 1.0f);
+
+    // Decorrelated noise with an exponential decay reaching kT60Amplitude at kDefaultDecaySeconds.
+    mono_float decay = std::pow(kT60Amplitude, 1.0f / (kDefaultDecaySeconds * kDefaultSampleRate));
+    mono_float amplitude = 1.0f;
+    for (int i = 0; i < length; ++i) {
+      left[i] = amplitude * random_generator.next();
+      right[i] = amplitude * random_generator.next();
+      amplitude *= decay;
+    }
+
+    loadSample(left.get(), right.get(), length, kDefaultSampleRate);
+    name_ = "";
+    default_ = true;
+  }
+
+  void ImpulseResponse::loadSample(const mono_float* buffer, int size, int sample_rate) {
+    size = std::min(size, kMaxLengthSeconds * sample_rate);
+    std::unique_ptr<mono_float[]> left = std::make_unique<mono_float[]>(size);
+    memcpy(left.get(), buffer, size * sizeof(mono_float));
+
+    std::unique_ptr<mono_float[]> old_right;
+    {
+      std::lock_guard<std::mutex> lock(data_mutex_);
+      length_ = size;
+      sample_rate_ = sample_rate;
+      stereo_ = false;
+      default_ = false;
+      left_.swap(left);
+      right_.swap(old_right);
+      encoded_left_.clear();
+      encoded_right_.clear();
+    }
+    notifyListeners();
+  }
+
+  void ImpulseResponse::loadSample(const mono_float* left_buffer, const mono_float* right_buffer,
+                                   int size, int sample_rate) {
+    size = std::min(size, kMaxLengthSeconds * sample_rate);
+    std::unique_ptr<mono_float[]> left = std::make_unique<mono_float[]>(size);
+    std::unique_ptr<mono_float[]> right = std::make_unique<mono_float[]>(size);
+    memcpy(left.get(), left_buffer, size * sizeof(mono_float));
+    memcpy(right.get(), right_buffer, size * sizeof(mono_float));
+
+    {
+      std::lock_guard<std::mutex> lock(data_mutex_);
+      length_ = size;
+      sample_rate_ = sample_rate;
+      stereo_ = true;
+      default_ = false;
+      left_.swap(left);
+      right_.swap(right);
+      encoded_left_.clear();
+      encoded_right_.clear();
+    }
+    notifyListeners();
+  }
+
+  void ImpulseResponse::removeListener(Listener* listener) {
+    listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), listener), listeners_.end());
+  }
+
+  void ImpulseResponse::swapData(ImpulseResponse& other) {
+    {
+      std::lock(data_mutex_, other.data_mutex_);
+      std::lock_guard<std::mutex> lock(data_mutex_, std::adopt_lock);
+      std::lock_guard<std::mutex> other_lock(other.data_mutex_, std::adopt_lock);
+      name_.swap(other.name_);
+      last_browsed_file_.swap(other.last_browsed_file_);
+      std::swap(length_, other.length_);
+      std::swap(sample_rate_, other.sample_rate_);
+      std::swap(stereo_, other.stereo_);
+      std::swap(default_, other.default_);
+      left_.swap(other.left_);
+      right_.swap(other.right_);
+      encoded_left_.swap(other.encoded_left_);
+      encoded_right_.swap(other.encoded_right_);
+    }
+    notifyListeners();
+    other.notifyListeners();
+  }
+
+  void ImpulseResponse::clearStateCache() {
+    encoded_left_.clear();
+    encoded_right_.clear();
+  }
+
+  void ImpulseResponse::notifyListeners() {
+    for (Listener* listener : listeners_)
+      listener->impulseResponseChanged(this);
+  }
+
+  json ImpulseResponse::stateToJson() {
+    json data;
+    data["name"] = name_;
+    data["length"] = length_;
+    data["sample_rate"] = sample_rate_;
+    if (encoded_left_.empty()) {
+      encoded_left_ = encodePcm(left_.get(), length_);
+      if (stereo_)
+        encoded_right_ = encodePcm(right_.get(), length_);
+    }
+
+    data["samples"] = encoded_left_;
+    if (stereo_)
+      data["samples_stereo"] = encoded_right_;
+    return data;
+  }
+
+  void ImpulseResponse::jsonToState(json data) {
+    std::string name = "";
+    if (data.count("name"))
+      name = data["name"].get<std::string>();
+
+    int length = data["length"];
+    int sample_rate = data["sample_rate"];
+    if (length <= 0 || sample_rate <= 0) {
+      init();
+      return;
+    }
+
+    std::unique_ptr<mono_float[]> buffer = decodePcm(data["samples"], length);
+    if (data.count("samples_stereo")) {
+      std::unique_ptr<mono_float[]> buffer_stereo = decodePcm(data["samples_stereo"], length);
+      loadSample(buffer.get(), buffer_stereo.get(), length, sample_rate);
+    }
+    else
+      loadSample(buffer.get(), length, sample_rate);
+
+    name_ = name;
+  }
+
+  //==================  ConvolutionReverb Implementation  =======================//
+
+  struct ConvolutionReverb::Kernel {
+    Kernel(int kernel_id, int kernel_length, int head_partitions, int tail_partitions) :
+        id(kernel_id), length(kernel_length), num_head_partitions(head_partitions),
+        num_tail_partitions(tail_partitions), head_history_index(0) {
+      int head_size = std::max(1, num_head_partitions * kNumChannels * 2 * kHeadContainers);
+      int tail_size = std::max(1, num_tail_partitions * kNumChannels * 2 * kTailContainers);
+      // One extra history slot so the audio thread can write the newest block while a late job still reads
+      // the oldest one.
+      int tail_history_size = (num_tail_partitions + 1) * kNumChannels * 2 * kTailContainers;
+      direct = std::make_unique<poly_float[]>(kHeadPartitionSize);
+      head_spectra = std::make_unique<poly_float[]>(head_size);
+      head_history = std::make_unique<poly_float[]>(head_size);
+      tail_spectra = std::make_unique<poly_float[]>(tail_size);
+      tail_history = std::make_unique<poly_float[]>(tail_history_size);
+      clearHead();
+    }
+
+    force_inline poly_float* headSpectrum(poly_float* base, int partition, int channel) {
+      return base + (partition * kNumChannels + channel) * 2 * kHeadContainers;
+    }
+
+    force_inline poly_float* tailSpectrum(poly_float* base, int partition, int channel) {
+      return base + (partition * kNumChannels + channel) * 2 * kTailContainers;
+    }
+
+    force_inline int tailHistorySlot(int block) const {
+      return block % (num_tail_partitions + 1);
+    }
+
+    // Tail history isn't cleared, jobs only read the blocks written since the last reset.
+    void clearHead() {
+      int head_size = num_head_partitions * kNumChannels * 2 * kHeadContainers;
+      for (int i = 0; i < head_size; ++i)
+        head_history[i] = 0.0f;
+      head_history_index = 0;
+    }
+
+    int id;
+    int length;
+    int num_head_partitions;
+    int num_tail_partitions;
+    std::unique_ptr<poly_float[]> direct;
+    std::unique_ptr<poly_float[]> head_spectra;
+    std::unique_ptr<poly_float[]> head_history;
+    int head_history_index;
+    std::unique_ptr<poly_float[]> tail_spectra;
+    std::unique_ptr<poly_float[]> tail_history;
+  };
+
+  /**
+   * @struct ConvolutionReverb::TailScratch
+   * @brief Buffers for computing a tail block. The audio thread and the worker each have their own.
+   */
+  struct ConvolutionReverb::TailScratch {
+    TailScratch() {
+      transform = std::make_unique<FourierTransform>(kTailFftBits);
+      buffer = std::make_unique<mono_float[]>(2 * kTailFftSize);
+      accumulator = std::make_unique<poly_float[]>(2 * kTailContainers);
+      result = std::make_unique<mono_float[]>(kNumChannels * 2 * kTailPartitionSize);
+    }
+
+    std::unique_ptr<FourierTransform> transform;
+    std::unique_ptr<mono_float[]> buffer;
+    std::unique_ptr<poly_float[]> accumulator;
+    std::unique_ptr<mono_float[]> result;
+  };
+
+  /**
+   * @class ConvolutionReverb::Worker
+   * @brief Background thread that computes posted tail blocks, rebuilds the response after sample rate changes
+   *        and frees responses the audio thread has stopped using.
+   */
+  class ConvolutionReverb::Worker : public Thread {
+    public:
+      Worker(ConvolutionReverb* reverb) : Thread("Convolution Reverb Worker"), reverb_(reverb) { }
+
+      void run() override {
+        while (!threadShouldExit()) {
+          wait(-1);
+          if (threadShouldExit())
+            return;
+
+          reverb_->runWorker();
+        }
+      }
+
+    private:
+      ConvolutionReverb* reverb_;
+  };
+
+  ConvolutionReverb::ConvolutionReverb(std::shared_ptr<ImpulseResponse> impulse_response) :
+      Processor(kNumInputs, 1), impulse_response_(std::move(impulse_response)),
+      kernel_(nullptr), next_kernel_(nullptr), retired_kernel_(nullptr), next_kernel_id_(1),
+      requested_sample_rate_(0), built_sample_rate_(0), kernel_length_(0),
+      posted_tail_job_(kNoTailJob), completed_tail_job_(kNoTailJob), dry_(0.0f), wet_(0.0f),
+      history_position_(0), head_position_(0), tail_position_(0), tail_block_(0), reset_block_(0),
+      tail_job_(kNoTailJob) {
+    if (impulse_response_ == nullptr)
+      impulse_response_ = std::make_shared<ImpulseResponse>();
+
+    head_transform_ = std::make_unique<FourierTransform>(kHeadFftBits);
+    audio_scratch_ = std::make_unique<TailScratch>();
+    worker_scratch_ = std::make_unique<TailScratch>();
+    head_scale_ = computeConvolutionScale(head_transform_.get(), kHeadFftSize);
+    tail_scale_ = computeConvolutionScale(audio_scratch_->transform.get(), kTailFftSize);
+
+    history_ = std::make_unique<poly_float[]>(2 * kHeadPartitionSize);
+    head_input_ = std::make_unique<mono_float[]>(kNumChannels * kHeadPartitionSize);
+    head_output_ = std::make_unique<mono_float[]>(kNumChannels * kHeadPartitionSize);
+    head_overlap_ = std::make_unique<mono_float[]>(kNumChannels * kHeadPartitionSize);
+    head_buffer_ = std::make_unique<mono_float[]>(2 * kHeadFftSize);
+    head_accumulator_ = std::make_unique<poly_float[]>(2 * kHeadContainers);
+
+    tail_input_ = std::make_unique<mono_float[]>(kNumChannels * kTailPartitionSize);
+    tail_output_ = std::make_unique<mono_float[]>(kNumChannels * kTailPartitionSize);
+    tail_overlap_ = std::make_unique<mono_float[]>(kNumChannels * kTailPartitionSize);
+
+    int sample_rate = getSampleRate();
+    requested_sample_rate_ = sample_rate;
+    std::unique_ptr<Kernel> kernel = createKernel(sample_rate);
+    built_sample_rate_ = sample_rate;
+    kernel_length_ = kernel->length;
+    kernel_ = kernel.release();
+    clearState();
+
+    worker_ = std::make_unique<Worker>(this);
+    worker_->startThread();
+    impulse_response_->addListener(this);
+  }
+
+  ConvolutionReverb::~ConvolutionReverb() {
+    impulse_response_->removeListener(this);
+    worker_->signalThreadShouldExit();
+    worker_->notify();
+    worker_->stopThread(-1);
+
+    std::unique_ptr<Kernel> kernel(kernel_.exchange(nullptr));
+    std::unique_ptr<Kernel> next_kernel(next_kernel_.exchange(nullptr));
+    std::unique_ptr<Kernel> retired_kernel(retired_kernel_.exchange(nullptr));
+  }
+
+  void ConvolutionReverb::process(int num_samples) {
+    VITAL_ASSERT(inputMatchesBufferSize(kAudio));
+    processWithInput(input(kAudio)->source->buffer, num_samples);
+  }
+
+  void ConvolutionReverb::processWithInput(const poly_float* audio_in, int num_samples) {
+    poly_float* audio_out = output()->buffer;
+    mono_float tick_increment = 1.0f / num_samples;
+
+    poly_float current_dry = dry_;
+    poly_float current_wet = wet_;
+    poly_float wet_in = utils::clamp(input(kWet)->at(0), 0.0f, 1.0f);
+    wet_ = futils::equalPowerFade(wet_in);
+    dry_ = futils::equalPowerFadeInverse(wet_in);
+    poly_float delta_wet = (wet_ - current_wet) * tick_increment;
+    poly_float delta_dry = (dry_ - current_dry) * tick_increment;
+
+    adoptPendingKernel();
+    Kernel* kernel = kernel_.load(std::memory_order_relaxed);
+
+    int num_direct = std::min(kernel->length, kHeadPartitionSize);
+    const poly_float* direct = kernel->direct.get();
+    for (int i = 0; i < num_samples; ++i) {
+      poly_float input = audio_in[i] & constants::kFirstMask;
+      history_[history_position_] = input;
+      history_[history_position_ + kHeadPartitionSize] = input;
+
+      const poly_float* history = history_.get() + history_position_ + kHeadPartitionSize;
+      poly_float convolved = 0.0f;
+      for (int t = 0; t < num_direct; ++t)
+        convolved += direct[t] * history[-t];
+
+      head_input_[head_position_] = input[0];
+      head_input_[kHeadPartitionSize + head_position_] = input[1];
+      tail_input_[tail_position_] = input[0];
+      tail_input_[kTailPartitionSize + tail_position_] = input[1];
+
+      poly_float partitioned(head_output_[head_position_] + tail_output_[tail_position_],
+                             head_output_[kHeadPartitionSize + head_position_] +
+                             tail_output_[kTailPartitionSize + tail_position_], 0.0f, 0.0f);
+      convolved += partitioned;
+
+      current_dry += delta_dry;
+      current_wet += delta_wet;
+      audio_out[i] = current_dry * audio_in[i] + current_wet * convolved;
+
+      history_position_ = (history_position_ + 1) % kHeadPartitionSize;
+      if (++head_position_ == kHeadPartitionSize)
+        processHeadBlock(kernel);
+
+      if (++tail_position_ == kTailPartitionSize)
+        processTailBlock(kernel);
+    }
+  }
+
+  void ConvolutionReverb::processHeadBlock(Kernel* kernel) {
+    head_position_ = 0;
+    int num_partitions = kernel->num_head_partitions;
+    if (num_partitions == 0)
+      return;
+
+    int slot = kernel->head_history_index;
+    mono_float* buffer = head_buffer_.get();
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      memcpy(buffer, head_input_.get() + channel * kHeadPartitionSize, kHeadPartitionSize * sizeof(mono_float));
+      std::fill(buffer + kHeadPartitionSize, buffer + 2 * kHeadFftSize, 0.0f);
+      head_transform_->transformRealForward(buffer);
+      toSplitSpectrum(kernel->headSpectrum(kernel->head_history.get(), slot, channel), buffer, kHeadContainers);
+    }
+
+    poly_float* accumulator = head_accumulator_.get();
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      for (int i = 0; i < 2 * kHeadContainers; ++i)
+        accumulator[i] = 0.0f;
+
+      for (int p = 0; p < num_partitions; ++p) {
+        int history_slot = (slot - p + num_partitions) % num_partitions;
+        multiplyAdd(accumulator, kernel->headSpectrum(kernel->head_history.get(), history_slot, channel),
+                    kernel->headSpectrum(kernel->head_spectra.get(), p, channel), kHeadContainers);
+      }
+
+      fromSplitSpectrum(buffer, accumulator, kHeadContainers);
+      head_transform_->transformRealInverse(buffer);
+
+      mono_float* output = head_output_.get() + channel * kHeadPartitionSize;
+      mono_float* overlap = head_overlap_.get() + channel * kHeadPartitionSize;
+      for (int i = 0; i < kHeadPartitionSize; ++i) {
+        output[i] = overlap[i] + buffer[i];
+        overlap[i] = buffer[kHeadPartitionSize + i];
+      }
+    }
+
+    kernel->head_history_index = (slot + 1) % num_partitions;
+  }
+
+  void ConvolutionReverb::processTailBlock(Kernel* kernel) {
+    tail_position_ = 0;
+    if (kernel->num_tail_partitions) {
+      finishTailJob(kernel);
+      writeTailHistory(kernel);
+      postTailJob(kernel);
+    }
+    tail_block_++;
+  }
+
+  void ConvolutionReverb::finishTailJob(Kernel* kernel) {
+    int total = kNumChannels * kTailPartitionSize;
+    uint64_t job = tail_job_;
+    tail_job_ = kNoTailJob;
+    if (job == kNoTailJob) {
+      memcpy(tail_output_.get(), tail_overlap_.get(), total * sizeof(mono_float));
+      std::fill(tail_overlap_.get(), tail_overlap_.get() + total, 0.0f);
+      return;
+    }
+
+    const mono_float* result = worker_scratch_->result.get();
+    uint64_t pending = job;
+    if (posted_tail_job_.compare_exchange_strong(pending, kNoTailJob) || completed_tail_job_.load() != job) {
+      // The worker hasn't finished this block in time. Compute it here rather than wait for it, a late worker
+      // result is ignored.
+      computeTailJob(kernel, job, audio_scratch_.get());
+      result = audio_scratch_->result.get();
+    }
+
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      const mono_float* channel_result = result + channel * 2 * kTailPartitionSize;
+      mono_float* output = tail_output_.get() + channel * kTailPartitionSize;
+      mono_float* overlap = tail_overlap_.get() + channel * kTailPartitionSize;
+      for (int i = 0; i < kTailPartitionSize; ++i) {
+        output[i] = overlap[i] + channel_result[i];
+        overlap[i] = channel_result[kTailPartitionSize + i];
+      }
+    }
+  }
+
+  void ConvolutionReverb::writeTailHistory(Kernel* kernel) {
+    int slot = kernel->tailHistorySlot(tail_block_);
+    mono_float* buffer = audio_scratch_->buffer.get();
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      memcpy(buffer, tail_input_.get() + channel * kTailPartitionSize, kTailPartitionSize * sizeof(mono_float));
+      std::fill(buffer + kTailPartitionSize, buffer + 2 * kTailFftSize, 0.0f);
+      audio_scratch_->transform->transformRealForward(buffer);
+      toSplitSpectrum(kernel->tailSpectrum(kernel->tail_history.get(), slot, channel), buffer, kTailContainers);
+    }
+  }
+
+  void ConvolutionReverb::postTailJob(Kernel* kernel) {
+    int num_partitions = std::min(kernel->num_tail_partitions, tail_block_ - reset_block_ + 1);
+    tail_job_ = encodeTailJob(kernel->id, num_partitions, tail_block_);
+    posted_tail_job_.store(tail_job_);
+    worker_->notify();
+  }
+
+  void ConvolutionReverb::computeTailJob(Kernel* kernel, uint64_t job, TailScratch* scratch) {
+    int block = tailJobBlock(job);
+    int num_partitions = tailJobPartitions(job);
+    mono_float* buffer = scratch->buffer.get();
+    poly_float* accumulator = scratch->accumulator.get();
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      for (int i = 0; i < 2 * kTailContainers; ++i)
+        accumulator[i] = 0.0f;
+
+      for (int p = 0; p < num_partitions; ++p) {
+        int history_slot = kernel->tailHistorySlot(block - p);
+        multiplyAdd(accumulator, kernel->tailSpectrum(kernel->tail_history.get(), history_slot, channel),
+                    kernel->tailSpectrum(kernel->tail_spectra.get(), p, channel), kTailContainers);
+      }
+
+      fromSplitSpectrum(buffer, accumulator, kTailContainers);
+      scratch->transform->transformRealInverse(buffer);
+      memcpy(scratch->result.get() + channel * 2 * kTailPartitionSize, buffer,
+             2 * kTailPartitionSize * sizeof(mono_float));
+    }
+  }
+
+  void ConvolutionReverb::runWorker() {
+    freeRetiredKernel();
+    if (requested_sample_rate_.load() != built_sample_rate_.load())
+      buildKernel();
+    runWorkerJob();
+  }
+
+  void ConvolutionReverb::runWorkerJob() {
+    uint64_t job = posted_tail_job_.exchange(kNoTailJob);
+    if (job == kNoTailJob)
+      return;
+
+    // The audio thread may have moved on to a new kernel since posting, that job is no longer wanted.
+    // Kernels are only freed by this thread so this one stays valid while we use it.
+    Kernel* kernel = kernel_.load();
+    if (kernel == nullptr || kernel->id != tailJobKernelId(job))
+      return;
+
+    computeTailJob(kernel, job, worker_scratch_.get());
+    completed_tail_job_.store(job);
+  }
+
+  void ConvolutionReverb::setSampleRate(int sample_rate) {
+    Processor::setSampleRate(sample_rate);
+    requestSampleRate(getSampleRate());
+  }
+
+  void ConvolutionReverb::setOversampleAmount(int oversample_amount) {
+    Processor::setOversampleAmount(oversample_amount);
+    requestSampleRate(getSampleRate());
+  }
+
+  void ConvolutionReverb::requestSampleRate(int sample_rate) {
+    requested_sample_rate_.store(sample_rate);
+    if (built_sample_rate_.load() != sample_rate)
+      worker_->notify();
+  }
+
+  void ConvolutionReverb::hardReset() {
+    clearState();
+  }
+
+  void ConvolutionReverb::impulseResponseChanged(ImpulseResponse* impulse_response) {
+    buildKernel();
+  }
+
+  void ConvolutionReverb::buildKernel() {
+    std::lock_guard<std::mutex> lock(build_mutex_);
+    int sample_rate = requested_sample_rate_.load();
+    std::unique_ptr<Kernel> kernel = createKernel(sample_rate);
+    built_sample_rate_.store(sample_rate);
+    kernel_length_.store(kernel->length);
+
+    // A previous kernel the audio thread never picked up can be freed right away.
+    std::unique_ptr<Kernel> unused(next_kernel_.exchange(kernel.release()));
+  }
+
+  void ConvolutionReverb::adoptPendingKernel() {
+    if (next_kernel_.load() == nullptr || retired_kernel_.load() != nullptr)
+      return;
+
+    Kernel* next_kernel = next_kernel_.exchange(nullptr);
+    if (next_kernel == nullptr)
+      return;
+
+    retired_kernel_.store(kernel_.exchange(next_kernel));
+    clearState();
+    worker_->notify();
+  }
+
+  void ConvolutionReverb::freeRetiredKernel() {
+    std::unique_ptr<Kernel> retired_kernel(retired_kernel_.exchange(nullptr));
+  }
+
+  void ConvolutionReverb::clearState() {
+    for (int i = 0; i < 2 * kHeadPartitionSize; ++i)
+      history_[i] = 0.0f;
+
+    std::fill(head_input_.get(), head_input_.get() + kNumChannels * kHeadPartitionSize, 0.0f);
+    std::fill(head_output_.get(), head_output_.get() + kNumChannels * kHeadPartitionSize, 0.0f);
+    std::fill(head_overlap_.get(), head_overlap_.get() + kNumChannels * kHeadPartitionSize, 0.0f);
+    std::fill(tail_input_.get(), tail_input_.get() + kNumChannels * kTailPartitionSize, 0.0f);
+    std::fill(tail_output_.get(), tail_output_.get() + kNumChannels * kTailPartitionSize, 0.0f);
+    std::fill(tail_overlap_.get(), tail_overlap_.get() + kNumChannels * kTailPartitionSize, 0.0f);
+
+    history_position_ = 0;
+    head_position_ = 0;
+    tail_position_ = 0;
+    reset_block_ = tail_block_;
+    tail_job_ = kNoTailJob;
+    posted_tail_job_.store(kNoTailJob);
+
+    kernel_.load(std::memory_order_relaxed)->clearHead();
+  }
+
+  std::unique_ptr<ConvolutionReverb::Kernel> ConvolutionReverb::createKernel(int sample_rate) {
+    int kernel_id = next_kernel_id_;
+    next_kernel_id_ = next_kernel_id_ % kMaxKernelId + 1;
+
+    // Resample the response to the processing rate.
+    std::unique_ptr<mono_float[]> response;
+    int length = 0;
+    {
+      std::lock_guard<std::mutex> lock(impulse_response_->getDataMutex());
+      int source_length = impulse_response_->length();
+      int source_rate = impulse_response_->sampleRate();
+      if (source_length <= 0 || source_rate <= 0 || sample_rate <= 0)
+        return std::make_unique<Kernel>(kernel_id, 0, 0, 0);
+
+      double ratio = sample_rate / (1.0 * source_rate);
+      length = std::min<int>(std::ceil(source_length * ratio), ImpulseResponse::kMaxLengthSeconds * sample_rate);
+      response = std::make_unique<mono_float[]>(kNumChannels * length);
+      const mono_float* sources[kNumChannels] = { impulse_response_->left(), impulse_response_->right() };
+      for (int channel = 0; channel < kNumChannels; ++channel) {
+        mono_float* dest = response.get() + channel * length;
+        for (int i = 0; i < length; ++i)
+          dest[i] = ratio == 1.0 ? sources[channel][i] : readCubic(sources[channel], source_length, i / ratio);
+      }
+    }
+
+    double energy = 0.0;
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      const mono_float* channel_response = response.get() + channel * length;
+      double channel_energy = 0.0;
+      for (int i = 0; i < length; ++i)
+        channel_energy += channel_response[i] * channel_response[i];
+      energy = std::max(energy, channel_energy);
+    }
+
+    if (energy <= 0.0)
+      return std::make_unique<Kernel>(kernel_id, 0, 0, 0);
+
+    // Normalize to unit energy so different responses come out at similar levels.
+    mono_float normalization = 1.0f / std::sqrt(energy);
+    for (int i = 0; i < kNumChannels * length; ++i)
+      response[i] *= normalization;
+
+    int head_partitions = std::min(kMaxHeadPartitions, (length - 1) / kHeadPartitionSize);
+    int tail_partitions = std::max(0, (length - kTailOffset + kTailPartitionSize - 1) / kTailPartitionSize);
+    std::unique_ptr<Kernel> kernel = std::make_unique<Kernel>(kernel_id, length, head_partitions, tail_partitions);
+
+    const mono_float* left = response.get();
+    const mono_float* right = response.get() + length;
+    for (int i = 0; i < kHeadPartitionSize; ++i) {
+      if (i < length)
+        kernel->direct[i] = poly_float(left[i], right[i], 0.0f, 0.0f);
+      else
+        kernel->direct[i] = 0.0f;
+    }
+
+    // Separate transforms so building a response never touches the ones in use by the audio and worker threads.
+    FourierTransform head_transform(kHeadFftBits);
+    FourierTransform tail_transform(kTailFftBits);
+    std::unique_ptr<mono_float[]> buffer = std::make_unique<mono_float[]>(2 * kTailFftSize);
+    for (int channel = 0; channel < kNumChannels; ++channel) {
+      const mono_float* channel_response = response.get() + channel * length;
+
+      for (int p = 0; p < head_partitions; ++p) {
+        int start = (p + 1) * kHeadPartitionSize;
+        int size = std::min(kHeadPartitionSize, length - start);
+        std::fill(buffer.get(), buffer.get() + 2 * kHeadFftSize, 0.0f);
+        for (int i = 0; i < size; ++i)
+          buffer[i] = head_scale_ * channel_response[start + i];
+        head_transform.transformRealForward(buffer.get());
+        toSplitSpectrum(kernel->headSpectrum(kernel->head_spectra.get(), p, channel), buffer.get(), kHeadContainers);
+      }
+
+      for (int p = 0; p < tail_partitions; ++p) {
+        int start = kTailOffset + p * kTailPartitionSize;
+        int size = std::min(kTailPartitionSize, length - start);
+        std::fill(buffer.get(), buffer.get() + 2 * kTailFftSize, 0.0f);
+        for (int i = 0; i < size; ++i)
+          buffer[i] = tail_scale_ * channel_response[start + i];
+        tail_transform.transformRealForward(buffer.get());
+        toSplitSpectrum(kernel->tailSpectrum(kernel->tail_spectra.get(), p, channel), buffer.get(), kTailContainers);
+      }
+    }
+
+    return kernel;
+  }
+} // namespace vital
@@ -0,0 +1,330 @@
+#pragma once
+
+/**
+ * @file convolution_reverb.h
+ * @brief Declares the ImpulseResponse container and the ConvolutionReverb processor, a zero latency
+ *        partitioned FFT convolution engine.
+ */
+
+#include "processor.h"
+#include "json/json.h"
+
+#include <atomic>
+#include <mutex>
+
+using json = nlohmann::json;
+
+namespace vital {
+
+  class FourierTransform;
+
+  /**
+   * @class ImpulseResponse
+   * @brief Holds the raw impulse response used by the ConvolutionReverb.
+   *
+   * The data is kept at its original sample rate so it can be resampled whenever the engine sample rate
+   * changes. Loading and serialization mirror the Sample class so impulse responses are stored in presets
+   * the same way samples are.
+   */
+  class ImpulseResponse {
+    public:
+      /// Length in seconds of the generated default impulse response.
+      static constexpr float kDefaultLengthSeconds = 2.0f;
+      /// Decay time (T60) in seconds of the generated default impulse response.
+      static constexpr float kDefaultDecaySeconds = 1.6f;
+      /// Longest impulse response we keep, in seconds at the source sample rate.
+      static constexpr int kMaxLengthSeconds = 12;
+
+      /**
+       * @class Listener
+       * @brief Interface for objects that need to know when new impulse response data is loaded.
+       */
+      class Listener {
+        public:
+          virtual ~Listener() { }
+
+          /**
+           * @brief Called after new data is loaded, on the thread that loaded it.
+           * @param impulse_response The impulse response that changed.
+           */
+          virtual void impulseResponseChanged(ImpulseResponse* impulse_response) = 0;
+      };
+
+      /**
+       * @brief Default constructor. Initializes with a generated decaying noise response.
+       */
+      ImpulseResponse();
+
+      /**
+       * @brief Generates the default impulse response (decorrelated decaying noise).
+       */
+      void init();
+
+      /**
+       * @brief Loads a mono impulse response from raw float data.
+       * @param buffer      Pointer to the float array containing the response.
+       * @param size        Number of frames in the buffer.
+       * @param sample_rate The sample rate of the data.
+       */
+      void loadSample(const mono_float* buffer, int size, int sample_rate);
+
+      /**
+       * @brief Loads a stereo impulse response from two float arrays (left/right).
+       * @param left_buffer  Pointer to float array for the left channel.
+       * @param right_buffer Pointer to float array for the right channel.
+       * @param size         Number of frames in each buffer.
+       * @param sample_rate  The sample rate of the data.
+       */
+      void loadSample(const mono_float* left_buffer, const mono_float* right_buffer, int size, int sample_rate);
+
+      /// Sets the user-facing name of the impulse response.
+      void setName(const std::string& name) { name_ = name; }
+      /// Returns the user-facing name of the impulse response.
+      std::string getName() const { return name_; }
+
+      /// Sets the last browsed file path (if applicable).
+      void setLastBrowsedFile(const std::string& path) { last_browsed_file_ = path; }
+      /// Returns the last browsed file path.
+      std::string getLastBrowsedFile() const { return last_browsed_file_; }
+
+      /// Returns the length of the loaded response in frames.
+      int length() const { return length_; }
+      /// Returns the sample rate of the loaded response.
+      int sampleRate() const { return sample_rate_; }
+      /// Returns true if the loaded response has a distinct right channel.
+      bool stereo() const { return stereo_; }
+      /// Returns true if the response is still the generated default.
+      bool isDefault() const { return default_; }
+
+      /// Returns the left channel data.
+      const mono_float* left() const { return left_.get(); }
+      /// Returns the right channel data (same as left for mono responses).
+      const mono_float* right() const { return stereo_ ? right_.get() : left_.get(); }
+
+      /**
+       * @brief Exchanges the loaded response with another one and tells this response's listeners.
+       *
+       * Lets a response be decoded off to the side and switched in later. Listeners stay with their own object.
+       *
+       * @param other The response to exchange data with.
+       */
+      void swapData(ImpulseResponse& other);
+
+      /// Returns the lock held while the data is replaced. Hold it while reading the data from another thread.
+      std::mutex& getDataMutex() { return data_mutex_; }
+
+      /// Registers a listener to be told about newly loaded data.
+      void addListener(Listener* listener) { listeners_.push_back(listener); }
+      /// Removes a previously registered listener.
+      void removeListener(Listener* listener);
+
+      /**
+       * @brief Serializes the response into JSON, using the same layout as Sample::stateToJson().
+       *
+       * The encoded audio is kept until new data is loaded.
+       *
+       * @return A JSON object with base64 encoded 16-bit PCM data.
+       */
+      json stateToJson();
+
+      /**
+       * @brief Loads the response from JSON produced by stateToJson().
+       * @param data The JSON object to read.
+       */
+      void jsonToState(json data);
+
+      /// Drops the encoded audio so the next stateToJson() encodes it again.
+      void clearStateCache();
+
+    private:
+      void notifyListeners();
+
+      std::string name_;
+      std::string last_browsed_file_;
+      int length_;
+      int sample_rate_;
+      bool stereo_;
+      bool default_;
+      std::unique_ptr<mono_float[]> left_;
+      std::unique_ptr<mono_float[]> right_;
+      std::string encoded_left_;
+      std::string encoded_right_;
+      std::vector<Listener*> listeners_;
+      std::mutex data_mutex_;
+
+      JUCE_LEAK_DETECTOR(ImpulseResponse)
+  };
+
+  /**
+   * @class ConvolutionReverb
+   * @brief A Processor that convolves stereo audio with an ImpulseResponse.
+   *
+   * The impulse response is split into three sections so long responses run with no added latency:
+   *  - The first kHeadPartitionSize taps are applied directly in the time domain.
+   *  - Taps up to kTailOffset use uniformly partitioned FFT convolution with kHeadPartitionSize blocks.
+   *  - The rest uses kTailPartitionSize blocks which are computed on a background thread. Each tail block
+   *    has a full block of time to finish before it's needed. If the worker hasn't finished it by then the
+   *    audio thread computes it itself instead of waiting.
+   *
+   * The partitioned response is never built on the audio thread. New impulse responses are built on the thread
+   * that loads them and sample rate changes are built on the worker. The finished response is published with an
+   * atomic swap, and the audio thread keeps using the previous one until then.
+   */
+  class ConvolutionReverb : public Processor, public ImpulseResponse::Listener {
+    public:
+      /// Bits of the head partition size.
+      static constexpr int kHeadPartitionBits = 7;
+      /// Size of the direct section and of each head partition.
+      static constexpr int kHeadPartitionSize = 1 << kHeadPartitionBits;
+      /// Bits of the tail partition size.
+      static constexpr int kTailPartitionBits = 11;
+      /// Size of each tail partition.
+      static constexpr int kTailPartitionSize = 1 << kTailPartitionBits;
+      /// First tap handled by the tail partitions.
+      static constexpr int kTailOffset = 2 * kTailPartitionSize;
+      /// Number of head partitions needed to cover the taps between the direct section and the tail.
+      static constexpr int kMaxHeadPartitions = kTailOffset / kHeadPartitionSize - 1;
+      /// Number of convolved channels.
+      static constexpr int kNumChannels = 2;
+
+      /**
+       * @enum InputIndices
+       * @brief Indices for the ConvolutionReverb inputs.
+       */
+      enum {
+        kAudio, ///< Audio input buffer
+        kWet,   ///< Dry/wet mix
+        kNumInputs
+      };
+
+      /**
+       * @brief Constructs a ConvolutionReverb using the given impulse response.
+       * @param impulse_response The impulse response to convolve with. A new default one is created if null.
+       */
+      ConvolutionReverb(std::shared_ptr<ImpulseResponse> impulse_response = nullptr);
+
+      /**
+       * @brief Destructor. Stops the worker thread.
+       */
+      virtual ~ConvolutionReverb();
+
+      /**
+       * @brief Cloning is not supported for ConvolutionReverb.
+       * @return Always returns nullptr.
+       */
+      virtual Processor* clone() const override { VITAL_ASSERT(false); return nullptr; }
+
+      /**
+       * @brief Processes audio by pulling from the kAudio input buffer.
+       * @param num_samples Number of samples to process.
+       */
+      void process(int num_samples) override;
+
+      /**
+       * @brief Convolves the given input buffer and mixes it with the dry signal.
+       * @param audio_in    Pointer to the input buffer.
+       * @param num_samples Number of samples to process.
+       */
+      void processWithInput(const poly_float* audio_in, int num_samples) override;
+
+      /**
+       * @brief Asks the worker to rebuild the partitioned response for the new sample rate.
+       * @param sample_rate New sample rate in Hz.
+       */
+      void setSampleRate(int sample_rate) override;
+
+      /**
+       * @brief Asks the worker to rebuild the partitioned response for the new oversampling amount.
+       * @param oversample_amount Oversampling factor.
+       */
+      void setOversampleAmount(int oversample_amount) override;
+
+      /**
+       * @brief Clears all convolution history.
+       */
+      void hardReset() override;
+
+      /**
+       * @brief Builds and publishes the partitioned response on the loading thread when new data is loaded.
+       * @param impulse_response The impulse response that changed.
+       */
+      void impulseResponseChanged(ImpulseResponse* impulse_response) override;
+
+      /// Returns the impulse response this reverb convolves with.
+      ImpulseResponse* getImpulseResponse() { return impulse_response_.get(); }
+
+      /// Returns the length in samples of the most recently built response.
+      int getKernelLength() const { return kernel_length_.load(); }
+
+      /// Returns the sample rate the most recently built response was built for.
+      int getKernelSampleRate() const { return built_sample_rate_.load(); }
+
+    private:
+      class Worker;
+      struct Kernel;
+      struct TailScratch;
+
+      std::unique_ptr<Kernel> createKernel(int sample_rate);
+      void buildKernel();
+      void requestSampleRate(int sample_rate);
+      void adoptPendingKernel();
+      void freeRetiredKernel();
+      void clearState();
+      void processHeadBlock(Kernel* kernel);
+      void processTailBlock(Kernel* kernel);
+      void finishTailJob(Kernel* kernel);
+      void writeTailHistory(Kernel* kernel);
+      void postTailJob(Kernel* kernel);
+      void computeTailJob(Kernel* kernel, uint64_t job, TailScratch* scratch);
+      void runWorker();
+      void runWorkerJob();
+
+      std::shared_ptr<ImpulseResponse> impulse_response_;
+      std::unique_ptr<FourierTransform> head_transform_;
+      std::unique_ptr<TailScratch> audio_scratch_;
+      std::unique_ptr<TailScratch> worker_scratch_;
+      std::unique_ptr<Worker> worker_;
+
+      // Kernel ownership moves between threads through these. The loader or worker publishes into next_kernel_,
+      // the audio thread moves it to kernel_ and hands the old one to retired_kernel_, and the worker frees it.
+      std::atomic<Kernel*> kernel_;
+      std::atomic<Kernel*> next_kernel_;
+      std::atomic<Kernel*> retired_kernel_;
+
+      std::mutex build_mutex_;
+      int next_kernel_id_;
+      std::atomic<int> requested_sample_rate_;
+      std::atomic<int> built_sample_rate_;
+      std::atomic<int> kernel_length_;
+
+      // The tail job the worker may pick up and the last one it finished, see encodeTailJob().
+      std::atomic<uint64_t> posted_tail_job_;
+      std::atomic<uint64_t> completed_tail_job_;
+
+      mono_float head_scale_;
+      mono_float tail_scale_;
+
+      poly_float dry_;
+      poly_float wet_;
+
+      std::unique_ptr<poly_float[]> history_;
+      int history_position_;
+
+      std::unique_ptr<mono_float[]> head_input_;
+      std::unique_ptr<mono_float[]> head_output_;
+      std::unique_ptr<mono_float[]> head_overlap_;
+      std::unique_ptr<mono_float[]> head_buffer_;
+      std::unique_ptr<poly_float[]> head_accumulator_;
+      int head_position_;
+
+      std::unique_ptr<mono_float[]> tail_input_;
+      std::unique_ptr<mono_float[]> tail_output_;
+      std::unique_ptr<mono_float[]> tail_overlap_;
+      int tail_position_;
+      int tail_block_;
+      int reset_block_;
+      uint64_t tail_job_;
+
+      JUCE_LEAK_DETECTOR(ConvolutionReverb)
+  };
+} // namespace vital
@@ -60,6 +60,67 @@ namespace vital {
       return utils::clamp(value * drive, -1.0f, 1.0f);
     }
 
+    /**
+     * @brief Antiderivative of softClip() at unity drive, without its |value| term.
+     *
+     * log(cosh(x)) is |x| + log(1 + e^(-2|x|)) - log(2). The first term is left to the caller so the rest stays
+     * small for large inputs.
+     *
+     * @param value Driven input sample.
+     * @return The bounded part of the antiderivative.
+     */
+    force_inline poly_float softClipIntegral(poly_float value) {
+      static constexpr mono_float kMaxExponent = 16.0f;
+      static constexpr mono_float kLog2 = 0.69314718056f;
+
+      poly_float exponent = utils::min(poly_float::abs(value), kMaxExponent) * -2.0f;
+      return futils::log(futils::exp(exponent) + 1.0f) - kLog2;
+    }
+
+    /**
+     * @brief Antiderivative of hardClip() at unity drive, without its |value| term.
+     *
+     * Inside [-1, 1] the antiderivative is x^2 / 2 and outside it's |x| - 1/2.
+     *
+     * @param value Driven input sample.
+     * @return The bounded part of the antiderivative.
+     */
+    force_inline poly_float hardClipIntegral(poly_float value) {
+      poly_float clamped = utils::clamp(value, -1.0f, 1.0f);
+      return clamped * clamped * 0.5f - poly_float::abs(clamped);
+    }
+
+    /**
+     * @brief Antiderivative of linearFold() at unity drive.
+     *
+     * The fold is a triangle wave with a period of 4 and no offset so its antiderivative is a periodic chain of
+     * parabolas.
+     *
+     * @param value Driven input sample.
+     * @return The antiderivative.
+     */
+    force_inline poly_float linearFoldIntegral(poly_float value) {
+      poly_float range = utils::mod(value * 0.25f + 0.75f);
+      poly_float rising = range - range * range * 2.0f;
+      poly_float falling = (range * 2.0f - 3.0f) * range + 1.0f;
+      return utils::maskLoad(rising, falling, poly_float::greaterThan(range, 0.5f)) * 4.0f;
+    }
+
+    /**
+     * @brief Antiderivative of sinFold() at unity drive.
+     *
+     * The fold is sin(pi x / 2) so its antiderivative is -2 / pi cos(pi x / 2).
+     *
+     * @param value Driven input sample.
+     * @return The antiderivative.
+     */
+    force_inline poly_float sinFoldIntegral(poly_float value) {
+      static constexpr mono_float kScale = -2.0f / kPi;
+
+      poly_float range = utils::mod(value * 0.25f + 0.25f);
+      return futils::sin1(range) * kScale;
+    }
+
     /**
      * @brief Applies a basic bitcrushing distortion.
      *
@@ -158,7 +219,8 @@ namespace vital {
    * (used in downsampling).
    */
   Distortion::Distortion() : Processor(kNumInputs, kNumOutputs),
-                             last_distorted_value_(0.0f), current_samples_(0.0f), type_(kNumTypes) { }
+                             last_distorted_value_(0.0f), current_samples_(0.0f), last_anti_alias_value_(0.0f),
+                             type_(kNumTypes), anti_alias_(false) { }
 
   /**
    * @brief Templated processing function for time-invariant distortions.
@@ -185,6 +247,39 @@ namespace vital {
     }
   }
 
+  template<poly_float(*distort)(poly_float, poly_float), poly_float(*integral)(poly_float), bool absolute>
+  void Distortion::processAntiAliased(int num_samples, const poly_float* audio_in, const poly_float* drive,
+                                      poly_float* audio_out) {
+    poly_float last_value = last_anti_alias_value_;
+    poly_float last_integral = integral(last_value);
+
+    for (int i = 0; i < num_samples; ++i) {
+      poly_float value = audio_in[i] * driveDbScale(drive[i]);
+      poly_float value_integral = integral(value);
+
+      // Two samples are compacted into each frame, so the sample before the lower one is the last frame's upper
+      // one and the sample before the upper one is this frame's lower one.
+      poly_float previous = utils::compactFirstVoices(utils::swapVoices(last_value), value);
+      poly_float previous_integral = utils::compactFirstVoices(utils::swapVoices(last_integral), value_integral);
+
+      poly_float delta = value - previous;
+      poly_float integral_delta = value_integral - previous_integral;
+      if (absolute)
+        integral_delta += poly_float::abs(value) - poly_float::abs(previous);
+
+      poly_mask close = poly_float::lessThan(poly_float::abs(delta), kMinAntiAliasDelta);
+      poly_float average = integral_delta / utils::maskLoad(delta, 1.0f, close);
+      poly_float midpoint = distort((value + previous) * 0.5f, 1.0f);
+      audio_out[i] = utils::maskLoad(average, midpoint, close);
+      VITAL_ASSERT(utils::isContained(audio_out[i]));
+
+      last_value = value;
+      last_integral = value_integral;
+    }
+
+    last_anti_alias_value_ = last_value;
+  }
+
   void Distortion::processDownSample(int num_samples, const poly_float* audio_in, const poly_float* drive,
                                      poly_float* audio_out) {
     mono_float sample_rate = getSampleRate();
@@ -217,10 +312,37 @@ namespace vital {
     int compact_samples = compactAudio(audio_out, audio_in, num_samples);
     compactAudio(drive_out, input(kDrive)->source->buffer, num_samples);
 
-    if (type != type_) {
+    bool anti_alias = input(kAntiAlias)->at(0)[0];
+    if (type != type_ || anti_alias != anti_alias_) {
       type_ = type;
+      anti_alias_ = anti_alias;
       last_distorted_value_ = 0.0f;
       current_samples_ = 0.0f;
+      last_anti_alias_value_ = 0.0f;
+    }
+
+    if (anti_alias && type <= kSinFold) {
+      switch(type) {
+        case kSoftClip:
+          processAntiAliased<softClip, softClipIntegral, true>(compact_samples, audio_out, drive_out, audio_out);
+          break;
+        case kHardClip:
+          processAntiAliased<hardClip, hardClipIntegral, true>(compact_samples, audio_out, drive_out, audio_out);
+          break;
+        case kLinearFold:
+          processAntiAliased<linearFold, linearFoldIntegral, false>(compact_samples, audio_out, drive_out, audio_out);
+          break;
+        case kSinFold:
+          processAntiAliased<sinFold, sinFoldIntegral, false>(compact_samples, audio_out, drive_out, audio_out);
+          break;
+      }
+
+      // An odd block ends on a lone sample in the lower voice, which is the one the next block continues from.
+      if (num_samples % 2)
+        last_anti_alias_value_ = utils::swapVoices(last_anti_alias_value_);
+
+      expandAudio(audio_out, audio_out, num_samples);
+      return;
     }
 
     switch(type) {
@@ -35,6 +35,13 @@ namespace vital {
        */
       static constexpr mono_float kMinDistortionMult = 32.0f / INT_MAX;
 
+      /**
+       * @brief Smallest change in driven input the anti-aliased shapers divide by.
+       *
+       * Closer samples use the shaper at their midpoint instead, which is the limit of the difference quotient.
+       */
+      static constexpr mono_float kMinAntiAliasDelta = 0.01f;
+
       /**
        * @enum InputIndices
        * @brief Enumerates the Distortion Processor input indices.
@@ -43,6 +50,7 @@ namespace vital {
         kAudio, ///< Audio input buffer
         kType,  ///< Distortion type (see Type enum)
         kDrive, ///< Drive amount in dB
+        kAntiAlias, ///< Whether to use the antiderivative anti-aliased shapers
         kNumInputs
       };
 
@@ -185,6 +193,27 @@ namespace vital {
       void processTimeInvariant(int num_samples, const poly_float* audio_in, const poly_float* drive,
                                 poly_float* audio_out);
 
+      /**
+       * @brief Processes samples with first order antiderivative anti-aliasing.
+       *
+       * Each output is the average of the shaper between the previous and current driven input, which is the
+       * difference of the shaper's antiderivative divided by the difference of the inputs. This cuts the
+       * aliasing of the waveshapers without oversampling, at the cost of a half sample delay and a gentle high
+       * frequency roll off. Samples closer than kMinAntiAliasDelta use the shaper at their midpoint.
+       *
+       * @tparam distort  The function pointer for the distortion method.
+       * @tparam integral The function pointer for the antiderivative of @p distort at unity drive.
+       * @tparam absolute True if @p integral leaves out an |x| term, which is then added separately so large
+       *                  inputs don't lose precision.
+       * @param num_samples Number of samples to process.
+       * @param audio_in    Pointer to the compacted input buffer.
+       * @param drive       Pointer to the drive values in dB.
+       * @param audio_out   Pointer to the output buffer.
+       */
+      template<poly_float(*distort)(poly_float, poly_float), poly_float(*integral)(poly_float), bool absolute>
+      void processAntiAliased(int num_samples, const poly_float* audio_in, const poly_float* drive,
+                              poly_float* audio_out);
+
       /**
        * @brief Processes samples using a downsampling approach for distortion.
        *
@@ -207,11 +236,21 @@ namespace vital {
        */
       poly_float current_samples_;
 
+      /**
+       * @brief The last driven input of the anti-aliased shapers, in the upper voice of the compacted layout.
+       */
+      poly_float last_anti_alias_value_;
+
       /**
        * @brief The currently active distortion type.
        */
       int type_;
 
+      /**
+       * @brief Whether the anti-aliased shapers were used on the last block.
+       */
+      bool anti_alias_;
+
       JUCE_LEAK_DETECTOR(Distortion)
   };
 } // namespace vital
@@ -42,6 +42,7 @@ namespace vital {
    */
   void Phaser::hardReset() {
     phaser_filter_->reset(constants::kFullMask);
+    phase_ = 0;
     mod_depth_ = input(kModDepth)->at(0);
     phase_offset_ = input(kPhaseOffset)->at(0);
   }
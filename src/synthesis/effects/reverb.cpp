@@ -483,6 +483,11 @@ namespace vital {
   void Reverb::hardReset() {
     wet_ = 0.0f;
     dry_ = 0.0f;
+    chorus_phase_ = 0.0f;
+    write_index_ = 0;
+    sample_delay_ = kMinDelay;
+    sample_delay_increment_ = 0.0f;
+    memory_->clearAll();
     low_pre_filter_.reset(constants::kFullMask);
     high_pre_filter_.reset(constants::kFullMask);
     chorus_amount_ = utils::clamp(input(kChorusAmount)->at(0)[0], 0.0f, 1.0f) * kMaxChorusDrift;
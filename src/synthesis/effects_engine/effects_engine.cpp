@@ -1,5 +1,6 @@
-#include "sound_engine.h"
+#include "effects_engine.h"
 
+#include "chorus_module.h"
 #include "compressor_module.h"
 #include "flanger_module.h"
 #include "phaser_module.h"
@@ -10,14 +11,15 @@
 #include "peak_meter.h"
 #include "operators.h"
 #include "reorderable_effect_chain.h"
+#include "upsampler.h"
 #include "value_switch.h"
 
 namespace vital {
 
   /**
-   * @brief Default constructor for SoundEngine, initializes vital controls and reserves space for mod processors.
+   * @brief Default constructor for EffectsEngine, initializes vital controls and reserves space for mod processors.
    */
-  SoundEngine::SoundEngine()
+  EffectsEngine::EffectsEngine()
     : SynthModule(0, 1),
       modulation_handler_(nullptr),
       last_oversampling_amount_(-1),
@@ -27,19 +29,20 @@ namespace vital {
     init();
     bps_ = data_->controls["beats_per_minute"];
     modulation_processors_.reserve(kMaxModulationConnections);
+    reserveModulationRouting();
   }
 
   /**
    * @brief Destructor. Prepares the modulation handler for deletion by removing processors.
    */
-  SoundEngine::~SoundEngine() {
+  EffectsEngine::~EffectsEngine() {
     modulation_handler_->prepareDestroy();
   }
 
   /**
    * @brief Initializes base controls, sets up the EffectsModulationHandler, effect chain, decimator, stereo handling, etc.
    */
-  void SoundEngine::init() {
+  void EffectsEngine::init() {
     createBaseControl("bypass");
     oversampling_ = createBaseControl("oversampling");
     legato_ = createBaseControl("legato");
@@ -67,13 +70,12 @@ namespace vital {
     addProcessor(modulation_handler_);
 
     // Pitch wheel / mod wheel controls
-    Value* pitch_wheel = createBaseControl("pitch_wheel");
-    modulation_handler_->setPitchWheelControl(pitch_wheel);
-    Value* mod_wheel = createBaseControl("mod_wheel");
-    modulation_handler_->setModWheelControl(mod_wheel);
+    createBaseControl("pitch_wheel");
+    createBaseControl("mod_wheel");
 
-    // Upsampler for oversampling
+    // Upsampler for oversampling. The input is recorded audio, so it's interpolated instead of repeated.
     upsampler_ = new Upsampler();
+    upsampler_->setInterpolate(true);
     addIdleProcessor(upsampler_);
 
     // Create the ReorderableEffectChain
@@ -135,7 +137,7 @@ namespace vital {
     addProcessor(scaled_audio);
     addProcessor(clamp);
 
-    // Use clamp’s output for the SoundEngine final output
+    // Use clamp’s output for the EffectsEngine final output
     clamp->useOutput(output());
 
     // Finalize initialization
@@ -149,7 +151,7 @@ namespace vital {
    *
    * Sets control rate based on whether either the source or destination is audio-rate.
    */
-  void SoundEngine::connectModulation(const modulation_change& change) {
+  void EffectsEngine::connectModulation(const modulation_change& change) {
     change.modulation_processor->plug(change.source, ModulationConnectionProcessor::kModulationInput);
     change.modulation_processor->setDestinationScale(change.destination_scale);
     VITAL_ASSERT(vital::utils::isFinite(change.destination_scale));
@@ -185,14 +187,14 @@ namespace vital {
    *
    * @return The count of pressed notes.
    */
-  int SoundEngine::getNumPressedNotes() {
+  int EffectsEngine::getNumPressedNotes() {
     return modulation_handler_->getNumPressedNotes();
   }
 
   /**
    * @brief Removes a previously connected modulation, disabling the processor and resetting rate modes.
    */
-  void SoundEngine::disconnectModulation(const modulation_change& change) {
+  void EffectsEngine::disconnectModulation(const modulation_change& change) {
     Processor* destination = change.mono_destination;
     if (change.source->owner->isPolyphonic() && change.poly_destination)
       destination = change.poly_destination;
@@ -219,7 +221,7 @@ namespace vital {
    *
    * @return Active voice count.
    */
-  int SoundEngine::getNumActiveVoices() {
+  int EffectsEngine::getNumActiveVoices() {
     return modulation_handler_->getNumActiveVoices();
   }
 
@@ -228,7 +230,7 @@ namespace vital {
    *
    * @return A reference to the ModulationConnectionBank from the modulation handler.
    */
-  ModulationConnectionBank& SoundEngine::getModulationBank() {
+  ModulationConnectionBank& EffectsEngine::getModulationBank() {
     return modulation_handler_->getModulationBank();
   }
 
@@ -237,7 +239,7 @@ namespace vital {
    *
    * @return The most recently pressed note value.
    */
-  mono_float SoundEngine::getLastActiveNote() const {
+  mono_float EffectsEngine::getLastActiveNote() const {
     return modulation_handler_->getLastActiveNote();
   }
 
@@ -246,14 +248,14 @@ namespace vital {
    *
    * @param tuning Pointer to a Tuning object that maps MIDI notes to frequencies.
    */
-  void SoundEngine::setTuning(const Tuning* tuning) {
+  void EffectsEngine::setTuning(const Tuning* tuning) {
     modulation_handler_->setTuning(tuning);
   }
 
   /**
    * @brief Checks if the oversampling setting or sample rate has changed and re-applies if needed.
    */
-  void SoundEngine::checkOversampling() {
+  void EffectsEngine::checkOversampling() {
     int oversampling_amount = oversampling_->value();
     int sample_rate = getSampleRate();
     if (last_oversampling_amount_ != oversampling_amount || last_sample_rate_ != sample_rate) {
@@ -269,7 +271,7 @@ namespace vital {
    * @param oversampling_amount The integer oversampling factor.
    * @param sample_rate         The current audio sample rate in Hz.
    */
-  void SoundEngine::setOversamplingAmount(int oversampling_amount, int sample_rate) {
+  void EffectsEngine::setOversamplingAmount(int oversampling_amount, int sample_rate) {
     static constexpr int kBaseSampleRate = 44100;
     int oversample = oversampling_amount;
     int sample_rate_mult = sample_rate / kBaseSampleRate;
@@ -286,12 +288,12 @@ namespace vital {
   }
 
   /**
-   * @brief Processes audio through the entire chain of the SoundEngine.
+   * @brief Processes audio through the entire chain of the EffectsEngine.
    *
    * @param audio_in    Buffer of samples (poly_float), though many effects do not use direct audio_in.
    * @param num_samples The block size to process.
    */
-  void SoundEngine::processWithInput(const poly_float* audio_in, int num_samples) {
+  void EffectsEngine::processWithInput(const poly_float* audio_in, int num_samples) {
     VITAL_ASSERT(num_samples <= output()->buffer_size);
 
     FloatVectorOperations::disableDenormalisedNumberSupport();
@@ -311,7 +313,7 @@ namespace vital {
    *
    * @param seconds Absolute time in seconds.
    */
-  void SoundEngine::correctToTime(double seconds) {
+  void EffectsEngine::correctToTime(double seconds) {
     modulation_handler_->correctToTime(seconds);
     effect_chain_->correctToTime(seconds);
   }
@@ -319,7 +321,7 @@ namespace vital {
   /**
    * @brief Clears the effect chain states, stopping sound or lingering effects.
    */
-  void SoundEngine::allSoundsOff() {
+  void EffectsEngine::allSoundsOff() {
     effect_chain_->hardReset();
   }
 
@@ -328,7 +330,7 @@ namespace vital {
    *
    * @param sample The sample index to stop.
    */
-  void SoundEngine::allNotesOff(int sample) {
+  void EffectsEngine::allNotesOff(int sample) {
     modulation_handler_->allNotesOff(sample);
   }
 
@@ -338,7 +340,7 @@ namespace vital {
    * @param sample  The sample index.
    * @param channel The MIDI channel.
    */
-  void SoundEngine::allNotesOff(int sample, int channel) {
+  void EffectsEngine::allNotesOff(int sample, int channel) {
     modulation_handler_->allNotesOff(channel);
   }
 
@@ -349,7 +351,7 @@ namespace vital {
    * @param from_channel The first channel in the range.
    * @param to_channel   The last channel in the range (inclusive).
    */
-  void SoundEngine::allNotesOffRange(int sample, int from_channel, int to_channel) {
+  void EffectsEngine::allNotesOffRange(int sample, int from_channel, int to_channel) {
     modulation_handler_->allNotesOffRange(sample, from_channel, to_channel);
   }
 
@@ -361,7 +363,7 @@ namespace vital {
    * @param sample   Sample index for the event.
    * @param channel  MIDI channel.
    */
-  void SoundEngine::noteOn(int note, mono_float velocity, int sample, int channel) {
+  void EffectsEngine::noteOn(int note, mono_float velocity, int sample, int channel) {
     modulation_handler_->noteOn(note, velocity, sample, channel);
   }
 
@@ -373,7 +375,7 @@ namespace vital {
    * @param sample  Sample index for the event.
    * @param channel MIDI channel.
    */
-  void SoundEngine::noteOff(int note, mono_float lift, int sample, int channel) {
+  void EffectsEngine::noteOff(int note, mono_float lift, int sample, int channel) {
     modulation_handler_->noteOff(note, lift, sample, channel);
   }
 
@@ -383,7 +385,7 @@ namespace vital {
    * @param value   The mod wheel value [0..1].
    * @param channel The MIDI channel.
    */
-  void SoundEngine::setModWheel(mono_float value, int channel) {
+  void EffectsEngine::setModWheel(mono_float value, int channel) {
     modulation_handler_->setModWheel(value, channel);
   }
 
@@ -392,7 +394,7 @@ namespace vital {
    *
    * @param value The mod wheel value [0..1].
    */
-  void SoundEngine::setModWheelAllChannels(mono_float value) {
+  void EffectsEngine::setModWheelAllChannels(mono_float value) {
     modulation_handler_->setModWheelAllChannels(value);
   }
 
@@ -402,7 +404,7 @@ namespace vital {
    * @param value   The pitch bend amount in [-1..1].
    * @param channel The MIDI channel.
    */
-  void SoundEngine::setPitchWheel(mono_float value, int channel) {
+  void EffectsEngine::setPitchWheel(mono_float value, int channel) {
     modulation_handler_->setPitchWheel(value, channel);
   }
 
@@ -413,14 +415,14 @@ namespace vital {
    * @param from_channel The first channel in the range.
    * @param to_channel   The last channel in the range (inclusive).
    */
-  void SoundEngine::setZonedPitchWheel(mono_float value, int from_channel, int to_channel) {
+  void EffectsEngine::setZonedPitchWheel(mono_float value, int from_channel, int to_channel) {
     modulation_handler_->setZonedPitchWheel(value, from_channel, to_channel);
   }
 
   /**
    * @brief Disables any unnecessary mod sources in the modulation handler for CPU efficiency.
    */
-  void SoundEngine::disableUnnecessaryModSources() {
+  void EffectsEngine::disableUnnecessaryModSources() {
     modulation_handler_->disableUnnecessaryModSources();
   }
 
@@ -429,7 +431,7 @@ namespace vital {
    *
    * @param source The name of the modulation source, e.g. "lfo_1".
    */
-  void SoundEngine::enableModSource(const std::string& source) {
+  void EffectsEngine::enableModSource(const std::string& source) {
     getModulationSource(source)->owner->enable(true);
   }
 
@@ -438,7 +440,7 @@ namespace vital {
    *
    * @param source The name of the source.
    */
-  void SoundEngine::disableModSource(const std::string& source) {
+  void EffectsEngine::disableModSource(const std::string& source) {
     modulation_handler_->disableModSource(source);
   }
 
@@ -448,7 +450,7 @@ namespace vital {
    * @param source The name of the source to check.
    * @return True if enabled, false otherwise.
    */
-  bool SoundEngine::isModSourceEnabled(const std::string& source) {
+  bool EffectsEngine::isModSourceEnabled(const std::string& source) {
     return getModulationSource(source)->owner->enabled();
   }
 
@@ -457,7 +459,7 @@ namespace vital {
    *
    * @return A pointer to the StereoMemory or nullptr if not present.
    */
-  const StereoMemory* SoundEngine::getEqualizerMemory() {
+  const StereoMemory* EffectsEngine::getEqualizerMemory() {
     return effect_chain_->getEqualizerMemory();
   }
 
@@ -466,7 +468,7 @@ namespace vital {
    *
    * @param bpm The new BPM value.
    */
-  void SoundEngine::setBpm(mono_float bpm) {
+  void EffectsEngine::setBpm(mono_float bpm) {
     mono_float bps = bpm / 60.0f;
     if (bps_->value() != bps)
       bps_->set(bps);
@@ -480,7 +482,7 @@ namespace vital {
    * @param sample  Sample index.
    * @param channel MIDI channel.
    */
-  void SoundEngine::setAftertouch(mono_float note, mono_float value, int sample, int channel) {
+  void EffectsEngine::setAftertouch(mono_float note, mono_float value, int sample, int channel) {
     modulation_handler_->setAftertouch(note, value, sample, channel);
   }
 
@@ -491,7 +493,7 @@ namespace vital {
    * @param value   Aftertouch in [0..1].
    * @param sample  Sample index.
    */
-  void SoundEngine::setChannelAftertouch(int channel, mono_float value, int sample) {
+  void EffectsEngine::setChannelAftertouch(int channel, mono_float value, int sample) {
     modulation_handler_->setChannelAftertouch(channel, value, sample);
   }
 
@@ -503,7 +505,7 @@ namespace vital {
    * @param value        Aftertouch in [0..1].
    * @param sample       Sample index.
    */
-  void SoundEngine::setChannelRangeAftertouch(int from_channel, int to_channel, mono_float value, int sample) {
+  void EffectsEngine::setChannelRangeAftertouch(int from_channel, int to_channel, mono_float value, int sample) {
     modulation_handler_->setChannelRangeAftertouch(from_channel, to_channel, value, sample);
   }
 
@@ -514,7 +516,7 @@ namespace vital {
    * @param value   Slide in [0..1].
    * @param sample  Sample index.
    */
-  void SoundEngine::setChannelSlide(int channel, mono_float value, int sample) {
+  void EffectsEngine::setChannelSlide(int channel, mono_float value, int sample) {
     modulation_handler_->setChannelSlide(channel, value, sample);
   }
 
@@ -526,21 +528,21 @@ namespace vital {
    * @param value        Slide in [0..1].
    * @param sample       Sample index.
    */
-  void SoundEngine::setChannelRangeSlide(int from_channel, int to_channel, mono_float value, int sample) {
+  void EffectsEngine::setChannelRangeSlide(int from_channel, int to_channel, mono_float value, int sample) {
     modulation_handler_->setChannelRangeSlide(from_channel, to_channel, value, sample);
   }
 
   /**
    * @brief Returns nullptr since wavetable retrieval is unimplemented here.
    */
-  Wavetable* SoundEngine::getWavetable(int index) {
+  Wavetable* EffectsEngine::getWavetable(int index) {
     return nullptr;
   }
 
   /**
    * @brief Returns nullptr since sample retrieval is unimplemented here.
    */
-  Sample* SoundEngine::getSample() {
+  Sample* EffectsEngine::getSample() {
     return nullptr;
   }
 
@@ -550,7 +552,7 @@ namespace vital {
    * @param index LFO index.
    * @return Pointer to the corresponding LineGenerator.
    */
-  LineGenerator* SoundEngine::getLfoSource(int index) {
+  LineGenerator* EffectsEngine::getLfoSource(int index) {
     return modulation_handler_->getLfoSource(index);
   }
 
@@ -559,7 +561,7 @@ namespace vital {
    *
    * @param channel MIDI channel.
    */
-  void SoundEngine::sustainOn(int channel) {
+  void EffectsEngine::sustainOn(int channel) {
     modulation_handler_->sustainOn(channel);
   }
 
@@ -569,7 +571,7 @@ namespace vital {
    * @param sample  Sample index at which sustain is released.
    * @param channel MIDI channel.
    */
-  void SoundEngine::sustainOff(int sample, int channel) {
+  void EffectsEngine::sustainOff(int sample, int channel) {
     modulation_handler_->sustainOff(sample, channel);
   }
 
@@ -578,7 +580,7 @@ namespace vital {
    *
    * @param channel MIDI channel.
    */
-  void SoundEngine::sostenutoOn(int channel) {
+  void EffectsEngine::sostenutoOn(int channel) {
     modulation_handler_->sostenutoOn(channel);
   }
 
@@ -588,7 +590,7 @@ namespace vital {
    * @param sample  Sample index at which sostenuto is released.
    * @param channel MIDI channel.
    */
-  void SoundEngine::sostenutoOff(int sample, int channel) {
+  void EffectsEngine::sostenutoOff(int sample, int channel) {
     modulation_handler_->sostenutoOff(sample, channel);
   }
 
@@ -598,7 +600,7 @@ namespace vital {
    * @param from_channel First channel in the range.
    * @param to_channel   Last channel in the range (inclusive).
    */
-  void SoundEngine::sustainOnRange(int from_channel, int to_channel) {
+  void EffectsEngine::sustainOnRange(int from_channel, int to_channel) {
     modulation_handler_->sustainOnRange(from_channel, to_channel);
   }
 
@@ -609,7 +611,7 @@ namespace vital {
    * @param from_channel First channel in the range.
    * @param to_channel   Last channel in the range (inclusive).
    */
-  void SoundEngine::sustainOffRange(int sample, int from_channel, int to_channel) {
+  void EffectsEngine::sustainOffRange(int sample, int from_channel, int to_channel) {
     modulation_handler_->sustainOffRange(sample, from_channel, to_channel);
   }
 
@@ -619,7 +621,7 @@ namespace vital {
    * @param from_channel First channel in the range.
    * @param to_channel   Last channel in the range (inclusive).
    */
-  void SoundEngine::sostenutoOnRange(int from_channel, int to_channel) {
+  void EffectsEngine::sostenutoOnRange(int from_channel, int to_channel) {
     modulation_handler_->sostenutoOnRange(from_channel, to_channel);
   }
 
@@ -630,7 +632,7 @@ namespace vital {
    * @param from_channel First channel in the range.
    * @param to_channel   Last channel in the range (inclusive).
    */
-  void SoundEngine::sostenutoOffRange(int sample, int from_channel, int to_channel) {
+  void EffectsEngine::sostenutoOffRange(int sample, int from_channel, int to_channel) {
     modulation_handler_->sostenutoOffRange(sample, from_channel, to_channel);
   }
 } // namespace vital
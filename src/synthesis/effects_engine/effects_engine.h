@@ -21,15 +21,15 @@ namespace vital {
   class Wavetable;
 
   /**
-   * @class SoundEngine
+   * @class EffectsEngine
    * @brief Core class responsible for handling note events, oversampling, and the main effects chain.
    *
-   * The SoundEngine manages the top-level module architecture for Vital's effect
+   * The EffectsEngine manages the top-level module architecture for Vital's effect
    * and modulation engines, connecting note handling, oversampling, effect chaining,
    * and modulation routing. It derives from SynthModule for the base module framework
    * and NoteHandler for note-level logic.
    */
-  class SoundEngine : public SynthModule, public NoteHandler {
+  class EffectsEngine : public SynthModule, public NoteHandler {
     public:
       /**
        * @brief Default oversampling factor.
@@ -42,14 +42,14 @@ namespace vital {
       static constexpr int kDefaultSampleRate = 44100;
 
       /**
-       * @brief Constructs a SoundEngine and initializes internal state and controls.
+       * @brief Constructs an EffectsEngine and initializes internal state and controls.
        */
-      SoundEngine();
+      EffectsEngine();
 
       /**
-       * @brief Destroys the SoundEngine, cleaning up submodules and modulation resources.
+       * @brief Destroys the EffectsEngine, cleaning up submodules and modulation resources.
        */
-      virtual ~SoundEngine();
+      virtual ~EffectsEngine();
 
       /**
        * @brief Initializes the engine by creating base controls and submodules (effects chain, etc.).
@@ -57,7 +57,7 @@ namespace vital {
       void init() override;
 
       /**
-       * @brief Processes a block of samples using the current state of the SoundEngine.
+       * @brief Processes a block of samples using the current state of the EffectsEngine.
        *
        * Renders any oversampling, effect chaining, and modulation updates.
        *
@@ -450,6 +450,6 @@ namespace vital {
        */
       CircularQueue<Processor*> modulation_processors_;
 
-      JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SoundEngine)
+      JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EffectsEngine)
   };
 } // namespace vital
@@ -2,6 +2,10 @@
 #include "futils.h"
 #include "memory.h"
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 namespace vital {
 
   namespace {
@@ -150,14 +154,74 @@ namespace vital {
     }
   } // namespace
 
+  /**
+   * @class CombFilter::MemoryWorker
+   * @brief Background thread that allocates grown memory for comb filters and frees the memory it replaced.
+   *
+   * One worker is shared by every CombFilter alive. The audio thread only exchanges pointers and wakes it up.
+   */
+  class CombFilter::MemoryWorker : public Thread {
+    public:
+      static constexpr int kStopTimeoutMs = 1000;
+
+      static std::shared_ptr<MemoryWorker> getInstance() {
+        static std::mutex instance_mutex;
+        static std::weak_ptr<MemoryWorker> instance;
+
+        std::lock_guard<std::mutex> lock(instance_mutex);
+        std::shared_ptr<MemoryWorker> worker = instance.lock();
+        if (worker == nullptr) {
+          worker = std::make_shared<MemoryWorker>();
+          instance = worker;
+        }
+        return worker;
+      }
+
+      MemoryWorker() : Thread("Comb Filter Memory") {
+        startThread();
+      }
+
+      ~MemoryWorker() {
+        stopThread(kStopTimeoutMs);
+      }
+
+      void addFilter(CombFilter* filter) {
+        std::lock_guard<std::mutex> lock(filters_mutex_);
+        filters_.push_back(filter);
+      }
+
+      void removeFilter(CombFilter* filter) {
+        std::lock_guard<std::mutex> lock(filters_mutex_);
+        filters_.erase(std::remove(filters_.begin(), filters_.end(), filter), filters_.end());
+      }
+
+      void run() override {
+        while (!threadShouldExit()) {
+          wait(-1);
+          if (threadShouldExit())
+            return;
+
+          std::lock_guard<std::mutex> lock(filters_mutex_);
+          for (CombFilter* filter : filters_)
+            filter->updateMemory();
+        }
+      }
+
+    private:
+      std::mutex filters_mutex_;
+      std::vector<CombFilter*> filters_;
+  };
+
   /**
    * @brief Constructs a CombFilter with default feedback style and sets up memory.
    *
-   * @param size Initial size of the delay memory.
+   * @param max_size Largest size the delay memory may grow to.
    */
-  CombFilter::CombFilter(int size) : Processor(CombFilter::kNumInputs, 1) {
+  CombFilter::CombFilter(int max_size) : Processor(CombFilter::kNumInputs, 1),
+                                         max_memory_size_(max_size), memory_size_(0), requested_size_(0),
+                                         grown_memory_(nullptr), retired_memory_(nullptr) {
     feedback_style_ = kComb;
-    memory_ = std::make_unique<Memory>(size);
+    reserveMemory();
     feedback_ = 0.0f;
     max_period_ = Memory::kMinPeriod;
     scale_ = 0.0f;
@@ -168,6 +232,9 @@ namespace vital {
 
     filter_coefficient_ = 0.0f;
     filter2_coefficient_ = 0.0f;
+
+    memory_worker_ = MemoryWorker::getInstance();
+    memory_worker_->addFilter(this);
   }
 
   /**
@@ -175,9 +242,13 @@ namespace vital {
    *
    * @param other The CombFilter to copy.
    */
-  CombFilter::CombFilter(const CombFilter& other) : Processor(other), SynthFilter(other) {
+  CombFilter::CombFilter(const CombFilter& other) : Processor(other), SynthFilter(other),
+                                                    max_memory_size_(other.max_memory_size_), memory_size_(0),
+                                                    requested_size_(0), grown_memory_(nullptr),
+                                                    retired_memory_(nullptr) {
     this->feedback_style_ = other.feedback_style_;
     this->memory_ = std::make_unique<Memory>(*other.memory_);
+    this->memory_size_ = this->memory_->getSize();
     this->feedback_ = 0.0f;
     this->max_period_ = Memory::kMinPeriod;
     this->filter_coefficient_ = 0.0f;
@@ -186,12 +257,79 @@ namespace vital {
     this->filter_midi_cutoff_ = 0.0f;
     this->filter2_midi_cutoff_ = 0.0f;
     this->feedback_filter_.reset(constants::kFullMask);
+
+    this->memory_worker_ = MemoryWorker::getInstance();
+    this->memory_worker_->addFilter(this);
   }
 
   /**
-   * @brief Default destructor for CombFilter.
+   * @brief Destructor. Stops the worker from touching this filter and frees any memory in flight.
    */
-  CombFilter::~CombFilter() { }
+  CombFilter::~CombFilter() {
+    memory_worker_->removeFilter(this);
+    delete grown_memory_.exchange(nullptr);
+    delete retired_memory_.exchange(nullptr);
+  }
+
+  void CombFilter::setSampleRate(int sample_rate) {
+    Processor::setSampleRate(sample_rate);
+    reserveMemory();
+  }
+
+  void CombFilter::setOversampleAmount(int oversample) {
+    Processor::setOversampleAmount(oversample);
+    reserveMemory();
+  }
+
+  int CombFilter::getMemorySizeForPeriod(mono_float period) const {
+    mono_float size = std::min(period + kMemoryPadding, static_cast<mono_float>(max_memory_size_));
+    return utils::nextPowerOfTwo(size);
+  }
+
+  void CombFilter::reserveMemory() {
+    mono_float min_frequency = utils::midiNoteToFrequency(kMinReservedMidiCutoff);
+    int size = getMemorySizeForPeriod(getSampleRate() / min_frequency);
+    if (memory_ && memory_->getSize() == size)
+      return;
+
+    memory_ = std::make_unique<Memory>(size);
+    memory_size_ = memory_->getSize();
+    requested_size_ = 0;
+  }
+
+  void CombFilter::adoptGrownMemory() {
+    if (grown_memory_.load() == nullptr || retired_memory_.load() != nullptr)
+      return;
+
+    Memory* grown = grown_memory_.exchange(nullptr);
+    Memory* retired = grown;
+    if (grown->getSize() > memory_->getSize()) {
+      grown->copyHistory(*memory_);
+      retired = memory_.release();
+      memory_.reset(grown);
+      memory_size_ = memory_->getSize();
+    }
+
+    retired_memory_ = retired;
+    memory_worker_->notify();
+  }
+
+  void CombFilter::requestMemory(mono_float period) {
+    int size = getMemorySizeForPeriod(period);
+    if (size <= memory_->getSize() || size <= requested_size_.load())
+      return;
+
+    requested_size_ = size;
+    memory_worker_->notify();
+  }
+
+  void CombFilter::updateMemory() {
+    delete retired_memory_.exchange(nullptr);
+
+    int requested_size = requested_size_.load();
+    if (requested_size > memory_size_.load() && grown_memory_.load() == nullptr)
+      grown_memory_ = new Memory(requested_size);
+  }
 
   /**
    * @brief Resets internal buffers and states for voices indicated by the reset_mask.
@@ -332,6 +470,7 @@ namespace vital {
     poly_float current_high_gain = high_gain_;
 
     setupFilter(filter_state_);
+    adoptGrownMemory();
 
     // Compute min frequency for bounding
     poly_float min_midi_cutoff = utils::min(filter_state_.midi_cutoff_buffer[0],
@@ -343,6 +482,9 @@ namespace vital {
     poly_float min_period = Memory::kMinPeriod;
     if (feedback_style_ == kNegativeFlange)
       min_period *= 2.0f;
+
+    // Periods that don't fit yet are clamped until the worker grows the memory.
+    requestMemory(utils::maxFloat(max_period_));
     max_period_ = utils::clamp(max_period_, min_period, memory_->getMaxPeriod() - 5.0f);
 
     // Check reset
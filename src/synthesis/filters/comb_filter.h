@@ -6,6 +6,9 @@
 #include "memory.h"
 #include "one_pole_filter.h"
 
+#include <atomic>
+#include <memory>
+
 namespace vital {
 
   /**
@@ -14,6 +17,10 @@ namespace vital {
    *
    * The CombFilter supports comb, positive flange, and negative flange feedback variations,
    * with options to blend low/high filter responses or spread band filters.
+   *
+   * The delay memory is sized for the lowest cutoff of the parameter range at the current sample rate. When a
+   * longer period is requested, the period is clamped to what fits while a shared background thread allocates
+   * larger memory, which is swapped in on the next block.
    */
   class CombFilter : public Processor, public SynthFilter {
     public:
@@ -78,6 +85,19 @@ namespace vital {
        */
       static constexpr int kMinPeriod = 2;
 
+      /**
+       * @brief Lowest cutoff, as a MIDI note, the delay memory is sized for up front.
+       *
+       * This is the bottom of the cutoff parameter range. Lower cutoffs from key tracking or modulation grow the
+       * memory in the background when they first show up.
+       */
+      static constexpr mono_float kMinReservedMidiCutoff = 8.0f;
+
+      /**
+       * @brief Samples the delay memory needs beyond the longest period for interpolation and safety margin.
+       */
+      static constexpr int kMemoryPadding = 8;
+
       /**
        * @brief Scaling factor for the comb filter input signal.
        */
@@ -89,11 +109,14 @@ namespace vital {
       static constexpr mono_float kMaxFeedback = 1.0f;
 
       /**
-       * @brief Constructs a CombFilter with a given memory buffer size.
+       * @brief Constructs a CombFilter with a limit on its delay memory size.
+       *
+       * The memory starts out sized for kMinReservedMidiCutoff at the current sample rate and only grows up to
+       * @p max_size if a longer period is requested.
        *
-       * @param size The initial size of the delay memory buffer.
+       * @param max_size The largest the delay memory may grow to.
        */
-      CombFilter(int size = kMinPeriod);
+      CombFilter(int max_size = kMinPeriod);
 
       /**
        * @brief Copy constructor for CombFilter.
@@ -118,6 +141,20 @@ namespace vital {
         return new CombFilter(*this);
       }
 
+      /**
+       * @brief Sets the sample rate and resizes the delay memory for it.
+       *
+       * @param sample_rate The new sample rate in Hz.
+       */
+      void setSampleRate(int sample_rate) override;
+
+      /**
+       * @brief Sets the oversampling amount and resizes the delay memory for the new sample rate.
+       *
+       * @param oversample The new oversampling factor.
+       */
+      void setOversampleAmount(int oversample) override;
+
       /**
        * @brief Sets up the CombFilter state based on a FilterState struct.
        *
@@ -199,12 +236,85 @@ namespace vital {
        */
       poly_float getFilter2MidiCutoff() { return filter2_midi_cutoff_; }
 
+      /**
+       * @brief Getter for the current size of the delay memory in samples.
+       *
+       * @return The delay memory size.
+       */
+      int getMemorySize() const { return memory_->getSize(); }
+
     protected:
+      class MemoryWorker;
+
+      /**
+       * @brief Returns the delay memory size that fits @p period, limited to the maximum size.
+       *
+       * @param period The longest period in samples.
+       * @return The power of two memory size.
+       */
+      int getMemorySizeForPeriod(mono_float period) const;
+
+      /**
+       * @brief Replaces the delay memory with one sized for kMinReservedMidiCutoff at the current sample rate.
+       *
+       * Must not be called while audio is processing.
+       */
+      void reserveMemory();
+
+      /**
+       * @brief Swaps in memory the worker has grown, handing the replaced memory back to it to free.
+       *
+       * Called on the audio thread. Only exchanges pointers and copies the recent history over.
+       */
+      void adoptGrownMemory();
+
+      /**
+       * @brief Asks the worker for memory that fits @p period if the current memory is too small.
+       *
+       * @param period The longest period requested in samples.
+       */
+      void requestMemory(mono_float period);
+
+      /**
+       * @brief Frees replaced memory and allocates requested memory. Called on the worker thread.
+       */
+      void updateMemory();
+
       /**
        * @brief Pointer to the Memory buffer used for the comb delay line.
        */
       std::unique_ptr<Memory> memory_;
 
+      /**
+       * @brief The largest the delay memory may grow to.
+       */
+      int max_memory_size_;
+
+      /**
+       * @brief Size of memory_, readable from the worker thread.
+       */
+      std::atomic<int> memory_size_;
+
+      /**
+       * @brief Memory size the audio thread has asked the worker for.
+       */
+      std::atomic<int> requested_size_;
+
+      /**
+       * @brief Larger memory allocated by the worker, waiting for the audio thread to swap it in.
+       */
+      std::atomic<Memory*> grown_memory_;
+
+      /**
+       * @brief Memory the audio thread replaced, waiting for the worker to free it.
+       */
+      std::atomic<Memory*> retired_memory_;
+
+      /**
+       * @brief Background thread shared by all comb filters that allocates and frees their memory.
+       */
+      std::shared_ptr<MemoryWorker> memory_worker_;
+
       /**
        * @brief Current feedback style (comb, positive flange, negative flange).
        */
@@ -1,62 +1,82 @@
 #include "decimator.h"
 
-#include "iir_halfband_decimator.h"
-
 namespace vital {
 
+  namespace {
+    typedef poly_float DecimatorMemory[IirHalfbandDecimator::kNumTaps25];
+
+    /**
+     * @brief One stage of the decimator cascade, written out at compile time so the stage memory and the
+     *        samples passed between stages stay in registers.
+     *
+     * A stage gets two samples from the stage before it, in time order, and merges them into one through the
+     * half-band allpass branches. The last stage sets the cutoff and gets the sharp filter.
+     */
+    template<int kStage, int kNumStages>
+    struct DecimatorCascade {
+      static force_inline poly_float process(const poly_float* audio, DecimatorMemory* in_memory,
+                                             DecimatorMemory* out_memory) {
+        constexpr int kHalfSize = 1 << kStage;
+
+        poly_float first = DecimatorCascade<kStage - 1, kNumStages>::process(audio, in_memory, out_memory);
+        poly_float second = DecimatorCascade<kStage - 1, kNumStages>::process(audio + kHalfSize,
+                                                                              in_memory, out_memory);
+        poly_float branches = utils::consolidateAudio(first, second);
+        if (kStage == kNumStages - 1) {
+          branches = IirHalfbandDecimator::processAllpasses<IirHalfbandDecimator::kNumTaps25>(
+              branches, IirHalfbandDecimator::kTaps25, in_memory[kStage], out_memory[kStage]);
+        }
+        else {
+          branches = IirHalfbandDecimator::processAllpasses<IirHalfbandDecimator::kNumTaps9>(
+              branches, IirHalfbandDecimator::kTaps9, in_memory[kStage], out_memory[kStage]);
+        }
+        return utils::sumSplitAudio(branches) * 0.5f;
+      }
+    };
+
+    template<int kNumStages>
+    struct DecimatorCascade<-1, kNumStages> {
+      static force_inline poly_float process(const poly_float* audio, DecimatorMemory*, DecimatorMemory*) {
+        return *audio;
+      }
+    };
+  } // namespace
+
   /**
    * @brief Constructs a Decimator with up to @p max_stages halfband decimator stages.
    *
-   * Each stage is created and added as a Processor but is initially disabled until needed.
-   *
    * @param max_stages The maximum number of halfband stages.
    */
-  Decimator::Decimator(int max_stages) : ProcessorRouter(kNumInputs, 1), max_stages_(max_stages) {
+  Decimator::Decimator(int max_stages) : Processor(kNumInputs, 1), max_stages_(max_stages) {
+    VITAL_ASSERT(max_stages_ <= kMaxStages);
     num_stages_ = -1;
-    for (int i = 0; i < max_stages_; ++i) {
-      IirHalfbandDecimator* stage = new IirHalfbandDecimator();
-      stage->setOversampleAmount(1 << (max_stages_ - i - 1));  // e.g., 4x, 2x, etc.
-      addProcessor(stage);
-      stages_.push_back(stage);
-    }
+    reset(constants::kFullMask);
   }
 
   /**
-   * @brief Destructor. Automatically cleans up halfband decimator stages.
+   * @brief Destructor.
    */
   Decimator::~Decimator() { }
 
-  /**
-   * @brief Initializes the Decimator by connecting stages in sequence.
-   *
-   * The first stage reads from the kAudio input, each subsequent stage plugs the previous stage,
-   * and all eventually output to the Decimator’s main output.
-   */
-  void Decimator::init() {
-    stages_[0]->useInput(input(kAudio));
-    stages_[0]->useOutput(output());
-    for (int i = 1; i < max_stages_; ++i) {
-      stages_[i]->plug(stages_[i - 1], IirHalfbandDecimator::kAudio);
-      stages_[i]->useOutput(output());
-    }
-  }
-
   /**
    * @brief Resets all decimator stages for the specified voices.
    *
    * @param reset_mask A poly_mask specifying which voices should be reset.
    */
   void Decimator::reset(poly_mask reset_mask) {
-    for (int i = 0; i < max_stages_; ++i)
-      stages_[i]->reset(reset_mask);
+    for (int stage = 0; stage < kMaxStages; ++stage) {
+      for (int i = 0; i < IirHalfbandDecimator::kNumTaps25; ++i) {
+        in_memory_[stage][i] = 0.0f;
+        out_memory_[stage][i] = 0.0f;
+      }
+    }
   }
 
   /**
-   * @brief Processes audio by determining how many stages are needed and enabling them.
+   * @brief Processes audio by determining how many stages are needed and running them.
    *
-   * Calculates the ratio of input sample rate to output sample rate, enabling as many
-   * halfband decimator stages as needed to reach the final sample rate. Disables any
-   * unused stages.
+   * Calculates the ratio of input sample rate to output sample rate and runs as many
+   * halfband decimator stages as needed to reach the final sample rate.
    *
    * @param num_samples The block size to process.
    */
@@ -76,34 +96,54 @@ namespace vital {
       VITAL_ASSERT(input_sample_rate == output_sample_rate);
     }
 
+    const poly_float* audio_in = input(kAudio)->source->buffer;
+    poly_float* audio_out = output()->buffer;
+
     // If no decimation is needed, pass input directly to output
     if (num_stages == 0) {
-      utils::copyBuffer(output()->buffer, input(kAudio)->source->buffer, num_samples);
+      utils::copyBuffer(audio_out, audio_in, num_samples);
       return;
     }
 
-    // If the number of required stages has changed, reset and reconfigure them
+    // If the number of required stages has changed, start the cascade from silence
     if (num_stages != num_stages_) {
-      for (int i = 0; i < num_stages; ++i)
-        stages_[i]->reset(constants::kFullMask);
-
+      reset(constants::kFullMask);
       num_stages_ = num_stages;
+    }
+
+    VITAL_ASSERT(input(kAudio)->source->buffer_size >= (num_samples << num_stages));
+    if (num_stages == 1)
+      processStages<1>(audio_in, audio_out, num_samples);
+    else if (num_stages == 2)
+      processStages<2>(audio_in, audio_out, num_samples);
+    else
+      processStages<3>(audio_in, audio_out, num_samples);
+  }
 
-      // Enable or disable each stage accordingly
-      for (int i = 0; i < max_stages_; ++i) {
-        IirHalfbandDecimator* stage = stages_[i];
-        bool should_enable = i < num_stages;
-        stage->enable(should_enable);
-        stage->setSharpCutoff(i == num_stages - 1);
+  template<int kNumStages>
+  void Decimator::processStages(const poly_float* audio_in, poly_float* audio_out, int num_samples) {
+    constexpr int kTileSize = 1 << kNumStages;
+    constexpr int kNumTaps25 = IirHalfbandDecimator::kNumTaps25;
 
-        if (should_enable) {
-          int oversample_amount = 1 << (num_stages - i - 1);
-          stage->setOversampleAmount(oversample_amount);
-        }
+    // Work on local copies of the filter memory so it can stay in registers for the block.
+    DecimatorMemory in_memory[kNumStages];
+    DecimatorMemory out_memory[kNumStages];
+    for (int stage = 0; stage < kNumStages; ++stage) {
+      for (int i = 0; i < kNumTaps25; ++i) {
+        in_memory[stage][i] = in_memory_[stage][i];
+        out_memory[stage][i] = out_memory_[stage][i];
       }
     }
 
-    // Execute standard ProcessorRouter processing, which processes all sub-processors in order
-    ProcessorRouter::process(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+      audio_out[i] = DecimatorCascade<kNumStages - 1, kNumStages>::process(audio_in + i * kTileSize,
+                                                                           in_memory, out_memory);
+
+    for (int stage = 0; stage < kNumStages; ++stage) {
+      for (int i = 0; i < kNumTaps25; ++i) {
+        in_memory_[stage][i] = in_memory[stage][i];
+        out_memory_[stage][i] = out_memory[stage][i];
+      }
+    }
   }
 } // namespace vital
@@ -1,23 +1,25 @@
 #pragma once
 
-#include "processor_router.h"
-#include "synth_constants.h"
+#include "processor.h"
+#include "iir_halfband_decimator.h"
 
 namespace vital {
 
-  // Forward declaration of IirHalfbandDecimator
-  class IirHalfbandDecimator;
-
   /**
    * @class Decimator
-   * @brief A ProcessorRouter that intelligently reduces audio sample rate based on configured stages.
+   * @brief A Processor that intelligently reduces audio sample rate based on configured stages.
    *
-   * The Decimator manages multiple IirHalfbandDecimator stages, enabling them dynamically
-   * depending on the input sample rate relative to the output sample rate. Each stage
-   * halves the sample rate if needed.
+   * The Decimator runs a cascade of IIR half-band stages, using as many as needed to bring
+   * the input sample rate down to the output sample rate. Each stage halves the sample rate.
+   * The whole cascade runs as one fused loop: each output sample consumes a tile of
+   * 2^stages input samples and the intermediate rates never leave local variables, so there
+   * are no intermediate buffers.
    */
-  class Decimator : public ProcessorRouter {
+  class Decimator : public Processor {
     public:
+      /// Largest number of stages, enough for kMaxOversample.
+      static constexpr int kMaxStages = 3;
+
       /**
        * @enum InputIndices
        * @brief Enumerates the input indices for this Decimator.
@@ -35,15 +37,10 @@ namespace vital {
       Decimator(int max_stages = 1);
 
       /**
-       * @brief Destructor. Cleans up decimator stages.
+       * @brief Destructor.
        */
       virtual ~Decimator();
 
-      /**
-       * @brief Initializes the Decimator, hooking up audio connections for each stage.
-       */
-      void init() override;
-
       /**
        * @brief Resets all decimator stages for specified voices.
        *
@@ -58,7 +55,7 @@ namespace vital {
       virtual Processor* clone() const override { VITAL_ASSERT(false); return nullptr; }
 
       /**
-       * @brief Main audio processing routine that checks required decimation stages and processes them.
+       * @brief Main audio processing routine that checks the required number of stages and runs the cascade.
        *
        * @param num_samples The block size to be processed.
        */
@@ -72,6 +69,20 @@ namespace vital {
       virtual void setOversampleAmount(int) override { }
 
     private:
+      /**
+       * @brief Runs the fused cascade over a block.
+       *
+       * Every stage but the last uses the light 9 tap filter and the last one, which sets the
+       * final cutoff, uses the sharp 25 tap filter.
+       *
+       * @tparam kNumStages The number of stages to run.
+       * @param audio_in Input buffer with num_samples << kNumStages samples.
+       * @param audio_out Output buffer with num_samples samples.
+       * @param num_samples The number of output samples.
+       */
+      template<int kNumStages>
+      void processStages(const poly_float* audio_in, poly_float* audio_out, int num_samples);
+
       /**
        * @brief The currently active number of decimation stages.
        */
@@ -83,9 +94,14 @@ namespace vital {
       int max_stages_;
 
       /**
-       * @brief Container of pointers to IirHalfbandDecimator stages, one per possible decimation stage.
+       * @brief Input delay memory of each stage's allpass branches.
+       */
+      poly_float in_memory_[kMaxStages][IirHalfbandDecimator::kNumTaps25];
+
+      /**
+       * @brief Output delay memory of each stage's allpass branches.
        */
-      std::vector<IirHalfbandDecimator*> stages_;
+      poly_float out_memory_[kMaxStages][IirHalfbandDecimator::kNumTaps25];
 
       JUCE_LEAK_DETECTOR(Decimator)
   };
@@ -39,12 +39,33 @@ namespace vital {
    * @param num_samples Number of samples to process.
    */
   void DigitalSvf::processWithInput(const poly_float* audio_in, int num_samples) {
+    FilterValues blends1;
+    FilterValues blends2;
+    poly_float current_resonance;
+    poly_float current_drive;
+    poly_float current_post_multiply;
+    startBlock(blends1, blends2, current_resonance, current_drive, current_post_multiply);
+
+    // Branch based on filter style
+    if (filter_state_.style == kShelving || basic_)
+      processBasic12(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1);
+    else if (filter_state_.style == kDualNotchBand) {
+      processDual(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1, blends2);
+    }
+    else if (filter_state_.style == k12Db)
+      process12(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1);
+    else
+      process24(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1);
+  }
+
+  void DigitalSvf::startBlock(FilterValues& blends1, FilterValues& blends2, poly_float& current_resonance,
+                              poly_float& current_drive, poly_float& current_post_multiply) {
     // Copy local state for interpolation
-    FilterValues blends1 = blends1_;
-    FilterValues blends2 = blends2_;
-    poly_float current_resonance = resonance_;
-    poly_float current_drive = drive_;
-    poly_float current_post_multiply = post_multiply_;
+    blends1 = blends1_;
+    blends2 = blends2_;
+    current_resonance = resonance_;
+    current_drive = drive_;
+    current_post_multiply = post_multiply_;
 
     // Load updated filter state parameters
     filter_state_.loadSettings(this);
@@ -60,17 +81,108 @@ namespace vital {
       current_drive = utils::maskLoad(current_drive, drive_, reset_mask);
       current_post_multiply = utils::maskLoad(current_post_multiply, post_multiply_, reset_mask);
     }
+  }
 
-    // Branch based on filter style
-    if (filter_state_.style == kShelving || basic_)
-      processBasic12(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1);
-    else if (filter_state_.style == kDualNotchBand) {
-      processDual(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1, blends2);
+  void DigitalSvf::processBank12(DigitalSvf* const* filters, int num_filters,
+                                 const poly_float* audio_in, poly_float* audio_out, int num_samples) {
+    mono_float sample_inc = 1.0f / num_samples;
+
+    for (int start = 0; start < num_filters; start += kMaxBankSize) {
+      int bank_size = std::min(kMaxBankSize, num_filters - start);
+      DigitalSvf* const* bank = filters + start;
+
+      CutoffCoefficients<SvfCoefficientLookup> coefficients[kMaxBankSize];
+      FilterValues blends[kMaxBankSize];
+      FilterValues delta_blends[kMaxBankSize];
+      poly_float current_resonance[kMaxBankSize];
+      poly_float delta_resonance[kMaxBankSize];
+      poly_float current_drive[kMaxBankSize];
+      poly_float delta_drive[kMaxBankSize];
+      poly_float current_post_multiply[kMaxBankSize];
+      poly_float delta_post_multiply[kMaxBankSize];
+
+      for (int f = 0; f < bank_size; ++f) {
+        DigitalSvf* filter = bank[f];
+        FilterValues blends2;
+        filter->startBlock(blends[f], blends2, current_resonance[f], current_drive[f], current_post_multiply[f]);
+        VITAL_ASSERT(filter->filter_state_.style == k12Db && !filter->basic_);
+
+        delta_blends[f] = blends[f].getDelta(filter->blends1_, sample_inc);
+        delta_resonance[f] = (filter->resonance_ - current_resonance[f]) * sample_inc;
+        delta_drive[f] = (filter->drive_ - current_drive[f]) * sample_inc;
+        delta_post_multiply[f] = (filter->post_multiply_ - current_post_multiply[f]) * sample_inc;
+        coefficients[f] = CutoffCoefficients<SvfCoefficientLookup>(getSvfCoefficientLookup(),
+                                                                   filter->filter_state_.midi_cutoff_buffer,
+                                                                   num_samples, filter->getSampleRate(), 1.0f, 0.0f);
+      }
+
+      // Later banks add on to what the earlier ones wrote.
+      bool accumulate = start > 0;
+      for (int i = 0; i < num_samples; ++i) {
+        poly_float total = accumulate ? audio_out[i] : 0.0f;
+        for (int f = 0; f < bank_size; ++f) {
+          poly_float coefficient = coefficients[f].next();
+
+          blends[f].increment(delta_blends[f]);
+          current_resonance[f] += delta_resonance[f];
+          current_drive[f] += delta_drive[f];
+          current_post_multiply[f] += delta_post_multiply[f];
+
+          poly_float sample = bank[f]->tick(audio_in[i], coefficient, current_resonance[f], current_drive[f], blends[f]);
+          total += sample * current_post_multiply[f];
+        }
+        audio_out[i] = total;
+        VITAL_ASSERT(utils::isFinite(total));
+      }
+    }
+  }
+
+  void DigitalSvf::processChainBasic12(DigitalSvf* const* filters, int num_filters,
+                                       const poly_float* audio_in, poly_float* audio_out, int num_samples) {
+    VITAL_ASSERT(num_filters > 0 && num_filters <= kMaxBankSize);
+    mono_float sample_inc = 1.0f / num_samples;
+
+    CutoffCoefficients<SvfCoefficientLookup> coefficients[kMaxBankSize];
+    FilterValues blends[kMaxBankSize];
+    FilterValues delta_blends[kMaxBankSize];
+    poly_float current_resonance[kMaxBankSize];
+    poly_float delta_resonance[kMaxBankSize];
+    poly_float current_drive[kMaxBankSize];
+    poly_float delta_drive[kMaxBankSize];
+    poly_float current_post_multiply[kMaxBankSize];
+    poly_float delta_post_multiply[kMaxBankSize];
+
+    for (int f = 0; f < num_filters; ++f) {
+      DigitalSvf* filter = filters[f];
+      FilterValues blends2;
+      filter->startBlock(blends[f], blends2, current_resonance[f], current_drive[f], current_post_multiply[f]);
+      VITAL_ASSERT(filter->filter_state_.style == kShelving || filter->basic_);
+
+      delta_blends[f] = blends[f].getDelta(filter->blends1_, sample_inc);
+      delta_resonance[f] = (filter->resonance_ - current_resonance[f]) * sample_inc;
+      delta_drive[f] = (filter->drive_ - current_drive[f]) * sample_inc;
+      delta_post_multiply[f] = (filter->post_multiply_ - current_post_multiply[f]) * sample_inc;
+      coefficients[f] = CutoffCoefficients<SvfCoefficientLookup>(getSvfCoefficientLookup(),
+                                                                 filter->filter_state_.midi_cutoff_buffer,
+                                                                 num_samples, filter->getSampleRate());
+    }
+
+    for (int i = 0; i < num_samples; ++i) {
+      poly_float sample = audio_in[i];
+      for (int f = 0; f < num_filters; ++f) {
+        poly_float coefficient = coefficients[f].next();
+
+        blends[f].increment(delta_blends[f]);
+        current_resonance[f] += delta_resonance[f];
+        current_drive[f] += delta_drive[f];
+        current_post_multiply[f] += delta_post_multiply[f];
+
+        sample = filters[f]->tickBasic(sample, coefficient, current_resonance[f], current_drive[f], blends[f]);
+        sample *= current_post_multiply[f];
+      }
+      audio_out[i] = sample;
+      VITAL_ASSERT(utils::isFinite(sample));
     }
-    else if (filter_state_.style == k12Db)
-      process12(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1);
-    else
-      process24(audio_in, num_samples, current_resonance, current_drive, current_post_multiply, blends1);
   }
 
   void DigitalSvf::process12(const poly_float* audio_in, int num_samples,
@@ -83,15 +195,11 @@ namespace vital {
     poly_float delta_post_multiply = (post_multiply_ - current_post_multiply) * sample_inc;
 
     poly_float* audio_out = output()->buffer;
-    const SvfCoefficientLookup* coefficient_lookup = getSvfCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<SvfCoefficientLookup> coefficients(getSvfCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                          num_samples, getSampleRate(), 1.0f, 0.0f);
 
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = utils::max(midi_cutoff_buffer[i], 0.0f) - base_midi;
-      poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       blends.increment(delta_blends);
       current_resonance += delta_resonance;
@@ -113,15 +221,11 @@ namespace vital {
     poly_float delta_post_multiply = (post_multiply_ - current_post_multiply) * sample_inc;
 
     poly_float* audio_out = output()->buffer;
-    const SvfCoefficientLookup* coefficient_lookup = getSvfCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<SvfCoefficientLookup> coefficients(getSvfCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                          num_samples, getSampleRate());
 
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       blends.increment(delta_blends);
       current_resonance += delta_resonance;
@@ -143,15 +247,11 @@ namespace vital {
     poly_float delta_post_multiply = (post_multiply_ - current_post_multiply) * sample_inc;
 
     poly_float* audio_out = output()->buffer;
-    const SvfCoefficientLookup* coefficient_lookup = getSvfCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<SvfCoefficientLookup> coefficients(getSvfCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                          num_samples, getSampleRate());
 
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       blends.increment(delta_blends);
       current_resonance += delta_resonance;
@@ -174,15 +274,11 @@ namespace vital {
     poly_float delta_post_multiply = (post_multiply_ - current_post_multiply) * sample_inc;
 
     poly_float* audio_out = output()->buffer;
-    const SvfCoefficientLookup* coefficient_lookup = getSvfCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<SvfCoefficientLookup> coefficients(getSvfCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                          num_samples, getSampleRate());
 
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       blends.increment(delta_blends);
       current_resonance += delta_resonance;
@@ -207,15 +303,11 @@ namespace vital {
     poly_float delta_post_multiply = (post_multiply_ - current_post_multiply) * sample_inc;
 
     poly_float* audio_out = output()->buffer;
-    const SvfCoefficientLookup* coefficient_lookup = getSvfCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<SvfCoefficientLookup> coefficients(getSvfCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                          num_samples, getSampleRate());
 
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       blends1.increment(delta_blends1);
       blends2.increment(delta_blends2);
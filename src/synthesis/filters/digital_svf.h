@@ -41,6 +41,11 @@ namespace vital {
        */
       static constexpr mono_float kMinGain = -15.0f;
 
+      /**
+       * @brief Largest number of filters processBank12() and processChainBasic12() run together in one pass.
+       */
+      static constexpr int kMaxBankSize = 4;
+
       /**
        * @brief Computes a one-pole SVF coefficient from a normalized frequency ratio.
        *
@@ -191,6 +196,37 @@ namespace vital {
        */
       void setResonanceBounds(mono_float min, mono_float max);
 
+      /**
+       * @brief Runs a bank of 12 dB filters that share one input and sums their outputs.
+       *
+       * Every filter reads its own inputs and settings as in processWithInput(), but all of them are stepped
+       * together in a single pass over the block, kMaxBankSize at a time. The filters' own output buffers
+       * aren't written.
+       *
+       * @param filters     The filters in the bank. Each must use the k12Db style and not be basic.
+       * @param num_filters Number of filters in the bank.
+       * @param audio_in    Input audio shared by every filter.
+       * @param audio_out   Buffer the summed output is written to.
+       * @param num_samples Number of samples to process.
+       */
+      static void processBank12(DigitalSvf* const* filters, int num_filters,
+                                const poly_float* audio_in, poly_float* audio_out, int num_samples);
+
+      /**
+       * @brief Runs basic 12 dB or shelving filters one after another in a single pass over the block.
+       *
+       * Each filter reads its own inputs and settings as in processWithInput() and feeds the next one sample by
+       * sample, so no intermediate buffers are written. The filters' own output buffers aren't written.
+       *
+       * @param filters     The filters in order. Each must use the kShelving style or be basic.
+       * @param num_filters Number of filters, from 1 to kMaxBankSize.
+       * @param audio_in    Input audio for the first filter.
+       * @param audio_out   Buffer the last filter's output is written to.
+       * @param num_samples Number of samples to process.
+       */
+      static void processChainBasic12(DigitalSvf* const* filters, int num_filters,
+                                      const poly_float* audio_in, poly_float* audio_out, int num_samples);
+
       /**
        * @brief Processes a 12 dB filter style, iterating through the block.
        *
@@ -407,6 +443,18 @@ namespace vital {
       void setDriveCompensation(bool drive_compensation) { drive_compensation_ = drive_compensation; }
 
     private:
+      /**
+       * @brief Loads this block's settings and returns the values to interpolate from.
+       *
+       * @param blends1               Set to the first stage's starting filter mix.
+       * @param blends2               Set to the second stage's starting filter mix.
+       * @param current_resonance     Set to the starting resonance.
+       * @param current_drive         Set to the starting drive.
+       * @param current_post_multiply Set to the starting post multiply.
+       */
+      void startBlock(FilterValues& blends1, FilterValues& blends2, poly_float& current_resonance,
+                      poly_float& current_drive, poly_float& current_post_multiply);
+
       /**
        * @brief MIDI-based cutoff (in Hz) that dictates the filter coefficient lookups.
        */
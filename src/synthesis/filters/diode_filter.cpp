@@ -88,10 +88,8 @@ namespace vital {
 
     // Retrieve the coefficient lookup table and MIDI note-based filter control
     const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(coefficient_lookup, filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
     poly_float high_pass_frequency_ratio =
       kHighPassFrequency * (1.0f / getSampleRate());
     poly_float high_pass_feedback_coefficient =
@@ -99,11 +97,7 @@ namespace vital {
 
     // Main processing loop
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      // Calculate the current sample's frequency from MIDI
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       // Smoothly update parameters
       current_resonance += delta_resonance;
@@ -148,11 +148,8 @@ namespace vital {
     poly_float delta_high        = (high_pass_amount_ - current_high) * tick_increment;
 
     // Retrieve coefficient lookup and MIDI-based cutoff data
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
 
     // Process each sample
     for (int i = 0; i < num_samples; ++i) {
@@ -160,10 +157,7 @@ namespace vital {
       current_resonance   += delta_resonance;
 
       // Compute dynamic cutoff frequency
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       // Compute resonance
       poly_float coefficient_squared = coefficient * coefficient;
@@ -235,11 +229,8 @@ namespace vital {
     poly_float delta_high        = (high_pass_amount_ - current_high) * tick_increment;
 
     // Retrieve coefficient lookup and MIDI-based cutoff data
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
 
     // Process each sample
     for (int i = 0; i < num_samples; ++i) {
@@ -247,10 +238,7 @@ namespace vital {
       current_resonance   += delta_resonance;
 
       // Compute dynamic cutoff frequency
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       // Compute resonance
       poly_float coefficient_squared = coefficient * coefficient;
@@ -327,11 +315,8 @@ namespace vital {
     poly_float delta_high        = (high_pass_amount_ - current_high) * tick_increment;
 
     // Retrieve coefficient lookup and MIDI-based cutoff data
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
 
     // Process each sample
     for (int i = 0; i < num_samples; ++i) {
@@ -339,10 +324,7 @@ namespace vital {
       current_resonance   += delta_resonance;
 
       // Compute dynamic cutoff frequency
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       // Compute resonance
       poly_float coefficient_squared = coefficient * coefficient;
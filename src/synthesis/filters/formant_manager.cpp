@@ -1,7 +1,6 @@
 #include "formant_manager.h"
 
 #include "digital_svf.h"
-#include "operators.h"
 
 namespace vital {
 
@@ -12,27 +11,30 @@ namespace vital {
       formants_.push_back(formant);
       addProcessor(formant);
     }
+    local_formants_ = formants_;
   }
 
-  void FormantManager::init() {
-    int num_formants = static_cast<int>(formants_.size());
-    VariableAdd* total = new VariableAdd(num_formants);
+  FormantManager::FormantManager(const FormantManager& original) :
+      ProcessorRouter(original), formants_(original.formants_) {
     for (DigitalSvf* formant : formants_)
-      total->plugNext(formant);
+      local_formants_.push_back(static_cast<DigitalSvf*>(getLocalProcessor(formant)));
+  }
 
-    addProcessor(total);
-    total->useOutput(output(0), 0);
+  void FormantManager::process(int num_samples) {
+    if (local_formants_.empty())
+      return;
 
-    ProcessorRouter::init();
+    const poly_float* audio_in = local_formants_[0]->input(DigitalSvf::kAudio)->source->buffer;
+    DigitalSvf::processBank12(local_formants_.data(), numFormants(), audio_in, output()->buffer, num_samples);
   }
 
   void FormantManager::reset(poly_mask reset_mask) {
-    for (DigitalSvf* formant : formants_)
-      getLocalProcessor(formant)->reset(reset_mask);
+    for (DigitalSvf* formant : local_formants_)
+      formant->reset(reset_mask);
   }
 
   void FormantManager::hardReset() {
-    for (DigitalSvf* formant : formants_)
-      getLocalProcessor(formant)->hardReset();
+    for (DigitalSvf* formant : local_formants_)
+      formant->hardReset();
   }
 } // namespace vital
@@ -13,7 +13,8 @@ namespace vital {
    *
    * The FormantManager class holds multiple DigitalSvf objects, each of which can be set to
    * represent a different vowel formant or resonance characteristic. It sums the outputs of these
-   * formants to produce a single audio output.
+   * formants to produce a single audio output. The formants all share one input and are run as a
+   * DigitalSvf bank, stepping every formant and the sum together in a single pass over the block.
    */
   class FormantManager : public ProcessorRouter {
     public:
@@ -33,18 +34,22 @@ namespace vital {
        */
       FormantManager(int num_formants = 4);
 
+      /**
+       * @brief Copy constructor used when cloning. Looks up this copy's own formants.
+       * @param original The FormantManager being cloned.
+       */
+      FormantManager(const FormantManager& original);
+
       /**
        * @brief Virtual destructor.
        */
       virtual ~FormantManager() { }
 
       /**
-       * @brief Initializes the internal routing of formant filters, creating the summing processor.
-       *
-       * Called after construction (and any additions of DigitalSvf objects). Sets up how the formant
-       * outputs are summed into a single output.
+       * @brief Runs all formants on their shared input and writes the summed output.
+       * @param num_samples Number of samples to process.
        */
-      virtual void init() override;
+      virtual void process(int num_samples) override;
 
       /**
        * @brief Resets stateful data (e.g., filter history) in each DigitalSvf for voices indicated by the reset_mask.
@@ -86,6 +91,11 @@ namespace vital {
        */
       std::vector<DigitalSvf*> formants_;
 
+      /**
+       * @brief This instance's own copies of the formants, in the same order as formants_.
+       */
+      std::vector<DigitalSvf*> local_formants_;
+
       JUCE_LEAK_DETECTOR(FormantManager)
   };
 } // namespace vital
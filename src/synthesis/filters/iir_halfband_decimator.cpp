@@ -42,20 +42,13 @@ namespace vital {
    * The result is written to the output buffer, halving the sample rate of the incoming signal.
    */
   void IirHalfbandDecimator::process(int num_samples) {
-    int num_taps = kNumTaps9;
-    const poly_float* taps = kTaps9;
-    if (sharp_cutoff_) {
-      num_taps = kNumTaps25;
-      taps = kTaps25;
-    }
-
     const poly_float* audio = input(kAudio)->source->buffer;
     int output_buffer_size = num_samples;
     VITAL_ASSERT(input(kAudio)->source->buffer_size >= 2 * output_buffer_size);
 
     poly_float* audio_out = output()->buffer;
 
-    // Main loop: for each output sample, combine two input samples and update the delay lines
+    // Main loop: for each output sample, combine two input samples and run them through the allpass branches
     for (int i = 0; i < output_buffer_size; ++i) {
       int audio_in_index = 2 * i;
 
@@ -63,20 +56,10 @@ namespace vital {
       poly_float result = utils::consolidateAudio(audio[audio_in_index],
                                                   audio[audio_in_index + 1]);
 
-      // Run through each tap in the IIR filter
-      for (int tap_index = 0; tap_index < num_taps; ++tap_index) {
-        // Compute difference between current signal and stored output
-        poly_float delta = result - out_memory_[tap_index];
-        // Multiply-accumulate with the tap coefficient
-        poly_float new_result = utils::mulAdd(in_memory_[tap_index], taps[tap_index], delta);
-
-        // Update delay lines
-        in_memory_[tap_index] = result;
-        out_memory_[tap_index] = new_result;
-
-        // The filter output at this stage
-        result = new_result;
-      }
+      if (sharp_cutoff_)
+        result = processAllpasses<kNumTaps25>(result, kTaps25, in_memory_, out_memory_);
+      else
+        result = processAllpasses<kNumTaps9>(result, kTaps9, in_memory_, out_memory_);
 
       // Sum the poly_float lanes and scale by 0.5f
       audio_out[i] = utils::sumSplitAudio(result) * 0.5f;
@@ -76,6 +76,33 @@ namespace vital {
        */
       void reset(poly_mask reset_mask) override;
 
+      /**
+       * @brief Runs one value through both allpass branches of a half-band stage.
+       *
+       * The two branches sit in alternating lanes, so a decimator feeds two consecutive samples packed with
+       * utils::consolidateAudio and an interpolator feeds one sample packed next to itself. Keeping the memory
+       * outside the processor lets a cascade hold every stage's state in locals for a whole block.
+       *
+       * @tparam kNumTaps Number of allpass sections, kNumTaps9 or kNumTaps25.
+       * @param audio The packed input.
+       * @param taps The coefficients matching kNumTaps.
+       * @param in_memory Input delay memory with kNumTaps entries.
+       * @param out_memory Output delay memory with kNumTaps entries.
+       * @return The output of both branches, packed the same way as the input.
+       */
+      template<int kNumTaps>
+      static force_inline poly_float processAllpasses(poly_float audio, const poly_float* taps,
+                                                      poly_float* in_memory, poly_float* out_memory) {
+        for (int i = 0; i < kNumTaps; ++i) {
+          poly_float delta = audio - out_memory[i];
+          poly_float result = utils::mulAdd(in_memory[i], taps[i], delta);
+          in_memory[i] = audio;
+          out_memory[i] = result;
+          audio = result;
+        }
+        return audio;
+      }
+
       /**
        * @brief Enables or disables the sharper 25-tap cutoff mode.
        * @param sharp_cutoff If true, use 25 taps; if false, use 9 taps.
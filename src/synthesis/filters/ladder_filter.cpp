@@ -84,20 +84,14 @@ namespace vital {
     // Prepare buffers and coefficient lookup
     const poly_float* audio_in = input(kAudio)->source->buffer;
     poly_float* audio_out = output()->buffer;
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-
-    // Pre-calculate frequency-related constants
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
     poly_float max_frequency = kMaxCutoff / getSampleRate();
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate(), max_frequency);
 
     // Process each sample
     for (int i = 0; i < num_samples; ++i) {
       // Compute current cutoff from MIDI pitch
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), max_frequency);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       // Smoothly update parameters
       current_resonance += delta_resonance;
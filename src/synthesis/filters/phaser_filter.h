@@ -176,16 +176,12 @@ namespace vital {
         poly_float delta_peak5 = (peak5_amount_ - current_peak5) * tick_increment;
 
         poly_float* audio_out = output()->buffer;
-        const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-        const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-        poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-        poly_float base_frequency = utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+        CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                           num_samples, getSampleRate());
 
         // Process each sample
         for (int i = 0; i < num_samples; ++i) {
-          poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-          poly_float frequency = utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-          poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+          poly_float coefficient = coefficients.next();
 
           // Smoothly update parameters
           current_resonance += delta_resonance;
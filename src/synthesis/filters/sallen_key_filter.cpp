@@ -117,21 +117,15 @@ namespace vital {
     poly_float delta_high = (high_pass_amount_ - current_high) * tick_increment;
 
     // Retrieve coefficient lookup and MIDI-based cutoff data
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
 
     poly_float* audio_out = output()->buffer;
 
     // Main loop
     for (int i = 0; i < num_samples; ++i) {
       // Calculate the local cutoff coefficient
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       // Update parameters
       current_resonance += delta_resonance;
@@ -191,20 +185,14 @@ namespace vital {
     poly_float delta_band = (band_pass_amount_ - current_band) * tick_increment;
     poly_float delta_high = (high_pass_amount_ - current_high) * tick_increment;
 
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
 
     poly_float* audio_out = output()->buffer;
 
     // Main loop
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       current_resonance += delta_resonance;
       current_drive += delta_drive;
@@ -265,19 +253,13 @@ namespace vital {
     poly_float delta_low = (low_pass_amount_ - current_low) * tick_increment;
     poly_float delta_high = (high_pass_amount_ - current_high) * tick_increment;
 
-    const CoefficientLookup* coefficient_lookup = getCoefficientLookup();
-    const poly_float* midi_cutoff_buffer = filter_state_.midi_cutoff_buffer;
-    poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
-    poly_float base_frequency =
-      utils::midiNoteToFrequency(base_midi) * (1.0f / getSampleRate());
+    CutoffCoefficients<CoefficientLookup> coefficients(getCoefficientLookup(), filter_state_.midi_cutoff_buffer,
+                                                       num_samples, getSampleRate());
 
     poly_float* audio_out = output()->buffer;
 
     for (int i = 0; i < num_samples; ++i) {
-      poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
-      poly_float frequency =
-        utils::min(base_frequency * futils::midiOffsetToRatio(midi_delta), 1.0f);
-      poly_float coefficient = coefficient_lookup->cubicLookup(frequency);
+      poly_float coefficient = coefficients.next();
 
       current_resonance += delta_resonance;
       current_drive += delta_drive;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common.h"
+#include "futils.h"
 #include "lookup_table.h"
 #include "synth_constants.h"
 
@@ -47,6 +48,122 @@ namespace vital {
        */
       static const CoefficientLookup* getCoefficientLookup() { return &coefficient_lookup_; }
 
+      /**
+       * @class CutoffCoefficients
+       * @brief Produces the per sample filter coefficient for a block of MIDI cutoff values.
+       *
+       * Evaluating the coefficient takes an exp2 and a cubic table lookup. When the cutoff moves slowly this is
+       * only done at the end of every stride of kStride samples and the coefficients in between are linearly
+       * interpolated. A stride is evaluated every sample instead if the cutoff doesn't follow a straight line
+       * within kMaxMidiDeviation semitones, or moves more than kMaxMidiStep semitones, which is what audio rate
+       * cutoff modulation looks like.
+       *
+       * @tparam Lookup The coefficient lookup table type.
+       */
+      template <class Lookup>
+      class CutoffCoefficients {
+        public:
+          /// Number of samples between coefficient evaluations when the cutoff moves slowly.
+          static constexpr int kStride = 8;
+          /// Largest distance in semitones between the cutoff and a straight line over an interpolated stride.
+          static constexpr mono_float kMaxMidiDeviation = 0.02f;
+          /// Largest cutoff change in semitones over an interpolated stride.
+          static constexpr mono_float kMaxMidiStep = 2.0f;
+          /// Default lower MIDI limit, low enough to never apply.
+          static constexpr mono_float kNoMinMidi = -1000.0f;
+
+          /**
+           * @brief Constructs an empty placeholder to be assigned a block's coefficients later.
+           */
+          CutoffCoefficients() : lookup_(nullptr), midi_cutoff_buffer_(nullptr), num_samples_(0),
+                                 position_(0), remaining_(0), exact_(false) { }
+
+          /**
+           * @brief Prepares the coefficients for one block.
+           *
+           * @param lookup The coefficient lookup table.
+           * @param midi_cutoff_buffer Per sample cutoff in MIDI notes.
+           * @param num_samples Number of samples in the block.
+           * @param sample_rate The filter's sample rate.
+           * @param max_frequency Largest frequency ratio passed to the lookup.
+           * @param min_midi Cutoff values are raised to at least this MIDI note.
+           */
+          CutoffCoefficients(const Lookup* lookup, const poly_float* midi_cutoff_buffer, int num_samples,
+                             mono_float sample_rate, poly_float max_frequency = 1.0f,
+                             poly_float min_midi = kNoMinMidi) :
+              lookup_(lookup), midi_cutoff_buffer_(midi_cutoff_buffer), num_samples_(num_samples),
+              max_frequency_(max_frequency), min_midi_(min_midi), position_(0), remaining_(1), exact_(false) {
+            base_midi_ = midi_cutoff_buffer[num_samples - 1];
+            base_frequency_ = utils::midiNoteToFrequency(base_midi_) * (1.0f / sample_rate);
+            coefficient_ = evaluate(0);
+            delta_ = 0.0f;
+          }
+
+          /**
+           * @brief Returns the coefficient for the next sample of the block.
+           * @return The filter coefficient.
+           */
+          force_inline poly_float next() {
+            if (remaining_ == 0)
+              startStride();
+
+            remaining_--;
+            if (exact_)
+              coefficient_ = evaluate(position_);
+            else
+              coefficient_ += delta_;
+
+            position_++;
+            return coefficient_;
+          }
+
+        private:
+          force_inline poly_float midi(int index) const {
+            return utils::max(midi_cutoff_buffer_[index], min_midi_);
+          }
+
+          force_inline poly_float evaluate(int index) const {
+            poly_float midi_delta = midi(index) - base_midi_;
+            poly_float frequency = utils::min(base_frequency_ * futils::midiOffsetToRatio(midi_delta), max_frequency_);
+            return lookup_->cubicLookup(frequency);
+          }
+
+          void startStride() {
+            // The first sample of the block is evaluated on its own, so every stride starts from an exact value.
+            remaining_ = std::min(kStride, num_samples_ - position_);
+            int end = position_ + remaining_ - 1;
+            poly_float start_midi = midi(position_ - 1);
+            poly_float end_midi = midi(end);
+            poly_float step = (end_midi - start_midi) * (1.0f / remaining_);
+
+            poly_float line = start_midi;
+            poly_float deviation = 0.0f;
+            for (int i = position_; i < end; ++i) {
+              line += step;
+              deviation = utils::max(deviation, poly_float::abs(midi(i) - line));
+            }
+
+            poly_mask fast_mask = poly_float::greaterThan(deviation, kMaxMidiDeviation) |
+                                  poly_float::greaterThan(poly_float::abs(end_midi - start_midi), kMaxMidiStep);
+            exact_ = fast_mask.anyMask();
+            if (!exact_)
+              delta_ = (evaluate(end) - coefficient_) * (1.0f / remaining_);
+          }
+
+          const Lookup* lookup_;
+          const poly_float* midi_cutoff_buffer_;
+          int num_samples_;
+          poly_float max_frequency_;
+          poly_float min_midi_;
+          poly_float base_midi_;
+          poly_float base_frequency_;
+          poly_float coefficient_;
+          poly_float delta_;
+          int position_;
+          int remaining_;
+          bool exact_;
+      };
+
       /**
        * @enum FilterInputs
        * @brief Enumerates indices for filter inputs in Vital’s processing system.
@@ -2,10 +2,58 @@
 
 namespace vital {
 
+  namespace {
+    typedef poly_float UpsamplerMemory[IirHalfbandDecimator::kNumTaps25];
+
+    /**
+     * @brief One stage of the interpolator cascade, written out at compile time so the stage memory and the
+     *        samples passed between stages stay in registers.
+     *
+     * A stage splits one sample into two through the half-band allpass branches and hands each of them, in time
+     * order, to the next stage. The first stage sets the cutoff and gets the sharp filter.
+     */
+    template<int kStage, int kNumStages>
+    struct UpsamplerCascade {
+      static force_inline void process(poly_float sample, UpsamplerMemory* in_memory, UpsamplerMemory* out_memory,
+                                       poly_float* destination) {
+        constexpr int kHalfSize = 1 << (kNumStages - kStage - 1);
+
+        poly_float branches = utils::consolidateAudio(sample, sample);
+        if (kStage == 0) {
+          branches = IirHalfbandDecimator::processAllpasses<IirHalfbandDecimator::kNumTaps25>(
+              branches, IirHalfbandDecimator::kTaps25, in_memory[kStage], out_memory[kStage]);
+        }
+        else {
+          branches = IirHalfbandDecimator::processAllpasses<IirHalfbandDecimator::kNumTaps9>(
+              branches, IirHalfbandDecimator::kTaps9, in_memory[kStage], out_memory[kStage]);
+        }
+
+        // The second branch holds the earlier of the two new samples.
+        branches = utils::swapInner(branches);
+        poly_float later = utils::compactFirstVoices(branches, branches);
+        branches = utils::swapVoices(branches);
+        poly_float earlier = utils::compactFirstVoices(branches, branches);
+
+        UpsamplerCascade<kStage + 1, kNumStages>::process(earlier, in_memory, out_memory, destination);
+        UpsamplerCascade<kStage + 1, kNumStages>::process(later, in_memory, out_memory, destination + kHalfSize);
+      }
+    };
+
+    template<int kNumStages>
+    struct UpsamplerCascade<kNumStages, kNumStages> {
+      static force_inline void process(poly_float sample, UpsamplerMemory*, UpsamplerMemory*,
+                                       poly_float* destination) {
+        *destination = sample;
+      }
+    };
+  } // namespace
+
   /**
    * @brief Default constructor, initializes the Upsampler with one output channel.
    */
-  Upsampler::Upsampler() : ProcessorRouter(kNumInputs, 1) { }
+  Upsampler::Upsampler() : ProcessorRouter(kNumInputs, 1), interpolate_(false), num_stages_(-1) {
+    reset(constants::kFullMask);
+  }
 
   /**
    * @brief Virtual destructor for the Upsampler class.
@@ -25,22 +73,82 @@ namespace vital {
   }
 
   /**
-   * @brief Performs the upsampling by repeating each input sample a specified number of times.
+   * @brief Performs the upsampling by repeating or interpolating each input sample.
    * @param audio_in Pointer to the buffer containing the original audio samples.
-   * @param num_samples Number of output samples to write to.
+   * @param num_samples Number of input samples to upsample.
    *
-   * For each input sample, we store it multiple times in the output buffer, where the number
-   * of times is determined by getOversampleAmount(). This expands the sample buffer by that factor.
+   * Without interpolation, each input sample is stored multiple times in the output buffer, where
+   * the number of times is determined by getOversampleAmount(). With interpolation the half-band
+   * cascade produces the new samples in between.
    */
   void Upsampler::processWithInput(const poly_float* audio_in, int num_samples) {
     poly_float* destination = output()->buffer;
 
     int oversample_amount = getOversampleAmount();
+    int num_stages = 0;
+    while ((2 << num_stages) <= oversample_amount)
+      num_stages++;
+
+    if (!interpolate_ || num_stages == 0) {
+      for (int i = 0; i < num_samples; ++i) {
+        int offset = i * oversample_amount;
+        for (int s = 0; s < oversample_amount; ++s)
+          destination[offset + s] = audio_in[i];
+      }
+      return;
+    }
+
+    VITAL_ASSERT(num_stages <= kMaxStages);
+    VITAL_ASSERT((1 << num_stages) == oversample_amount);
+    if (num_stages != num_stages_) {
+      reset(constants::kFullMask);
+      num_stages_ = num_stages;
+    }
+
+    if (num_stages == 1)
+      processStages<1>(audio_in, destination, num_samples);
+    else if (num_stages == 2)
+      processStages<2>(audio_in, destination, num_samples);
+    else
+      processStages<3>(audio_in, destination, num_samples);
+  }
+
+  /**
+   * @brief Clears the memory of every interpolation stage.
+   * @param reset_mask Unused.
+   */
+  void Upsampler::reset(poly_mask reset_mask) {
+    for (int stage = 0; stage < kMaxStages; ++stage) {
+      for (int i = 0; i < IirHalfbandDecimator::kNumTaps25; ++i) {
+        in_memory_[stage][i] = 0.0f;
+        out_memory_[stage][i] = 0.0f;
+      }
+    }
+  }
+
+  template<int kNumStages>
+  void Upsampler::processStages(const poly_float* audio_in, poly_float* audio_out, int num_samples) {
+    constexpr int kTileSize = 1 << kNumStages;
+    constexpr int kNumTaps25 = IirHalfbandDecimator::kNumTaps25;
+
+    // Work on local copies of the filter memory so it can stay in registers for the block.
+    UpsamplerMemory in_memory[kNumStages];
+    UpsamplerMemory out_memory[kNumStages];
+    for (int stage = 0; stage < kNumStages; ++stage) {
+      for (int i = 0; i < kNumTaps25; ++i) {
+        in_memory[stage][i] = in_memory_[stage][i];
+        out_memory[stage][i] = out_memory_[stage][i];
+      }
+    }
+
+    for (int i = 0; i < num_samples; ++i)
+      UpsamplerCascade<0, kNumStages>::process(audio_in[i], in_memory, out_memory, audio_out + i * kTileSize);
 
-    for (int i = 0; i < num_samples; ++i) {
-      int offset = i * oversample_amount;
-      for (int s = 0; s < oversample_amount; ++s)
-        destination[offset + s] = audio_in[i];
+    for (int stage = 0; stage < kNumStages; ++stage) {
+      for (int i = 0; i < kNumTaps25; ++i) {
+        in_memory_[stage][i] = in_memory[stage][i];
+        out_memory_[stage][i] = out_memory[stage][i];
+      }
     }
   }
 } // namespace vital
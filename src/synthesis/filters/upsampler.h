@@ -1,28 +1,36 @@
 #pragma once
 
 #include "processor_router.h"
+#include "iir_halfband_decimator.h"
 #include "synth_constants.h"
 
 namespace vital {
 
     /**
      * @class Upsampler
-     * @brief A simple upsampler that duplicates samples to increase the sample rate by an integral factor.
+     * @brief Increases the sample rate of a signal by an integral factor.
      *
-     * The Upsampler takes an input signal and increases its effective sample rate by repeating each input sample
-     * a specified number of times (given by the oversampling factor). It does not apply any filtering or interpolation,
-     * simply repeating samples to form the output. While this is not a high-quality resampling method and may
-     * introduce aliasing, it is computationally efficient and can be useful in certain contexts where oversampling
-     * is desired before further processing.
+     * By default the Upsampler repeats each input sample a specified number of times (given by the oversampling
+     * factor). This applies no filtering, so it leaves images of the signal above the original Nyquist frequency,
+     * but it is computationally cheap and fine when everything after it is linear and decimated again.
+     *
+     * With interpolation enabled it instead runs a cascade of polyphase IIR half-band interpolators, the mirror of
+     * the Decimator cascade. Each stage doubles the rate by running every sample through the two allpass branches
+     * of an IirHalfbandDecimator filter at once, one branch per output phase. The first stage, which sets the final
+     * cutoff, uses the sharp 25 tap filter and the rest use the light 9 tap filter. Like the Decimator, the whole
+     * cascade runs per input sample in locals without intermediate buffers.
      *
      * Inputs:
      * - kAudio: The input audio signal to be upsampled.
      *
      * Output:
-     * - The upsampled audio signal. Each input sample is replicated oversample_amount times.
+     * - The upsampled audio signal, oversample_amount samples per input sample.
      */
     class Upsampler : public ProcessorRouter {
     public:
+        /// Largest number of interpolation stages, enough for kMaxOversample.
+        static constexpr int kMaxStages = 3;
+
         /// Input indices.
         enum {
             kAudio,    ///< Input audio signal.
@@ -55,14 +63,47 @@ namespace vital {
         /**
          * @brief Processes a given block of input samples by upsampling them.
          *
-         * Copies each input sample oversample_amount times to produce the upsampled output.
+         * Copies each input sample oversample_amount times, or interpolates them if interpolation is enabled.
          *
          * @param audio_in Pointer to the input audio buffer.
-         * @param num_samples The number of output samples to produce.
+         * @param num_samples The number of input samples to upsample.
          */
         virtual void processWithInput(const poly_float* audio_in, int num_samples) override;
 
+        /**
+         * @brief Clears the interpolation filter memory.
+         *
+         * @param reset_mask Unused, the Upsampler processes a single voice.
+         */
+        void reset(poly_mask reset_mask) override;
+
+        /**
+         * @brief Chooses between interpolating and repeating samples.
+         *
+         * @param interpolate True to run the half-band interpolator cascade.
+         */
+        void setInterpolate(bool interpolate) { interpolate_ = interpolate; }
+
+        /// Returns true if the Upsampler interpolates instead of repeating samples.
+        bool interpolate() const { return interpolate_; }
+
     private:
+        /**
+         * @brief Runs the fused interpolator cascade over a block.
+         *
+         * @tparam kNumStages The number of stages to run.
+         * @param audio_in Input buffer with num_samples samples.
+         * @param audio_out Output buffer with num_samples << kNumStages samples.
+         * @param num_samples The number of input samples.
+         */
+        template<int kNumStages>
+        void processStages(const poly_float* audio_in, poly_float* audio_out, int num_samples);
+
+        bool interpolate_;
+        int num_stages_;
+        poly_float in_memory_[kMaxStages][IirHalfbandDecimator::kNumTaps25];
+        poly_float out_memory_[kMaxStages][IirHalfbandDecimator::kNumTaps25];
+
         JUCE_LEAK_DETECTOR(Upsampler)
     };
 } // namespace vital
@@ -365,6 +365,11 @@ namespace vital {
        */
       virtual void process(int num_samples) override;
 
+      /**
+       * @brief Drops the last multiplier so the next block ramps up from silence, as after construction.
+       */
+      virtual void hardReset() override { multiply_ = 0.0f; }
+
     protected:
       /**
        * @brief Internal function to perform the per-sample smoothing of the multiplier and multiplication.
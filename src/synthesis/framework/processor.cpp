@@ -31,6 +31,8 @@ namespace vital {
     inputs_ = std::make_shared<std::vector<Input*>>();
     outputs_ = std::make_shared<std::vector<Output*>>();
     router_ = nullptr;
+    dependency_search_ = 0;
+    dependency_match_ = 0;
 
     for (int i = 0; i < num_inputs; ++i)
       addInput();
@@ -111,8 +113,11 @@ namespace vital {
       }
     }
 
-    // If there are no empty inputs, create another.
-    std::shared_ptr<Input> input = std::make_shared<Input>();
+    // If there are no empty inputs, add another, taking a reserved one before allocating.
+    std::shared_ptr<Input> input = takeReservedInput();
+    if (input == nullptr)
+      input = std::make_shared<Input>();
+
     owned_inputs_.push_back(input);
     input->source = source;
     registerInput(input.get());
@@ -123,6 +128,12 @@ namespace vital {
     plugNext(source->output());
   }
 
+  void Processor::reserveInputs(int num_inputs) {
+    reserved_inputs_ = std::make_shared<std::vector<Input>>(num_inputs);
+    inputs_->reserve(inputs_->size() + num_inputs);
+    owned_inputs_.reserve(owned_inputs_.size() + num_inputs);
+  }
+
   void Processor::useInput(Input* input) {
     useInput(input, 0);
   }
@@ -243,6 +254,18 @@ namespace vital {
     return output.get();
   }
 
+  std::shared_ptr<Input> Processor::takeReservedInput() {
+    if (reserved_inputs_ == nullptr)
+      return nullptr;
+
+    // Reserved inputs have no source until they're handed out and never go back to having none.
+    for (Input& input : *reserved_inputs_) {
+      if (input.source == nullptr)
+        return std::shared_ptr<Input>(reserved_inputs_, &input);
+    }
+    return nullptr;
+  }
+
   Input* Processor::addInput() {
     std::shared_ptr<Input> input = std::make_shared<Input>();
     owned_inputs_.push_back(input);
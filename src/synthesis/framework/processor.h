@@ -16,6 +16,7 @@
 
 #include "common.h"
 #include "poly_utils.h"
+#include "processor_profile.h"
 
 #include <cstring>
 #include <vector>
@@ -177,6 +178,10 @@ namespace vital {
     bool control_rate;       ///< True if running at control rate (usually buffer_size == 1).
     bool enabled;            ///< Whether this Processor is currently enabled or not.
     bool initialized;        ///< Whether this Processor has been initialized.
+
+  #if VITAL_PROFILE
+    ProcessorProfile profile; ///< Time spent in this Processor and its clones.
+  #endif
   };
 
   namespace cr {
@@ -335,6 +340,16 @@ namespace vital {
         return state_->oversample_amount;
       }
 
+    #if VITAL_PROFILE
+      /**
+       * @brief Retrieves the CPU totals shared by this Processor and its clones.
+       * @return A pointer to the profile.
+       */
+      force_inline ProcessorProfile* profile() const {
+        return &state_->profile;
+      }
+    #endif
+
       /**
        * @brief Checks if this Processor is running at control rate (buffer_size == 1).
        * @return True if control rate, false otherwise.
@@ -444,6 +459,15 @@ namespace vital {
        */
       void plugNext(const Processor* source);
 
+      /**
+       * @brief Preallocates inputs so plugNext can add them without allocating.
+       *
+       * Call this before audio starts on Processors that get plugged into while running, like modulation
+       * destinations. The reserved inputs are shared with clones. Once they're used up plugNext allocates again.
+       * @param num_inputs Number of inputs plugNext can add without allocating.
+       */
+      void reserveInputs(int num_inputs);
+
       /**
        * @brief Uses an existing Input object as this Processor's first input.
        * @param input The existing Input object to use.
@@ -650,20 +674,33 @@ namespace vital {
        */
       Input* addInput();
 
+      /**
+       * @brief Hands out an unused reserved Input.
+       * @return The Input, or nullptr if there are none left.
+       */
+      std::shared_ptr<Input> takeReservedInput();
+
       std::shared_ptr<ProcessorState> state_;  ///< Shared state (sample rate, oversample, etc.)
 
       int plugging_start_; ///< The index at which `plugNext` starts searching for an unplugged input.
 
       std::vector<std::shared_ptr<Input>> owned_inputs_;   ///< Inputs owned by this Processor.
       std::vector<std::shared_ptr<Output>> owned_outputs_; ///< Outputs owned by this Processor.
+      std::shared_ptr<std::vector<Input>> reserved_inputs_; ///< Preallocated inputs for plugNext, unused until their source is set.
 
       std::shared_ptr<std::vector<Input*>> inputs_;   ///< All inputs, owned or external.
       std::shared_ptr<std::vector<Output*>> outputs_; ///< All outputs, owned or external.
 
       ProcessorRouter* router_; ///< The ProcessorRouter that manages this Processor.
 
+      mutable int64_t dependency_search_; ///< Last ProcessorRouter dependency search that queued this Processor's inputs.
+      mutable int64_t dependency_match_;  ///< Last ProcessorRouter dependency search that found this Processor upstream.
+
       static const Output null_source_; ///< A null (dummy) source used for unconnected inputs.
 
+      // Routers mark the Processors a dependency search reaches instead of keeping them in lists to search.
+      friend class ProcessorRouter;
+
       JUCE_LEAK_DETECTOR(Processor)
   };
 } // namespace vital
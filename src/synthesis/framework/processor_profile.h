@@ -0,0 +1,109 @@
+#pragma once
+
+/**
+ * @file processor_profile.h
+ * @brief Optional per-processor CPU accounting.
+ *
+ * Build with VITAL_PROFILE=1 to time the Processors that SynthModules name with addProfiledProcessor() whenever
+ * a ProcessorRouter or VoiceHandler runs them. Otherwise the VITAL_PROFILE_SCOPE macro expands to nothing and no
+ * counters are added to Processors.
+ */
+
+#include "common.h"
+
+#ifndef VITAL_PROFILE
+#define VITAL_PROFILE 0
+#endif
+
+#if VITAL_PROFILE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace vital {
+
+  namespace profile {
+    /**
+     * @brief Reads a cheap, monotonic cycle counter.
+     *
+     * The units depend on the platform so counts are only compared with each other. SoundEngine converts them
+     * to time by measuring how long its own blocks take.
+     */
+    force_inline uint64_t readCycles() {
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+      return __rdtsc();
+    #elif defined(__x86_64__) || defined(__i386__)
+      return __rdtsc();
+    #elif defined(__aarch64__)
+      uint64_t value;
+      asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+      return value;
+    #else
+      return std::chrono::steady_clock::now().time_since_epoch().count();
+    #endif
+    }
+  } // namespace profile
+
+  /**
+   * @struct ProcessorProfile
+   * @brief Running totals of the time spent in one Processor and all of its clones.
+   *
+   * Only the audio thread writes the totals, so they're updated with plain relaxed loads and stores instead of
+   * locked read-modify-writes. Other threads may read them at any time. Untracked profiles are skipped so the
+   * hundreds of small Processors in a patch don't each pay for reading the cycle counter.
+   */
+  struct ProcessorProfile {
+    ProcessorProfile() : tracked(false), cycles(0), calls(0) { }
+
+    /**
+     * @brief Adds one timed call.
+     * @param elapsed The number of cycles the call took.
+     */
+    force_inline void add(uint64_t elapsed) {
+      cycles.store(cycles.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+      calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    bool tracked;                 ///< True if calls should be timed.
+    std::atomic<uint64_t> cycles; ///< Total cycles spent processing.
+    std::atomic<uint64_t> calls;  ///< Total number of timed calls.
+  };
+
+  /**
+   * @class ScopedProfile
+   * @brief Adds the cycles between its construction and destruction to a tracked ProcessorProfile.
+   */
+  class ScopedProfile {
+    public:
+      force_inline ScopedProfile(ProcessorProfile* profile) : profile_(nullptr), start_(0) {
+        if (profile->tracked) {
+          profile_ = profile;
+          start_ = profile::readCycles();
+        }
+      }
+
+      force_inline ~ScopedProfile() {
+        if (profile_)
+          profile_->add(profile::readCycles() - start_);
+      }
+
+    private:
+      ProcessorProfile* profile_;
+      uint64_t start_;
+  };
+} // namespace vital
+
+#define VITAL_PROFILE_SCOPE(processor) vital::ScopedProfile vital_profile_scope((processor)->profile())
+
+#else
+
+#define VITAL_PROFILE_SCOPE(processor) ((void)0)
+
+#endif // VITAL_PROFILE
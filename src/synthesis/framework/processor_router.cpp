@@ -9,6 +9,7 @@
 #include "synth_constants.h"
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
 namespace vital {
@@ -21,8 +22,8 @@ namespace vital {
             global_feedback_order_(new std::vector<const Feedback*>()),
             global_changes_(new int(0)), local_changes_(0),
             dependencies_(new CircularQueue<const Processor*>(kMaxModulationConnections)),
-            dependencies_visited_(new CircularQueue<const Processor*>(kMaxModulationConnections)),
-            dependency_inputs_(new CircularQueue<const Processor*>(kMaxModulationConnections)) { }
+            dependency_inputs_(new CircularQueue<const Processor*>(kMaxModulationConnections)),
+            dependency_search_id_(0) { }
 
     ProcessorRouter::ProcessorRouter(const ProcessorRouter& original) :
             Processor(original),
@@ -69,6 +70,7 @@ namespace vital {
             if (processor->enabled()) {
                 int processor_samples = normal_samples * processor->getOversampleAmount();
                 VITAL_ASSERT(processor->checkInputAndOutputSize(processor_samples));
+                VITAL_PROFILE_SCOPE(processor);
                 processor->process(processor_samples);
                 VITAL_ASSERT(utils::isFinite(processor->output()->buffer, processor->isControlRate() ? 0 : processor_samples));
             }
@@ -118,6 +120,22 @@ namespace vital {
             local_feedback_order_[i]->setOversampleAmount(oversample);
     }
 
+    void ProcessorRouter::hardReset() {
+        if (shouldUpdate())
+            updateAllProcessors();
+
+        for (auto& idle_processor : idle_processors_)
+            idle_processor.second->hardReset();
+
+        int num_processors = static_cast<int>(local_order_.size());
+        for (int i = 0; i < num_processors; ++i)
+            local_order_[i]->hardReset();
+
+        int num_feedbacks = static_cast<int>(local_feedback_order_.size());
+        for (int i = 0; i < num_feedbacks; ++i)
+            local_feedback_order_[i]->hardReset();
+    }
+
     void ProcessorRouter::addProcessor(Processor* processor) {
         VITAL_ASSERT(processor->router() == nullptr);
         global_order_->ensureSpace();
@@ -165,6 +183,23 @@ namespace vital {
         processors_.erase(processor);
     }
 
+    void ProcessorRouter::reserveDependencies(int num_processors) {
+        // Clones never search for dependencies and don't have the search space.
+        if (dependencies_ == nullptr)
+            return;
+
+        dependencies_->ensureCapacity(num_processors);
+        dependency_inputs_->ensureCapacity(num_processors);
+    }
+
+    void ProcessorRouter::shareDependencies(const ProcessorRouter* other) {
+        if (dependencies_ == nullptr || other->dependencies_ == nullptr)
+            return;
+
+        dependencies_ = other->dependencies_;
+        dependency_inputs_ = other->dependency_inputs_;
+    }
+
     void ProcessorRouter::connect(Processor* destination, const Output* source, int index) {
         if (isDownstream(destination, source->owner)) {
             // Cycle detected - insert feedback
@@ -210,7 +245,7 @@ namespace vital {
 
         for (int i = 0; i < num_processors; ++i) {
             Processor* current_processor = global_order_->at(i);
-            if (current_processor != processor && dependencies_->contains(current_processor))
+            if (current_processor != processor && isDependency(current_processor))
                 global_reorder_->push_back(current_processor);
         }
 
@@ -219,7 +254,7 @@ namespace vital {
 
         for (int i = 0; i < num_processors; ++i) {
             Processor* current_processor = global_order_->at(i);
-            if (current_processor != processor && !dependencies_->contains(current_processor))
+            if (current_processor != processor && !isDependency(current_processor))
                 global_reorder_->push_back(current_processor);
         }
 
@@ -232,7 +267,7 @@ namespace vital {
 
     bool ProcessorRouter::isDownstream(const Processor* first, const Processor* second) const {
         getDependencies(second);
-        return dependencies_->contains(first);
+        return isDependency(first);
     }
 
     bool ProcessorRouter::areOrdered(const Processor* first, const Processor* second) const {
@@ -378,8 +413,12 @@ namespace vital {
     }
 
     void ProcessorRouter::getDependencies(const Processor* processor) const {
+        // Each search gets a new id and marks the Processors it reaches with it, so checking whether a Processor
+        // was already reached doesn't walk the lists. Ids are unique across routers since they share search space.
+        static std::atomic<int64_t> next_search_id(0);
+        dependency_search_id_ = ++next_search_id;
+
         dependencies_->clear();
-        dependencies_visited_->clear();
         dependency_inputs_->clear();
         const Processor* context = getContext(processor);
 
@@ -389,26 +428,27 @@ namespace vital {
             const Processor* dep_processor = getContext(dependency_inputs_->at(i));
 
             if (dep_processor) {
-                if (!dependencies_->contains(dep_processor)) {
+                if (!isDependency(dep_processor)) {
+                    dep_processor->dependency_match_ = dependency_search_id_;
                     dependencies_->ensureSpace();
                     dependencies_->push_back(dep_processor);
                 }
 
                 for (int j = 0; j < dependency_inputs_->at(i)->numInputs(); ++j) {
                     const Input* input = dependency_inputs_->at(i)->ownedInput(j);
-                    if (input->source && input->source->owner && !dependencies_visited_->contains(input->source->owner)) {
+                    const Processor* owner = input->source ? input->source->owner : nullptr;
+                    if (owner && owner->dependency_search_ != dependency_search_id_) {
+                        owner->dependency_search_ = dependency_search_id_;
                         dependency_inputs_->ensureSpace();
-                        dependency_inputs_->push_back(input->source->owner);
-
-                        if (!dependencies_visited_->contains(input->source->owner)) {
-                            dependencies_visited_->ensureSpace();
-                            dependencies_visited_->push_back(input->source->owner);
-                        }
+                        dependency_inputs_->push_back(owner);
                     }
                 }
             }
         }
 
-        dependencies_->removeAll(context);
+        if (context) {
+            dependencies_->removeAll(context);
+            context->dependency_match_ = 0;
+        }
     }
 } // namespace vital
@@ -90,6 +90,13 @@ namespace vital {
        */
       virtual void setOversampleAmount(int oversample) override;
 
+      /**
+       * @brief Hard resets every Processor and Feedback node in this router.
+       *
+       * Routers have no state of their own, so this returns the whole subgraph to its initial state.
+       */
+      virtual void hardReset() override;
+
       /**
        * @brief Adds a Processor to be managed by this router.
        * @param processor The Processor to add.
@@ -117,6 +124,29 @@ namespace vital {
        */
       virtual void removeProcessor(Processor* processor);
 
+      /**
+       * @brief Returns how many Processors this router runs or holds idle.
+       */
+      int numProcessors() const { return static_cast<int>(processors_.size() + idle_processors_.size()); }
+
+      /**
+       * @brief Makes room for dependency searches that visit up to a number of Processors.
+       *
+       * Plugging into a Processor reorders its router, which searches everything upstream of it. Reserving the
+       * search space up front keeps connections made on the audio thread from allocating.
+       * @param num_processors Most Processors a dependency search can visit.
+       */
+      void reserveDependencies(int num_processors);
+
+      /**
+       * @brief Makes this router search for dependencies in another router's search space.
+       *
+       * Searches only happen on the thread changing the graph and one finishes before the next starts, so the
+       * routers of one graph can share a single reserved search space.
+       * @param other The router whose search space to use.
+       */
+      void shareDependencies(const ProcessorRouter* other);
+
       // Any time new dependencies are added into the ProcessorRouter graph, we
       // should call _connect_ on the destination Processor and source Output.
       /**
@@ -239,6 +269,15 @@ namespace vital {
        */
       void getDependencies(const Processor* processor) const;
 
+      /**
+       * @brief Checks whether the last getDependencies() call found a Processor upstream.
+       * @param processor The Processor to check.
+       * @return True if the Processor is in the last dependency search's results.
+       */
+      force_inline bool isDependency(const Processor* processor) const {
+        return processor->dependency_match_ == dependency_search_id_;
+      }
+
       // Returns the processor for this voice from the globally created one.
       /**
        * @brief Retrieves the local instance of a globally defined Processor.
@@ -262,8 +301,8 @@ namespace vital {
       int local_changes_;                    ///< Local change counter to track synchronization with global changes.
 
       std::shared_ptr<CircularQueue<const Processor*>> dependencies_;         ///< Queue for dependencies calculations.
-      std::shared_ptr<CircularQueue<const Processor*>> dependencies_visited_; ///< Queue of visited processors for dependencies calc.
       std::shared_ptr<CircularQueue<const Processor*>> dependency_inputs_;     ///< Queue of processors to check inputs for dependencies.
+      mutable int64_t dependency_search_id_;                                   ///< Id of the last dependency search.
 
       JUCE_LEAK_DETECTOR(ProcessorRouter)
   };
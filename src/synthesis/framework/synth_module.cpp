@@ -80,6 +80,9 @@ namespace vital {
     else
       control_switch->addProcessor(mono_total);
 
+    // Modulation connections plug in on the audio thread, so make room for all of them up front.
+    mono_total->reserveInputs(kMaxModulationConnections);
+
     addIdleMonoProcessor(control_switch);
 
     // Determine which path (no mod or modded) is active by default.
@@ -160,9 +163,46 @@ namespace vital {
     return control_rate_total;
   }
 
+  namespace {
+    /**
+     * @brief Creates the control rate processor that applies a parameter's value scale.
+     * @param details The parameter details holding the scale type and offset.
+     * @return The scaling processor, or nullptr if the parameter is linear.
+     */
+    Processor* createPolyModScale(const ValueDetails& details) {
+      if (details.value_scale == ValueDetails::kQuadratic) {
+        if (details.post_offset)
+          return new cr::Quadratic(details.post_offset);
+        return new cr::Square();
+      }
+      if (details.value_scale == ValueDetails::kCubic) {
+        VITAL_ASSERT(details.post_offset == 0.0f);
+        if (details.post_offset)
+          return new cr::Cubic(details.post_offset);
+        return new cr::Cube();
+      }
+      if (details.value_scale == ValueDetails::kQuartic) {
+        VITAL_ASSERT(details.post_offset == 0.0f);
+        if (details.post_offset)
+          return new cr::Quartic(details.post_offset);
+        return new cr::Quart();
+      }
+      if (details.value_scale == ValueDetails::kExponential)
+        return new cr::ExponentialScale(details.min, details.max, 2.0f, details.post_offset);
+      if (details.value_scale == ValueDetails::kSquareRoot)
+        return new cr::Root(details.post_offset);
+      return nullptr;
+    }
+  } // namespace
+
   /**
    * @brief Creates a named polyphonic mod control, optionally with smoothing,
    *        an internal mod, and additional resets. Applies post-scaling if requested.
+   *
+   * Scaled control rate parameters are scaled twice: once in the mono router for the
+   * unmodulated value and once per voice for the modulated sum. The ValueSwitch only
+   * enables the per voice sum and scale while the parameter has poly modulation, so
+   * unmodulated parameters cost nothing per voice.
    * @param name              Parameter name for the control.
    * @param audio_rate        If true, processes at audio rate.
    * @param smooth_value      If true, uses SmoothValue for the base control.
@@ -185,6 +225,7 @@ namespace vital {
     else
       poly_total = new cr::VariableAdd();
 
+    poly_total->reserveInputs(kMaxModulationConnections);
     addProcessor(poly_total);
     data_->poly_mod_destinations[name] = poly_total;
 
@@ -201,10 +242,25 @@ namespace vital {
 
     data_->poly_modulation_readout[name] = poly_total->output();
 
+    // Apply any final scaling if requested, to the mono base value and the per voice total separately.
+    Output* unmodulated = base_control;
+    Output* modulated = modulation_total->output();
+    Processor* poly_scale = audio_rate ? nullptr : createPolyModScale(details);
+    if (poly_scale) {
+      Processor* mono_scale = createPolyModScale(details);
+      mono_scale->plug(base_control);
+      addMonoProcessor(mono_scale);
+      unmodulated = mono_scale->output();
+
+      poly_scale->plug(modulation_total);
+      addProcessor(poly_scale);
+      modulated = poly_scale->output();
+    }
+
     // Use a ValueSwitch to toggle between no mod and modded output.
     ValueSwitch* control_switch = new ValueSwitch(0.0f);
-    control_switch->plugNext(base_control);
-    control_switch->plugNext(modulation_total);
+    control_switch->plugNext(unmodulated);
+    control_switch->plugNext(modulated);
 
     if (internal_modulation) {
       poly_total->plugNext(internal_modulation);
@@ -213,80 +269,27 @@ namespace vital {
     else {
       control_switch->addProcessor(poly_total);
       control_switch->addProcessor(modulation_total);
+      if (poly_scale)
+        control_switch->addProcessor(poly_scale);
       control_switch->set(0);
     }
     addIdleProcessor(control_switch);
     data_->poly_modulation_switches[name] = control_switch;
 
-    Output* control_rate_total = control_switch->output(ValueSwitch::kSwitch);
-
-    // If control rate, no further scaling is needed.
-    if (audio_rate)
-      return control_rate_total;
-
-    // Apply any final scaling if requested.
-    if (details.value_scale == ValueDetails::kQuadratic) {
-      Processor* scale = nullptr;
-      if (details.post_offset)
-        scale = new cr::Quadratic(details.post_offset);
-      else
-        scale = new cr::Square();
-
-      scale->plug(control_rate_total);
-      addProcessor(scale);
-      control_rate_total = scale->output();
-    }
-    else if (details.value_scale == ValueDetails::kCubic) {
-      Processor* scale = nullptr;
-      VITAL_ASSERT(details.post_offset == 0.0f);
-      if (details.post_offset)
-        scale = new cr::Cubic(details.post_offset);
-      else
-        scale = new cr::Cube();
-
-      scale->plug(control_rate_total);
-      addProcessor(scale);
-      control_rate_total = scale->output();
-    }
-    else if (details.value_scale == ValueDetails::kQuartic) {
-      Processor* scale = nullptr;
-      VITAL_ASSERT(details.post_offset == 0.0f);
-      if (details.post_offset)
-        scale = new cr::Quartic(details.post_offset);
-      else
-        scale = new cr::Quart();
-
-      scale->plug(control_rate_total);
-      addProcessor(scale);
-      control_rate_total = scale->output();
-    }
-    else if (details.value_scale == ValueDetails::kExponential) {
-      Processor* exponential = new cr::ExponentialScale(details.min, details.max, 2.0f, details.post_offset);
-      exponential->plug(control_rate_total);
-      addProcessor(exponential);
-      control_rate_total = exponential->output();
-    }
-    else if (details.value_scale == ValueDetails::kSquareRoot) {
-      cr::Root* root = new cr::Root(details.post_offset);
-      root->plug(control_rate_total);
-      addProcessor(root);
-      control_rate_total = root->output();
-    }
-
-    return control_rate_total;
+    return control_switch->output(ValueSwitch::kSwitch);
   }
 
   /**
    * @brief Creates a frequency/tempo switch for a named parameter.
    *        The user can switch between free-running frequency and tempo-synced frequency.
    * @param name             The parameter name (for creating internal controls).
-   * @param frequency        The Processor that provides the base frequency.
+   * @param frequency        The Output that provides the base frequency.
    * @param beats_per_second The BPM-based input (beats per second).
    * @param poly             If true, handles polyphonic logic for the tempo parameter.
    * @param midi             Optional MIDI input for keytracking if provided.
    * @return The final Output that selects tempo-based or frequency-based approach.
    */
-  Output* SynthModule::createTempoSyncSwitch(std::string name, Processor* frequency,
+  Output* SynthModule::createTempoSyncSwitch(std::string name, const Output* frequency,
                                              const Output* beats_per_second, bool poly, Input* midi) {
     Output* tempo = nullptr;
     if (poly)
@@ -371,6 +374,15 @@ namespace vital {
     return nullptr;
   }
 
+  std::map<std::string, Processor*> SynthModule::getProfiledProcessors() const {
+    std::map<std::string, Processor*> all_processors = data_->profiled_processors;
+    for (SynthModule* sub_module : data_->sub_modules) {
+      std::map<std::string, Processor*> sub_processors = sub_module->getProfiledProcessors();
+      all_processors.insert(sub_processors.begin(), sub_processors.end());
+    }
+    return all_processors;
+  }
+
   Processor* SynthModule::getModulationDestination(std::string name, bool poly) {
     Processor* poly_destination = getPolyModulationDestination(name);
     if (poly && poly_destination)
@@ -451,6 +463,38 @@ namespace vital {
       sub_module->updateAllModulationSwitches();
   }
 
+  void SynthModule::reserveModulationRouting() {
+    std::set<ProcessorRouter*> routers;
+    collectRouters(routers);
+
+    // A dependency search can't visit more Processors than the whole module holds.
+    int num_processors = 0;
+    for (ProcessorRouter* router : routers)
+      num_processors += router->numProcessors();
+
+    reserveDependencies(num_processors);
+    for (ProcessorRouter* router : routers)
+      router->shareDependencies(this);
+  }
+
+  void SynthModule::collectRouters(std::set<ProcessorRouter*>& routers) {
+    routers.insert(this);
+    routers.insert(getMonoRouter());
+    routers.insert(getPolyRouter());
+
+    for (auto& destination : data_->mono_mod_destinations) {
+      if (destination.second->router())
+        routers.insert(destination.second->router());
+    }
+    for (auto& destination : data_->poly_mod_destinations) {
+      if (destination.second->router())
+        routers.insert(destination.second->router());
+    }
+
+    for (SynthModule* sub_module : data_->sub_modules)
+      sub_module->collectRouters(routers);
+  }
+
   output_map& SynthModule::getModulationSources() {
     output_map& all_sources = data_->mod_sources;
     for (SynthModule* sub_module : data_->sub_modules) {
@@ -17,6 +17,7 @@
 #include <climits>
 #include <vector>
 #include <map>
+#include <set>
 #include <memory>
 #include <string>
 
@@ -108,6 +109,7 @@ namespace vital {
         control_map controls;                          ///< Map of control parameter names to Value Processors.
         output_map mod_sources;                        ///< Map of modulation source names to Outputs.
         std::map<std::string, std::unique_ptr<StatusOutput>> status_outputs; ///< Map of status outputs.
+        std::map<std::string, Processor*> profiled_processors; ///< Processors whose CPU use is reported.
         input_map mono_mod_destinations;               ///< Map of mono modulation destinations.
         input_map poly_mod_destinations;               ///< Map of poly modulation destinations.
         output_map mono_modulation_readout;            ///< Outputs used to read mono modulation totals.
@@ -164,6 +166,12 @@ namespace vital {
          */
         const StatusOutput* getStatusOutput(std::string name) const;
 
+        /**
+         * @brief Returns the named Processors whose CPU use is reported, from this module and its submodules.
+         * @return A map of names to Processors.
+         */
+        std::map<std::string, Processor*> getProfiledProcessors() const;
+
         /**
          * @brief Retrieves a modulation destination Processor by name and poly mode.
          * @param name The name of the modulation destination.
@@ -213,6 +221,15 @@ namespace vital {
          */
         void updateAllModulationSwitches();
 
+        /**
+         * @brief Reserves everything connecting modulations needs so it can happen on the audio thread.
+         *
+         * Modulation destinations reserve their inputs when they're created. This reserves one dependency search
+         * space big enough for the whole module and shares it with every router of this module and its
+         * submodules. Call it once the module is fully built.
+         */
+        void reserveModulationRouting();
+
         /**
          * @brief Returns a reference to the map of modulation sources.
          * @return A reference to the output_map of sources.
@@ -289,6 +306,12 @@ namespace vital {
         void addSubmodule(SynthModule* module) { data_->sub_modules.push_back(module); }
 
     protected:
+        /**
+         * @brief Adds the routers of this module, its submodules and their modulation destinations to a set.
+         * @param routers The set to add to.
+         */
+        void collectRouters(std::set<ProcessorRouter*>& routers);
+
         /**
          * @brief Creates a simple control processor for a given parameter name.
          * @param name The name of the parameter.
@@ -335,13 +358,13 @@ namespace vital {
         /**
          * @brief Creates a tempo sync switch that toggles between tempo-based frequency and free-running frequency.
          * @param name The parameter name prefix.
-         * @param frequency A Processor representing the base frequency.
+         * @param frequency The Output providing the base frequency.
          * @param beats_per_second Output representing beats per second (tempo).
          * @param poly True if polyphonic.
          * @param midi Optional Input for MIDI data, used for keytracking.
          * @return The resulting Output of the tempo sync switch.
          */
-        Output* createTempoSyncSwitch(std::string name, Processor* frequency,
+        Output* createTempoSyncSwitch(std::string name, const Output* frequency,
                                       const Output* beats_per_second, bool poly, Input* midi = nullptr);
 
         /**
@@ -351,6 +374,18 @@ namespace vital {
          */
         void createStatusOutput(std::string name, Output* source);
 
+        /**
+         * @brief Names a Processor whose CPU use is reported when built with VITAL_PROFILE.
+         * @param name The name to report the Processor under.
+         * @param processor The Processor to report.
+         */
+        void addProfiledProcessor(std::string name, Processor* processor) {
+            data_->profiled_processors[name] = processor;
+        #if VITAL_PROFILE
+            processor->profile()->tracked = true;
+        #endif
+        }
+
         std::shared_ptr<ModuleData> data_; ///< Shared data storage for this SynthModule.
 
         JUCE_LEAK_DETECTOR(SynthModule)
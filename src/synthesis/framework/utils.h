@@ -69,14 +69,14 @@ namespace vital {
          * @param max The maximum floating-point value (inclusive).
          */
         RandomGenerator(mono_float min, mono_float max)
-          : engine_(next_seed_++), distribution_(min, max) { }
+          : initial_seed_(next_seed_++), engine_(initial_seed_), distribution_(min, max) { }
 
         /**
          * @brief Copy constructor, but it re-seeds the engine for uniqueness.
          * @param other Another RandomGenerator to copy min/max from.
          */
         RandomGenerator(const RandomGenerator& other)
-          : engine_(next_seed_++),
+          : initial_seed_(next_seed_++), engine_(initial_seed_),
             distribution_(other.distribution_.min(), other.distribution_.max()) { }
 
         /**
@@ -134,7 +134,16 @@ namespace vital {
           engine_.seed(new_seed);
         }
 
+        /**
+         * @brief Restarts the sequence from the seed this generator was constructed with.
+         */
+        force_inline void reset() {
+          engine_.seed(initial_seed_);
+          distribution_.reset();
+        }
+
       private:
+        int initial_seed_;                                         ///< Seed assigned at construction.
         std::mt19937 engine_;                                      ///< Mersenne Twister engine.
         std::uniform_real_distribution<mono_float> distribution_;  ///< Uniform distribution.
 
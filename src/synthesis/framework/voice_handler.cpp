@@ -259,6 +259,7 @@ namespace vital {
 
   void VoiceHandler::processVoice(AggregateVoice* aggregate_voice, int num_samples) {
     // Simply run the shared processor for this set of voices.
+    VITAL_PROFILE_SCOPE(aggregate_voice->processor);
     aggregate_voice->processor->process(num_samples);
   }
 
@@ -422,6 +423,23 @@ namespace vital {
       aggregate_voice->processor->setSampleRate(sample_rate);
   }
 
+  void VoiceHandler::hardReset() {
+    // Kill every voice and hand voices out in their original order again, so the same notes land on
+    // the same aggregate voices and draw from the same random generators.
+    allSoundsOff();
+    last_played_note_ = -1.0f;
+    total_notes_ = 0;
+    free_voices_.clear();
+    for (auto& single_voice : all_voices_)
+      free_voices_.push_back(single_voice.get());
+
+    ProcessorRouter::hardReset();
+    voice_router_.hardReset();
+    global_router_.hardReset();
+    for (auto& aggregate_voice : all_aggregate_voices_)
+      aggregate_voice->processor->hardReset();
+  }
+
   int VoiceHandler::getNumActiveVoices() {
     return active_voices_.size();
   }
@@ -459,6 +459,12 @@ namespace vital {
        */
       virtual void setSampleRate(int sample_rate) override;
 
+      /**
+       * @brief Kills all voices, restores the voice allocation order and hard resets the mono and voice
+       *        routers along with every aggregated voice processor.
+       */
+      virtual void hardReset() override;
+
       /**
        * @brief Sets the custom Tuning object (if any) for note->frequency conversion.
        * @param tuning Pointer to a Tuning object.
@@ -2,9 +2,8 @@
  * @file lookup_table.h
  * @brief Declares a templated one-dimensional lookup table for fast function evaluation.
  *
- * This header defines a templated class that uses a precomputed lookup table to approximate
- * a given function. The lookup table can be accessed with cubic interpolation to provide
- * smooth and efficient evaluations.
+ * This header defines a templated class that uses precomputed cubic segments to approximate
+ * a given function, providing smooth and efficient evaluations.
  */
 
 #pragma once
@@ -18,9 +17,10 @@ namespace vital {
      * @class OneDimLookup
      * @brief A one-dimensional lookup table for a given function with a specified resolution.
      *
-     * The OneDimLookup class precomputes values of a given function at a certain resolution.
-     * It then provides a method to retrieve interpolated values using cubic interpolation, allowing
-     * for fast, smooth approximations of the function.
+     * The OneDimLookup class samples a given function at a certain resolution and stores the Catmull-Rom cubic
+     * through each segment between two samples as its polynomial coefficients. Each coefficient has its own
+     * array, so a lookup gathers one row per coefficient and evaluates the cubic directly without a transpose,
+     * allowing for fast, smooth approximations of the function.
      *
      * @tparam function A pointer to a function taking a mono_float and returning a mono_float.
      *                  This function will be sampled to build the lookup table.
@@ -29,7 +29,8 @@ namespace vital {
      */
     template<mono_float(*function)(mono_float), size_t resolution>
     class OneDimLookup {
-        static constexpr int kExtraValues = 4; ///< Extra values for safe interpolation at boundaries.
+        static constexpr int kExtraValues = 4;              ///< Extra samples for the boundary segments.
+        static constexpr int kNumSegments = resolution + 1; ///< Segments a clamped index can select.
     public:
         /**
          * @brief Constructs the lookup table by sampling the given function.
@@ -37,9 +38,23 @@ namespace vital {
          */
         OneDimLookup(float scale = 1.0f) {
             scale_ = resolution / scale;
+
+            double values[resolution + kExtraValues];
             for (int i = 0; i < static_cast<int>(resolution) + kExtraValues; ++i) {
                 mono_float t = (i - 1.0f) / (resolution - 1.0f);
-                lookup_[i] = function(t * scale);
+                values[i] = function(t * scale);
+            }
+
+            // Catmull-Rom cubic from values[i + 1] to values[i + 2] as c0 + c1 t + c2 t^2 + c3 t^3.
+            for (int i = 0; i < kNumSegments; ++i) {
+                double from = values[i];
+                double start = values[i + 1];
+                double end = values[i + 2];
+                double to = values[i + 3];
+                coefficients0_[i] = start;
+                coefficients1_[i] = 0.5 * (end - from);
+                coefficients2_[i] = from - 2.5 * start + 2.0 * end - 0.5 * to;
+                coefficients3_[i] = 0.5 * (to - from) + 1.5 * (start - end);
             }
         }
 
@@ -49,11 +64,11 @@ namespace vital {
         ~OneDimLookup() { }
 
         /**
-         * @brief Performs a cubic interpolation lookup on the precomputed data.
+         * @brief Performs a cubic interpolation lookup on the precomputed segments.
          *
-         * This function takes a poly_float of input values, scales them, and uses cubic
-         * interpolation to estimate the function's value at these points. It returns a poly_float
-         * with the interpolated results.
+         * This function takes a poly_float of input values, scales them, finds the segment each lane
+         * falls in and evaluates that segment's cubic. Where utils::toInt rounds the index up, the offset
+         * into the segment is negative and the cubic is extended back to the input.
          *
          * @param value The input poly_float values to lookup.
          * @return A poly_float containing the interpolated function values.
@@ -63,16 +78,28 @@ namespace vital {
             poly_int indices = utils::clamp(utils::toInt(boost), 0, static_cast<int>(resolution));
             poly_float t = boost - utils::toFloat(indices);
 
-            matrix interpolation_matrix = utils::getCatmullInterpolationMatrix(t);
-            matrix value_matrix = utils::getValueMatrix(lookup_, indices);
-            value_matrix.transpose();
-
-            return interpolation_matrix.multiplyAndSumRows(value_matrix);
+            poly_float result = utils::mulAdd(gather(coefficients2_, indices), gather(coefficients3_, indices), t);
+            result = utils::mulAdd(gather(coefficients1_, indices), result, t);
+            return utils::mulAdd(gather(coefficients0_, indices), result, t);
         }
 
     private:
-        mono_float lookup_[resolution + kExtraValues]; ///< The array holding the sampled function values.
-        mono_float scale_;                             ///< Scaling factor relating input range to lookup indices.
+        /**
+         * @brief Loads one coefficient of the segment each lane selected.
+         * @param coefficients The coefficient array to read from.
+         * @param indices The segment index of each lane.
+         * @return The coefficients as a poly_float.
+         */
+        static force_inline poly_float gather(const mono_float* coefficients, poly_int indices) {
+            return poly_float(coefficients[indices[0]], coefficients[indices[1]],
+                              coefficients[indices[2]], coefficients[indices[3]]);
+        }
+
+        mono_float coefficients0_[kNumSegments]; ///< Constant coefficient of each segment, the sampled values.
+        mono_float coefficients1_[kNumSegments]; ///< Linear coefficient of each segment.
+        mono_float coefficients2_[kNumSegments]; ///< Quadratic coefficient of each segment.
+        mono_float coefficients3_[kNumSegments]; ///< Cubic coefficient of each segment.
+        mono_float scale_;                       ///< Scaling factor relating input range to lookup indices.
 
         JUCE_LEAK_DETECTOR(OneDimLookup)
     };
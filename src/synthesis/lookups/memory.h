@@ -4,7 +4,8 @@
  *
  * The Memory and StereoMemory classes store a history of samples in a ring buffer and allow
  * retrieval of past samples using cubic interpolation. They are used to implement audio
- * feedback loops, delays, or other time-domain manipulations efficiently.
+ * feedback loops, delays, or other time-domain manipulations efficiently. SnapshotMemory hands
+ * blocks of samples from the audio thread to the interface.
  */
 
 #pragma once
@@ -12,6 +13,7 @@
 #include "common.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <memory>
 
@@ -83,6 +85,32 @@ namespace vital {
             VITAL_ASSERT(utils::isFinite(sample));
         }
 
+        /**
+         * @brief Pushes a block of samples into the memory, one channel at a time.
+         * @param samples The samples to push, one poly_float per sample.
+         * @param num_samples The number of samples to push, at most the memory size.
+         */
+        void pushBlock(const poly_float* samples, int num_samples) {
+            VITAL_ASSERT(num_samples <= static_cast<int>(size_));
+
+            int start = (offset_ + 1) & bitmask_;
+            int first_run = std::min<int>(num_samples, size_ - start);
+            for (int c = 0; c < static_cast<int>(kChannels); ++c) {
+                mono_float* buffer = buffers_[c];
+                mono_float* mirror = buffer + size_;
+                for (int i = 0; i < first_run; ++i) {
+                    buffer[start + i] = samples[i][c];
+                    mirror[start + i] = samples[i][c];
+                }
+                for (int i = first_run; i < num_samples; ++i) {
+                    buffer[i - first_run] = samples[i][c];
+                    mirror[i - first_run] = samples[i][c];
+                }
+            }
+
+            offset_ = (offset_ + num_samples) & bitmask_;
+        }
+
         /**
          * @brief Clears a specified number of samples in the memory for channels indicated by a mask.
          * @param num The number of samples to clear.
@@ -105,6 +133,25 @@ namespace vital {
             }
         }
 
+        /**
+         * @brief Copies the history of a smaller memory so reads continue from where it left off.
+         * @param other The memory to copy from. It can't be larger than this one.
+         */
+        void copyHistory(const MemoryTemplate& other) {
+            VITAL_ASSERT(other.size_ <= size_);
+            offset_ = other.offset_;
+            for (int c = 0; c < static_cast<int>(kChannels); ++c) {
+                const mono_float* source = other.buffers_[c];
+                mono_float* dest = buffers_[c];
+                for (int i = 0; i < static_cast<int>(other.size_); ++i) {
+                    mono_float value = source[(other.offset_ - i) & other.bitmask_];
+                    int index = (offset_ - i) & bitmask_;
+                    dest[index] = value;
+                    dest[index + size_] = value;
+                }
+            }
+        }
+
         /**
          * @brief Clears all samples in the memory for all channels.
          */
@@ -249,4 +296,69 @@ namespace vital {
         }
     };
 
+    /**
+     * @class SnapshotMemory
+     * @brief A triple buffered block of samples that one thread writes and another reads without locks.
+     *
+     * The writer fills the write buffer and publishes it, which trades it for the ready buffer. The reader
+     * trades the ready buffer for its own whenever something new was published. Neither side ever touches
+     * a buffer the other is using and nothing is copied.
+     */
+    class SnapshotMemory {
+    public:
+        /**
+         * @brief Constructs the three buffers, cleared to silence.
+         * @param size The number of samples in each buffer.
+         */
+        SnapshotMemory(int size) : size_(size), write_index_(0), ready_(1), read_index_(2) {
+            for (int b = 0; b < kNumBuffers; ++b) {
+                buffers_[b] = std::make_unique<poly_float[]>(size);
+                for (int i = 0; i < size; ++i)
+                    buffers_[b][i] = 0.0f;
+            }
+        }
+
+        /**
+         * @brief Gets the buffer the writer fills. Only the writing thread may call this.
+         * @return The write buffer.
+         */
+        poly_float* getWriteBuffer() { return buffers_[write_index_].get(); }
+
+        /**
+         * @brief Makes the write buffer available to the reader and starts a new write buffer.
+         *
+         * The new write buffer holds whatever was published two snapshots ago.
+         */
+        void publish() {
+            write_index_ = ready_.exchange(write_index_ | kFreshMask) & kIndexMask;
+        }
+
+        /**
+         * @brief Gets the most recently published buffer. Only the reading thread may call this.
+         * @return The buffer to read, valid until the next call.
+         */
+        const poly_float* getReadBuffer() {
+            if (ready_.load() & kFreshMask)
+                read_index_ = ready_.exchange(read_index_) & kIndexMask;
+            return buffers_[read_index_].get();
+        }
+
+        /**
+         * @brief Gets the number of samples in each buffer.
+         * @return The buffer size.
+         */
+        int getSize() const { return size_; }
+
+    private:
+        static constexpr int kNumBuffers = 3;
+        static constexpr int kIndexMask = 3;
+        static constexpr int kFreshMask = 4;
+
+        std::unique_ptr<poly_float[]> buffers_[kNumBuffers];
+        int size_;
+        int write_index_;
+        std::atomic<int> ready_;
+        int read_index_;
+    };
+
 } // namespace vital
@@ -11,12 +11,18 @@ namespace vital {
             frequency_domain[i] = 0.0f;
             time_domain[i] = 0.0f;
         }
+        time_domain_current_ = true;
+        frequency_domain_current_ = true;
     }
 
     void WaveFrame::multiply(mono_float value) {
-        for (int i = 0; i < kWaveformSize; ++i) {
-            time_domain[i] *= value;
-            frequency_domain[i] *= value;
+        if (time_domain_current_) {
+            for (int i = 0; i < kWaveformSize; ++i)
+                time_domain[i] *= value;
+        }
+        if (frequency_domain_current_) {
+            for (int i = 0; i < kWaveformSize; ++i)
+                frequency_domain[i] *= value;
         }
     }
 
@@ -28,6 +34,7 @@ namespace vital {
     }
 
     mono_float WaveFrame::getMaxZeroOffset() const {
+        VITAL_ASSERT(time_domain_current_);
         mono_float max = 0.0f;
         for (int i = 0; i < kWaveformSize; ++i)
             max = std::max(max, fabsf(time_domain[i]));
@@ -37,28 +44,36 @@ namespace vital {
 
     void WaveFrame::normalize(bool allow_positive_gain) {
         constexpr mono_float kMaxInverseMult = 0.0000001f;
+        ensureTimeDomain();
         mono_float max = getMaxZeroOffset();
         mono_float min = 1.0f;
         if (allow_positive_gain)
             min = kMaxInverseMult;
 
         mono_float normalization = 1.0f / std::max(min, max);
-        for (int i = 0; i < kWaveformSize; ++i)
-            time_domain[i] *= normalization;
+        multiply(normalization);
     }
 
     void WaveFrame::addFrom(WaveFrame* source) {
-        for (int i = 0; i < kWaveformSize; ++i) {
-            time_domain[i] += source->time_domain[i];
-            frequency_domain[i] += source->frequency_domain[i];
+        if (time_domain_current_) {
+            source->ensureTimeDomain();
+            for (int i = 0; i < kWaveformSize; ++i)
+                time_domain[i] += source->time_domain[i];
+        }
+        if (frequency_domain_current_) {
+            source->ensureFrequencyDomain();
+            for (int i = 0; i < kWaveformSize; ++i)
+                frequency_domain[i] += source->frequency_domain[i];
         }
     }
 
     void WaveFrame::copy(const WaveFrame* other) {
-        for (int i = 0; i < kWaveformSize; ++i) {
-            frequency_domain[i] = other->frequency_domain[i];
-            time_domain[i] = other->time_domain[i];
-        }
+        if (other->frequency_domain_current_)
+            memcpy(frequency_domain, other->frequency_domain, kWaveformSize * sizeof(std::complex<float>));
+        if (other->time_domain_current_)
+            memcpy(time_domain, other->time_domain, kWaveformSize * sizeof(mono_float));
+        time_domain_current_ = other->time_domain_current_;
+        frequency_domain_current_ = other->frequency_domain_current_;
     }
 
     void WaveFrame::toFrequencyDomain() {
@@ -72,6 +87,8 @@ namespace vital {
         memcpy(frequency_data, time_domain, kWaveformSize * sizeof(float));
         memset(frequency_data + kWaveformSize, 0, kWaveformSize * sizeof(float));
         FFT<kWaveformBits>::transform()->transformRealForward(frequency_data);
+        frequency_domain_current_ = true;
+        time_domain_current_ = true;
     }
 
     void WaveFrame::toTimeDomain() {
@@ -85,6 +102,8 @@ namespace vital {
         memcpy(time_domain, frequency_domain, 2 * kNumRealComplex * sizeof(float));
         memset(frequency_data + 2 * kNumRealComplex, 0, 2 * kNumExtraComplex * sizeof(float));
         FFT<kWaveformBits>::transform()->transformRealInverse(time_domain);
+        time_domain_current_ = true;
+        frequency_domain_current_ = true;
     }
 
     void WaveFrame::removedDc() {
@@ -94,6 +113,7 @@ namespace vital {
          * The DC offset is found in the imaginary component of the first frequency bin.
          * Subtracting this value from time_domain samples removes any constant offset.
          */
+        ensureBothDomains();
         float offset = frequency_domain[0].imag();
         frequency_domain[0] = 0.0f;
         for (int i = 0; i < kWaveformSize; ++i)
@@ -12,6 +12,11 @@ namespace vital {
      * A WaveFrame holds a waveform in both time-domain and frequency-domain forms.
      * It allows for operations such as normalization, clearing, transforming between
      * time and frequency domains, and other utility functions to manipulate or analyze the waveform.
+     *
+     * The frame keeps track of which of the two forms is current. Code that edits one domain in place can call
+     * markTimeDomainChanged() or markFrequencyDomainChanged() instead of transforming right away, and whoever reads
+     * the other domain later calls ensureTimeDomain() or ensureFrequencyDomain() first. That way a chain of edits in
+     * the same domain only pays for one transform at the end.
      */
     class WaveFrame {
     public:
@@ -34,11 +39,14 @@ namespace vital {
          * The waveform data is initialized to zero, and frequency/time domains are ready for loading or processing.
          */
         WaveFrame() : index(0), frequency_ratio(kDefaultFrequencyRatio), sample_rate(kDefaultSampleRate),
-                      time_domain(), frequency_domain() { }
+                      time_domain(), frequency_domain(),
+                      time_domain_current_(true), frequency_domain_current_(true) { }
 
         /**
          * @brief Retrieves the maximum absolute amplitude in the time-domain waveform.
          *
+         * The time domain must be current.
+         *
          * @return The maximum absolute sample value found in the time_domain array.
          */
         mono_float getMaxZeroOffset() const;
@@ -46,6 +54,8 @@ namespace vital {
         /**
          * @brief Normalizes the time-domain waveform samples to have a maximum absolute value of 1.0.
          *
+         * Brings the time domain up to date first. The frequency domain is scaled too if it's current.
+         *
          * @param allow_positive_gain If true, allows scaling up the waveform if it's below the
          *                            normalization threshold, otherwise only scales down.
          */
@@ -73,7 +83,7 @@ namespace vital {
         void setSampleRate(float rate) { sample_rate = rate; }
 
         /**
-         * @brief Multiplies all samples in both time and frequency domains by a given value.
+         * @brief Multiplies all samples in the current domains by a given value.
          *
          * @param value The value by which to scale the waveform data.
          */
@@ -89,12 +99,14 @@ namespace vital {
         /**
          * @brief Adds another WaveFrame's data to this one, sample-by-sample, in both time and frequency domains.
          *
+         * The source is brought up to date in whichever domains are current in this frame.
+         *
          * @param source Pointer to the source WaveFrame whose data will be added to this one.
          */
         void addFrom(WaveFrame* source);
 
         /**
-         * @brief Copies another WaveFrame's time and frequency domain data into this one.
+         * @brief Copies another WaveFrame's current domains into this one.
          *
          * @param other Pointer to the WaveFrame whose data will be copied.
          */
@@ -110,11 +122,57 @@ namespace vital {
          */
         void toTimeDomain();
 
+        /**
+         * @brief Records that time_domain was edited, so frequency_domain is out of date until it's needed.
+         */
+        void markTimeDomainChanged() {
+            time_domain_current_ = true;
+            frequency_domain_current_ = false;
+        }
+
+        /**
+         * @brief Records that frequency_domain was edited, so time_domain is out of date until it's needed.
+         */
+        void markFrequencyDomainChanged() {
+            frequency_domain_current_ = true;
+            time_domain_current_ = false;
+        }
+
+        /**
+         * @brief Converts from the frequency domain only if time_domain is out of date.
+         */
+        void ensureTimeDomain() {
+            if (!time_domain_current_)
+                toTimeDomain();
+        }
+
+        /**
+         * @brief Converts from the time domain only if frequency_domain is out of date.
+         */
+        void ensureFrequencyDomain() {
+            if (!frequency_domain_current_)
+                toFrequencyDomain();
+        }
+
+        /**
+         * @brief Brings both domains up to date, for consumers that read both.
+         */
+        void ensureBothDomains() {
+            ensureTimeDomain();
+            ensureFrequencyDomain();
+        }
+
+        /// Returns true if time_domain matches the latest edit.
+        bool isTimeDomainCurrent() const { return time_domain_current_; }
+
+        /// Returns true if frequency_domain matches the latest edit.
+        bool isFrequencyDomainCurrent() const { return frequency_domain_current_; }
+
         /**
          * @brief Removes the DC offset from the waveform.
          *
          * This modifies the time_domain samples by subtracting the DC component. The DC component
-         * is derived from the frequency_domain[0] bin.
+         * is derived from the frequency_domain[0] bin. Both domains are brought up to date first.
          */
         void removedDc();
 
@@ -131,6 +189,10 @@ namespace vital {
          */
         float* getFrequencyData() { return reinterpret_cast<float*>(frequency_domain); }
 
+    private:
+        bool time_domain_current_;      ///< False if time_domain hasn't caught up with a frequency domain edit.
+        bool frequency_domain_current_; ///< False if frequency_domain hasn't caught up with a time domain edit.
+
         JUCE_LEAK_DETECTOR(WaveFrame)
     };
 
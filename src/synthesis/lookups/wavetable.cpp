@@ -91,6 +91,7 @@ namespace vital {
     }
 
     void Wavetable::loadWaveFrame(const WaveFrame* wave_frame, int to_index) {
+        VITAL_ASSERT(wave_frame->isTimeDomainCurrent() && wave_frame->isFrequencyDomainCurrent());
         if (to_index >= current_data_->num_frames)
             return;
 
@@ -150,6 +151,19 @@ namespace vital {
         }
     }
 
+    void Wavetable::swapData(Wavetable* other) {
+        VITAL_ASSERT(max_frames_ == other->max_frames_);
+        VITAL_ASSERT(active_audio_data_.load() == nullptr && other->active_audio_data_.load() == nullptr);
+
+        int version = std::max(data_->version, other->data_->version) + 1;
+        name_.swap(other->name_);
+        author_.swap(other->author_);
+        data_.swap(other->data_);
+        std::swap(current_data_, other->current_data_);
+        std::swap(shepard_table_, other->shepard_table_);
+        data_->version = version;
+    }
+
     void Wavetable::loadFrequencyAmplitudes(const std::complex<float>* frequencies, int to_index) {
         // Convert complex frequencies to amplitude values.
         mono_float* amplitudes = (mono_float*)current_data_->frequency_amplitudes[to_index];
@@ -284,6 +284,7 @@ namespace vital {
          * @brief Load a WaveFrame into the wavetable at the frame index specified by the WaveFrame.
          *
          * @param wave_frame A pointer to the WaveFrame containing time-domain and frequency-domain data.
+         *                   Both domains must be current.
          */
         void loadWaveFrame(const WaveFrame* wave_frame);
 
@@ -291,6 +292,7 @@ namespace vital {
          * @brief Load a WaveFrame into the wavetable at a specific frame index.
          *
          * @param wave_frame A pointer to the WaveFrame containing time-domain and frequency-domain data.
+         *                   Both domains must be current.
          * @param to_index The index at which to place the WaveFrame data.
          */
         void loadWaveFrame(const WaveFrame* wave_frame, int to_index);
@@ -304,6 +306,17 @@ namespace vital {
          */
         void postProcess(float max_span);
 
+        /**
+         * @brief Exchange all frame data, names and Shepard mode with another wavetable.
+         *
+         * Used to swap a wavetable rendered off the audio thread into the engine. Neither wavetable may be in use
+         * by the audio thread, so call this between blocks. Nothing is allocated or freed. The incoming data gets
+         * a new version number so oscillators notice the change.
+         *
+         * @param other The wavetable to exchange data with. Must have the same maximum number of frames.
+         */
+        void swapData(Wavetable* other);
+
         /**
          * @brief Get the number of frames in the current wavetable data.
          *
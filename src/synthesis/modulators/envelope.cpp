@@ -15,6 +15,14 @@ namespace vital {
             release_power_(0.0f),
             sustain_(0.0f) { }
 
+    void Envelope::hardReset() {
+        current_value_ = 0.0f;
+        position_ = 0.0f;
+        value_ = 0.0f;
+        poly_state_ = 0.0f;
+        start_value_ = 0.0f;
+    }
+
     void Envelope::process(int num_samples) {
         // Determine if we should process at control rate or audio rate based on the Processor base class logic.
         if (isControlRate())
@@ -79,6 +79,11 @@ namespace vital {
          */
         virtual void process(int num_samples) override;
 
+        /**
+         * @brief Returns every lane to idle at zero so the next attack doesn't start from an old release tail.
+         */
+        virtual void hardReset() override;
+
     private:
         /**
          * @brief Processes the envelope in control-rate mode. This is typically used when
@@ -26,6 +26,13 @@ namespace vital {
         *sync_seconds_ = 0;
     }
 
+    void RandomLfo::hardReset() {
+        state_ = RandomState();
+        *shared_state_ = RandomState();
+        last_value_ = 0.0f;
+        random_generator_.reset();
+    }
+
     void RandomLfo::doReset(RandomState* state, bool mono, poly_float frequency) {
         /**
          * @brief Handles resetting the LFO if a reset trigger occurs.
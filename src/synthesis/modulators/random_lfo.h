@@ -98,6 +98,11 @@ namespace vital {
          */
         void process(int num_samples) override;
 
+        /**
+         * @brief Clears the random states and restarts the random sequence from its seed.
+         */
+        void hardReset() override;
+
         /**
          * @brief Processes the LFO using the given state.
          *
@@ -48,6 +48,14 @@ namespace vital {
          */
         virtual void process(int num_samples) override;
 
+        /**
+         * @brief Clears the held value and restarts the random sequence from its seed.
+         */
+        virtual void hardReset() override {
+            value_ = 0.0f;
+            random_generator_.reset();
+        }
+
     private:
         poly_float value_;                ///< The current random value output.
         utils::RandomGenerator random_generator_; ///< The random number generator used to produce new values.
@@ -17,7 +17,7 @@ namespace vital {
         wet_ = 0.0f;
         dry_ = 0.0f;
         last_num_voices_ = 0;
-        int max_samples = kMaxChorusDelay * kMaxSampleRate + 1;
+        int max_samples = kMaxChorusDelay * kDefaultSampleRate + 1;
 
         // Allocate delay lines and register their outputs for debugging or analysis.
         for (int i = 0; i < kMaxDelayPairs; ++i) {
@@ -34,7 +34,7 @@ namespace vital {
 
         // Create mod controls and link them with line generator or value sources.
         Output* free_frequency = createMonoModControl("chorus_frequency");
-        frequency_ = createTempoSyncSwitch("chorus", free_frequency->owner, beats_per_second_, false);
+        frequency_ = createTempoSyncSwitch("chorus", free_frequency, beats_per_second_, false);
         Output* feedback = createMonoModControl("chorus_feedback");
         wet_output_ = createMonoModControl("chorus_dry_wet");
         Output* cutoff = createMonoModControl("chorus_cutoff");
@@ -70,6 +70,31 @@ namespace vital {
         }
     }
 
+    void ChorusModule::hardReset() {
+        phase_ = 0.0f;
+        wet_ = 0.0f;
+        dry_ = 0.0f;
+
+        for (int i = 0; i < kMaxDelayPairs; ++i)
+            delays_[i]->hardReset();
+    }
+
+    void ChorusModule::setSampleRate(int sample_rate) {
+        SynthModule::setSampleRate(sample_rate);
+        setMaxDelaySamples();
+    }
+
+    void ChorusModule::setOversampleAmount(int oversample) {
+        SynthModule::setOversampleAmount(oversample);
+        setMaxDelaySamples();
+    }
+
+    void ChorusModule::setMaxDelaySamples() {
+        // Sized from each delay's own rate since that is what it converts delay times to samples with.
+        for (int i = 0; i < kMaxDelayPairs; ++i)
+            delays_[i]->setMaxSamples(kMaxChorusDelay * delays_[i]->getSampleRate() + 1);
+    }
+
     int ChorusModule::getNextNumVoicePairs() {
         int num_voice_pairs = voices_->value();
 
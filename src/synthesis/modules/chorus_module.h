@@ -46,6 +46,25 @@ namespace vital {
          */
         void enable(bool enable) override;
 
+        /**
+         * @brief Clears the delay lines, the wet/dry state and the modulation phase.
+         */
+        void hardReset() override;
+
+        /**
+         * @brief Sets the sample rate and resizes the delay lines to fit the longest chorus delay.
+         *
+         * @param sample_rate The new sample rate, in Hz.
+         */
+        void setSampleRate(int sample_rate) override;
+
+        /**
+         * @brief Sets the oversample amount and resizes the delay lines to fit the longest chorus delay.
+         *
+         * @param oversample The oversampling factor.
+         */
+        void setOversampleAmount(int oversample) override;
+
         /**
          * @brief Processes the input audio through the chorus effect.
          *
@@ -82,6 +101,11 @@ namespace vital {
         int getNextNumVoicePairs();
 
     protected:
+        /**
+         * @brief Sizes each delay line to hold kMaxChorusDelay at the rate that delay runs at.
+         */
+        void setMaxDelaySamples();
+
         const Output* beats_per_second_; ///< A reference for tempo synchronization.
         Value* voices_;                 ///< Control for the number of chorus voices.
 
@@ -16,7 +16,7 @@ namespace vital {
      */
     class CombModule : public SynthModule {
     public:
-        /// Maximum number of feedback samples in the comb filter.
+        /// Maximum number of feedback samples the comb filter memory can grow to.
         static constexpr int kMaxFeedbackSamples = 25000;
 
         /**
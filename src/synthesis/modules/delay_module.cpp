@@ -25,9 +25,9 @@ namespace vital {
 
         // Create mod controls and tempo sync switches for delay parameters.
         Output* free_frequency = createMonoModControl("delay_frequency");
-        Output* frequency = createTempoSyncSwitch("delay", free_frequency->owner, beats_per_second_, false);
+        Output* frequency = createTempoSyncSwitch("delay", free_frequency, beats_per_second_, false);
         Output* free_frequency_aux = createMonoModControl("delay_aux_frequency");
-        Output* frequency_aux = createTempoSyncSwitch("delay_aux", free_frequency_aux->owner, beats_per_second_, false);
+        Output* frequency_aux = createTempoSyncSwitch("delay_aux", free_frequency_aux, beats_per_second_, false);
         Output* feedback = createMonoModControl("delay_feedback");
         Output* wet = createMonoModControl("delay_dry_wet");
 
@@ -19,20 +19,22 @@ namespace vital {
         /**
          * @brief Initializes the internal processors and control parameters for the distortion and filter.
          *
-         * It creates a Distortion processor and links it to output. Then sets up the Drive and Mix controls,
-         * as well as filter parameters such as cutoff and resonance. The filter can be inserted before or after
-         * distortion depending on the filter_order_ parameter.
+         * It creates a Distortion processor and links it to output. Then sets up the Drive, Mix and anti-alias
+         * controls, as well as filter parameters such as cutoff and resonance. The filter can be inserted before
+         * or after distortion depending on the filter_order_ parameter.
          */
         distortion_ = new Distortion();
         distortion_->useOutput(output());
         addIdleProcessor(distortion_);
 
         Value* distortion_type = createBaseControl("distortion_type");
+        Value* anti_alias = createBaseControl("distortion_anti_alias");
         Output* distortion_drive = createMonoModControl("distortion_drive", true, true);
         distortion_mix_ = createMonoModControl("distortion_mix");
 
         distortion_->plug(distortion_type, Distortion::kType);
         distortion_->plug(distortion_drive, Distortion::kDrive);
+        distortion_->plug(anti_alias, Distortion::kAntiAlias);
 
         filter_order_ = createBaseControl("distortion_filter_order");
         Output* midi_cutoff = createMonoModControl("distortion_filter_cutoff", true, true);
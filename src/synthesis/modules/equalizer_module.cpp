@@ -10,7 +10,10 @@ namespace vital {
             low_mode_(nullptr), band_mode_(nullptr), high_mode_(nullptr),
             high_pass_(nullptr), low_shelf_(nullptr),
             notch_(nullptr), band_shelf_(nullptr),
-            low_pass_(nullptr), high_shelf_(nullptr) {
+            low_pass_(nullptr), high_shelf_(nullptr),
+            low_gain_(nullptr), band_gain_(nullptr), high_gain_(nullptr),
+            low_shelf_flat_(false), band_shelf_flat_(false), high_shelf_flat_(false),
+            audio_memory_enabled_(false) {
         audio_memory_ = std::make_shared<vital::StereoMemory>(vital::kAudioMemorySamples);
     }
 
@@ -48,8 +51,6 @@ namespace vital {
         addIdleProcessor(band_shelf_);
         addIdleProcessor(low_pass_);
         addIdleProcessor(high_shelf_);
-        low_pass_->useOutput(output()); // Final output from either low_pass_ or high_shelf_.
-        high_shelf_->useOutput(output());
 
         // Mode controls for switching filter types.
         low_mode_ = createBaseControl("eq_low_mode");
@@ -70,6 +71,9 @@ namespace vital {
         Output* low_decibels = createMonoModControl("eq_low_gain");
         Output* band_decibels = createMonoModControl("eq_band_gain");
         Output* high_decibels = createMonoModControl("eq_high_gain");
+        low_gain_ = low_decibels;
+        band_gain_ = band_decibels;
+        high_gain_ = high_decibels;
 
         // Configure each filter with the appropriate style and parameter mappings.
         high_pass_->plug(&kPass, DigitalSvf::kStyle);
@@ -155,22 +159,54 @@ namespace vital {
          * @brief Processes the input audio through the chosen filters for low, mid, and high bands.
          *
          * The module picks the appropriate filter (e.g., high-pass or low shelf for low band)
-         * based on the mode parameters, then processes audio in sequence: low section first, then band section,
-         * then high section. The final output samples are stored in both the output buffer and the internal stereo memory.
+         * based on the mode parameters, then runs the active ones in sequence in a single pass:
+         * low section first, then band section, then high section. A shelf at 0 dB is left out once it has
+         * finished moving there. The final output samples are stored in both the output buffer and the
+         * internal stereo memory.
          */
         SynthModule::process(num_samples);
 
-        Processor* low_processor = low_mode_->value() ? high_pass_ : low_shelf_;
-        Processor* band_processor = band_mode_->value() ? notch_ : band_shelf_;
-        Processor* high_processor = high_mode_->value() ? low_pass_ : high_shelf_;
-
-        // Chain the processing: low section -> band section -> high section
-        low_processor->processWithInput(audio_in, num_samples);
-        band_processor->processWithInput(low_processor->output()->buffer, num_samples);
-        high_processor->processWithInput(band_processor->output()->buffer, num_samples);
+        DigitalSvf* chain[kNumBands];
+        int num_filters = 0;
+        if (low_mode_->value())
+            chain[num_filters++] = high_pass_;
+        else if (isShelfActive(low_shelf_, low_gain_, low_shelf_flat_))
+            chain[num_filters++] = low_shelf_;
+
+        if (band_mode_->value())
+            chain[num_filters++] = notch_;
+        else if (isShelfActive(band_shelf_, band_gain_, band_shelf_flat_))
+            chain[num_filters++] = band_shelf_;
+
+        if (high_mode_->value())
+            chain[num_filters++] = low_pass_;
+        else if (isShelfActive(high_shelf_, high_gain_, high_shelf_flat_))
+            chain[num_filters++] = high_shelf_;
+
+        poly_float* audio_out = output()->buffer;
+        if (num_filters)
+            DigitalSvf::processChainBasic12(chain, num_filters, audio_in, audio_out, num_samples);
+        else
+            utils::copyBuffer(audio_out, audio_in, num_samples);
+
+        if (audio_memory_enabled_)
+            audio_memory_->pushBlock(audio_out, num_samples);
+    }
 
-        const poly_float* output_buffer = high_processor->output()->buffer;
-        for (int i = 0; i < num_samples; ++i)
-            audio_memory_->push(output_buffer[i]);
+    bool EqualizerModule::isShelfActive(DigitalSvf* shelf, const Output* decibels, bool& flat) {
+        /**
+         * @brief Decides whether a shelf needs processing this block.
+         *
+         * Once a shelf has processed a block ending at 0 dB its output is the input, so it stays out of the
+         * chain until its gain moves. Its state is cleared while it's skipped so it doesn't hold stale audio
+         * when it comes back.
+         */
+        bool was_flat = flat;
+        flat = poly_float::notEqual(decibels->buffer[0], 0.0f).anyMask() == 0;
+        if (flat && was_flat) {
+            shelf->reset(constants::kFullMask);
+            return false;
+        }
+        return true;
     }
 } // namespace vital
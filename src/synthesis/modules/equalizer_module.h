@@ -15,6 +15,9 @@ namespace vital {
      */
     class EqualizerModule : public SynthModule {
     public:
+        /// Number of bands, each run by one of its two filters.
+        static constexpr int kNumBands = 3;
+
         /**
          * @brief Constructs an EqualizerModule.
          */
@@ -53,7 +56,9 @@ namespace vital {
          *
          * The module chooses between different filter topologies (low shelf vs. high-pass, etc.)
          * based on the mode parameters and processes the audio in a chain: low section, then band section,
-         * then high section. The result is stored in the output buffer and also pushed into internal memory.
+         * then high section, all in one pass over the block. Shelves sitting at 0 dB pass audio through
+         * unchanged so they're skipped. The result is stored in the output buffer and also pushed into
+         * internal memory.
          *
          * @param audio_in Pointer to the input audio samples.
          * @param num_samples The number of samples to process.
@@ -74,7 +79,26 @@ namespace vital {
          */
         const StereoMemory* getAudioMemory() { return audio_memory_.get(); }
 
+        /**
+         * @brief Turns recording the output into the audio memory on or off.
+         *
+         * The memory only feeds the interface's spectrogram so it stays off while nothing reads it.
+         *
+         * @param enable True to record the output.
+         */
+        void enableAudioMemory(bool enable) { audio_memory_enabled_ = enable; }
+
     protected:
+        /**
+         * @brief Checks whether a shelf has to run this block and updates its flat state.
+         *
+         * @param shelf The shelf filter.
+         * @param decibels The shelf's gain control.
+         * @param flat Whether the shelf's last processed block ended at 0 dB. Updated for this block.
+         * @return False if the shelf is at 0 dB and already was, so it can be skipped.
+         */
+        bool isShelfActive(DigitalSvf* shelf, const Output* decibels, bool& flat);
+
         Value* low_mode_;   ///< Determines if the low band uses a shelf or a high-pass filter.
         Value* band_mode_;  ///< Determines if the mid band uses a shelf or a notch filter.
         Value* high_mode_;  ///< Determines if the high band uses a shelf or a low-pass filter.
@@ -86,7 +110,16 @@ namespace vital {
         DigitalSvf* low_pass_;    ///< Low-pass filter for high band mode.
         DigitalSvf* high_shelf_;  ///< High shelf filter for high band mode.
 
+        Output* low_gain_;   ///< Gain of the low shelf in decibels.
+        Output* band_gain_;  ///< Gain of the band shelf in decibels.
+        Output* high_gain_;  ///< Gain of the high shelf in decibels.
+
+        bool low_shelf_flat_;   ///< Whether the low shelf's last processed block ended at 0 dB.
+        bool band_shelf_flat_;  ///< Whether the band shelf's last processed block ended at 0 dB.
+        bool high_shelf_flat_;  ///< Whether the high shelf's last processed block ended at 0 dB.
+
         std::shared_ptr<StereoMemory> audio_memory_; ///< Memory buffer for storing processed audio samples.
+        bool audio_memory_enabled_;                  ///< Whether the output is recorded into audio_memory_.
 
         JUCE_LEAK_DETECTOR(EqualizerModule)
     };
@@ -24,6 +24,7 @@ namespace vital {
         filter_1_ = new FilterModule("filter_1");
         addSubmodule(filter_1_);
         addProcessor(filter_1_);
+        addProfiledProcessor("filter_1", filter_1_);
 
         filter_1_->plug(filter_1_input_.get(), FilterModule::kAudio);
         filter_1_->useInput(input(kReset), FilterModule::kReset);
@@ -34,6 +35,7 @@ namespace vital {
         filter_2_ = new FilterModule("filter_2");
         addSubmodule(filter_2_);
         addProcessor(filter_2_);
+        addProfiledProcessor("filter_2", filter_2_);
 
         filter_2_->plug(filter_2_input_.get(), FilterModule::kAudio);
         filter_2_->useInput(input(kReset), FilterModule::kReset);
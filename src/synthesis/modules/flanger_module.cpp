@@ -20,16 +20,15 @@ namespace vital {
          * It creates modulation controls for frequency, depth, center delay, feedback, wet/dry mix,
          * and a phase offset for stereo effects. The StereoDelay is configured to be unfiltered and clamped.
          */
-        static constexpr int kMaxSamples = 40000;
         static const cr::Value kDelayStyle(StereoDelay::kClampedUnfiltered);
 
-        delay_ = new StereoDelay(kMaxSamples);
+        delay_ = new StereoDelay(kMaxFlangerDelay * kDefaultSampleRate + 1);
         addIdleProcessor(delay_);
         phase_ = 0.0f;
         delay_->useOutput(output(kAudioOutput));
 
         Output* free_frequency = createMonoModControl("flanger_frequency");
-        frequency_ = createTempoSyncSwitch("flanger", free_frequency->owner, beats_per_second_, false);
+        frequency_ = createTempoSyncSwitch("flanger", free_frequency, beats_per_second_, false);
         center_ = createMonoModControl("flanger_center");
         Output* feedback = createMonoModControl("flanger_feedback");
         Output* wet = createMonoModControl("flanger_dry_wet");
@@ -77,6 +76,22 @@ namespace vital {
         delay_->processWithInput(audio_in, num_samples);
     }
 
+    void FlangerModule::setSampleRate(int sample_rate) {
+        SynthModule::setSampleRate(sample_rate);
+        setMaxDelaySamples();
+    }
+
+    void FlangerModule::setOversampleAmount(int oversample) {
+        SynthModule::setOversampleAmount(oversample);
+        setMaxDelaySamples();
+    }
+
+    void FlangerModule::setMaxDelaySamples() {
+        // The delay converts delay times to samples at its own rate, so that is what it is sized from.
+        if (delay_)
+            delay_->setMaxSamples(kMaxFlangerDelay * delay_->getSampleRate() + 1);
+    }
+
     void FlangerModule::correctToTime(double seconds) {
         /**
          * @brief Aligns the flanger modulation phase to a given time, useful for sync to host timelines.
@@ -19,6 +19,8 @@ namespace vital {
         static constexpr mono_float kFlangerDelayRange = 0.01f;
         static constexpr mono_float kFlangerCenter = kFlangerDelayRange * 0.5f + 0.0005f;
         static constexpr mono_float kModulationDelayBuffer = 0.0005f;
+        // Longest delay the flanger can reach in seconds, at the lowest center and full modulation depth.
+        static constexpr mono_float kMaxFlangerDelay = 0.2f;
 
         /**
          * @brief Indices of outputs generated by the FlangerModule.
@@ -50,9 +52,12 @@ namespace vital {
         void init() override;
 
         /**
-         * @brief Performs a hard reset of the flanger's delay line, clearing any internal buffers.
+         * @brief Performs a hard reset of the flanger's delay line and modulation phase.
          */
-        void hardReset() override { delay_->hardReset(); }
+        void hardReset() override {
+            phase_ = 0.0f;
+            delay_->hardReset();
+        }
 
         /**
          * @brief Enables or disables the module, resetting the delay if disabled.
@@ -79,6 +84,20 @@ namespace vital {
          */
         void processWithInput(const poly_float* audio_in, int num_samples) override;
 
+        /**
+         * @brief Sets the sample rate and resizes the delay line to fit the longest flanger delay.
+         *
+         * @param sample_rate The new sample rate, in Hz.
+         */
+        void setSampleRate(int sample_rate) override;
+
+        /**
+         * @brief Sets the oversample amount and resizes the delay line to fit the longest flanger delay.
+         *
+         * @param oversample The oversampling factor.
+         */
+        void setOversampleAmount(int oversample) override;
+
         /**
          * @brief Adjusts the internal modulation phase to align with a given time, useful for syncing to host time.
          *
@@ -93,6 +112,11 @@ namespace vital {
         Processor* clone() const override { VITAL_ASSERT(false); return nullptr; }
 
     protected:
+        /**
+         * @brief Sizes the delay line to hold kMaxFlangerDelay at the rate the delay runs at.
+         */
+        void setMaxDelaySamples();
+
         const Output* beats_per_second_; ///< Reference output for tempo sync.
         Output* frequency_;              ///< The flanger frequency parameter (possibly tempo-synced).
         Output* phase_offset_;           ///< Controls stereo phase offset for left/right channels.
@@ -35,7 +35,7 @@ namespace vital {
 
         // Create a tempo-sync switch for frequency if needed.
         // The 'true' at the end indicates this frequency depends on MIDI input.
-        Output* frequency = createTempoSyncSwitch(prefix_, free_frequency->owner, beats_per_second_, true, input(kMidi));
+        Output* frequency = createTempoSyncSwitch(prefix_, free_frequency, beats_per_second_, true, input(kMidi));
 
         // Use the note trigger and note count inputs:
         lfo_->useInput(input(kNoteTrigger), SynthLfo::kNoteTrigger);
@@ -34,7 +34,7 @@ namespace vital {
 
         // Create parameter controls for the phaser.
         Output* phaser_free_frequency = createMonoModControl("phaser_frequency");
-        Output* phaser_frequency = createTempoSyncSwitch("phaser", phaser_free_frequency->owner,
+        Output* phaser_frequency = createTempoSyncSwitch("phaser", phaser_free_frequency,
                                                          beats_per_second_, false);
         Output* phaser_feedback = createMonoModControl("phaser_feedback");
         Output* phaser_wet = createMonoModControl("phaser_dry_wet");
@@ -16,6 +16,7 @@ namespace vital {
             oscillators_[i] = new OscillatorModule("osc_" + number);
             addSubmodule(oscillators_[i]);
             addProcessor(oscillators_[i]);
+            addProfiledProcessor("osc_" + number, oscillators_[i]);
             oscillators_[i]->enable(false);
             oscillator_destinations_[i] = nullptr;
         }
@@ -24,6 +25,7 @@ namespace vital {
         sampler_ = new SampleModule();
         addSubmodule(sampler_);
         addProcessor(sampler_);
+        addProfiledProcessor("sample", sampler_);
         sampler_->enable(false);
     }
 
@@ -30,7 +30,7 @@ namespace vital {
         Value* stereo = createBaseControl(prefix_ + "_stereo");
         Value* sync_type = createBaseControl(prefix_ + "_sync_type");
 
-        Output* frequency = createTempoSyncSwitch(prefix_, free_frequency->owner, beats_per_second_, true, input(kMidi));
+        Output* frequency = createTempoSyncSwitch(prefix_, free_frequency, beats_per_second_, true, input(kMidi));
         lfo_->useInput(input(kNoteTrigger), RandomLfo::kReset);
         lfo_->useOutput(output());
         lfo_->plug(frequency, RandomLfo::kFrequency);
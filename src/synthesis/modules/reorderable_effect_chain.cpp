@@ -90,6 +90,7 @@ namespace vital {
 
             addSubmodule(effect_module);
             addProcessor(effect_module);
+            addProfiledProcessor(strings::kEffectOrder[i], effect_module);
             effects_on_[i] = createBaseControl(strings::kEffectOrder[i] + "_on");
             effects_[i] = effect_module;
             effect_order_[i] = i;
@@ -170,6 +171,7 @@ namespace vital {
                 effects_[index]->enable(on);
 
             if (on) {
+                VITAL_PROFILE_SCOPE(effects_[index]);
                 effects_[index]->processWithInput(audio_in, num_samples);
                 audio_in = effects_[index]->output(0)->buffer;
             }
@@ -187,6 +189,15 @@ namespace vital {
             effects_[i]->hardReset();
     }
 
+    /**
+     * @brief Turns recording the equalizer output into its memory on or off.
+     *
+     * @param enable True if something reads the equalizer memory.
+     */
+    void ReorderableEffectChain::enableEqualizerMemory(bool enable) {
+        static_cast<EqualizerModule*>(effects_[constants::kEq])->enableAudioMemory(enable);
+    }
+
     /**
      * @brief Corrects the time-dependent parameters of all effects to the given time.
      *
@@ -89,6 +89,13 @@ namespace vital {
          */
         const StereoMemory* getEqualizerMemory() { return equalizer_memory_; }
 
+        /**
+         * @brief Turns recording the equalizer output into its memory on or off.
+         *
+         * @param enable True if something reads the equalizer memory.
+         */
+        void enableEqualizerMemory(bool enable);
+
     protected:
         /**
          * @brief Creates an effect module based on a given index.
@@ -1,4 +1,5 @@
 #include "reverb_module.h"
+#include "convolution_reverb.h"
 #include "reverb.h"
 
 namespace vital {
@@ -8,7 +9,8 @@ namespace vital {
      *
      * Initializes the module with no inputs and a single output channel.
      */
-    ReverbModule::ReverbModule() : SynthModule(0, 1), reverb_(nullptr) { }
+    ReverbModule::ReverbModule() : SynthModule(0, 1), reverb_(nullptr), convolution_reverb_(nullptr),
+                                   style_(nullptr), last_style_(0) { }
 
     /**
      * @brief Destructor for ReverbModule.
@@ -21,12 +23,19 @@ namespace vital {
      *
      * The controls include decay time, pre and post filtering (low/high shelf), size, delay, wet mix,
      * and chorus modulation parameters. After connecting these parameters, the reverb is ready for use.
+     * The convolution processor shares the output and dry/wet control and is selected by the style control.
      */
     void ReverbModule::init() {
         reverb_ = new Reverb();
         reverb_->useOutput(output());
         addIdleProcessor(reverb_);
 
+        convolution_reverb_ = new ConvolutionReverb();
+        convolution_reverb_->useOutput(output());
+        addIdleProcessor(convolution_reverb_);
+
+        style_ = createBaseControl("reverb_style");
+
         // Create controls for reverb parameters.
         Output* reverb_decay_time = createMonoModControl("reverb_decay_time");
         Output* reverb_pre_low_cutoff = createMonoModControl("reverb_pre_low_cutoff");
@@ -54,6 +63,7 @@ namespace vital {
         reverb_->plug(reverb_delay, Reverb::kDelay);
         reverb_->plug(reverb_size, Reverb::kSize);
         reverb_->plug(reverb_wet, Reverb::kWet);
+        convolution_reverb_->plug(reverb_wet, ConvolutionReverb::kWet);
 
         SynthModule::init();
     }
@@ -63,6 +73,7 @@ namespace vital {
      */
     void ReverbModule::hardReset() {
         reverb_->hardReset();
+        convolution_reverb_->hardReset();
     }
 
     /**
@@ -76,7 +87,7 @@ namespace vital {
         SynthModule::enable(enable);
         process(1);  // Process a single sample to update state if enabling
         if (!enable)
-            reverb_->hardReset();
+            hardReset();
     }
 
     /**
@@ -89,6 +100,7 @@ namespace vital {
     void ReverbModule::setSampleRate(int sample_rate) {
         SynthModule::setSampleRate(sample_rate);
         reverb_->setSampleRate(sample_rate);
+        convolution_reverb_->setSampleRate(sample_rate);
     }
 
     /**
@@ -99,6 +111,29 @@ namespace vital {
      */
     void ReverbModule::processWithInput(const poly_float* audio_in, int num_samples) {
         SynthModule::process(num_samples);
-        reverb_->processWithInput(audio_in, num_samples);
+
+        // Clear the style we're switching to so it doesn't resume with stale audio.
+        int style = static_cast<int>(style_->value());
+        if (style != last_style_) {
+            if (style)
+                convolution_reverb_->hardReset();
+            else
+                reverb_->hardReset();
+            last_style_ = style;
+        }
+
+        if (style)
+            convolution_reverb_->processWithInput(audio_in, num_samples);
+        else
+            reverb_->processWithInput(audio_in, num_samples);
+    }
+
+    /**
+     * @brief Gets the impulse response used by the convolution style.
+     *
+     * @return A pointer to the ImpulseResponse.
+     */
+    ImpulseResponse* ReverbModule::getImpulseResponse() {
+        return convolution_reverb_->getImpulseResponse();
     }
 } // namespace vital
@@ -5,14 +5,17 @@
 
 namespace vital {
 
+    class ConvolutionReverb;
+    class ImpulseResponse;
     class Reverb;
 
     /**
      * @brief A module that applies a reverb effect to an audio signal.
      *
      * The ReverbModule manages a Reverb processor, providing parameters for decay time,
-     * filtering, chorus modulation within the reverb tail, and dry/wet mix. It integrates
-     * into the synthesis graph as a SynthModule.
+     * filtering, chorus modulation within the reverb tail, and dry/wet mix. The style control
+     * switches to a ConvolutionReverb that convolves with a loaded impulse response instead.
+     * It integrates into the synthesis graph as a SynthModule.
      */
     class ReverbModule : public SynthModule {
     public:
@@ -76,8 +79,18 @@ namespace vital {
          */
         Processor* clone() const override { return new ReverbModule(*this); }
 
+        /**
+         * @brief Gets the impulse response used by the convolution style.
+         *
+         * @return A pointer to the ImpulseResponse.
+         */
+        ImpulseResponse* getImpulseResponse();
+
     protected:
         Reverb* reverb_; /**< The internal reverb processor instance. */
+        ConvolutionReverb* convolution_reverb_; /**< The convolution processor used by the convolution style. */
+        Value* style_; /**< Selects between the feedback network and convolution styles. */
+        int last_style_; /**< Style used in the previous block, to reset when switching. */
 
         JUCE_LEAK_DETECTOR(ReverbModule)
     };
@@ -71,6 +71,7 @@ namespace vital {
       macros[i] = createMonoModControl("macro_control_" + std::to_string(i + 1));
 
     setVoiceKiller(amplitude_->output());
+    addProfiledProcessor("voices", getPolyRouter());
 
     for (int i = 0; i < vital::kMaxModulationConnections; ++i) {
       ModulationConnectionProcessor* processor = modulation_bank_.atIndex(i)->modulation_processor.get();
@@ -157,6 +158,7 @@ namespace vital {
       LfoModule* lfo = new LfoModule(prefix, &lfo_sources_[i], beats_per_second_);
       addSubmodule(lfo);
       addProcessor(lfo);
+      addProfiledProcessor(prefix, lfo);
       lfos_[i] = lfo;
       lfo->plug(retrigger(), LfoModule::kNoteTrigger);
       lfo->plug(note_count(), LfoModule::kNoteCount);
@@ -174,6 +176,7 @@ namespace vital {
       envelope->plug(retrigger(), EnvelopeModule::kTrigger);
       addSubmodule(envelope);
       addProcessor(envelope);
+      addProfiledProcessor(prefix, envelope);
       envelopes_[i] = envelope;
 
       data_->mod_sources[prefix] = envelope->output();
@@ -192,6 +195,7 @@ namespace vital {
       random_lfos_[i]->plug(bent_midi_, RandomLfoModule::kMidi);
       addSubmodule(random_lfos_[i]);
       addProcessor(random_lfos_[i]);
+      addProfiledProcessor(name, random_lfos_[i]);
     }
 
     stereo_ = new cr::Value(constants::kLeftOne);
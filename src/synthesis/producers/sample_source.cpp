@@ -284,6 +284,223 @@ namespace vital {
         current_size = next_size;
       }
     }
+
+    /**
+     * @brief Gathers four interpolation taps per lane from a streamed sample.
+     *
+     * Mirrors utils::getValueMatrix() on the padded in-memory buffers, so @p indices are padded buffer
+     * indices offset by Sample::kBufferSamples.
+     */
+    force_inline matrix getStreamValueMatrix(const SampleStream* stream, const int* levels, const int* channels,
+                                             poly_int indices, bool wrap) {
+      static constexpr int kNumTaps = 4;
+
+      poly_float rows[kNumTaps];
+      for (int i = 0; i < kNumTaps; ++i) {
+        int start = indices[i] - Sample::kBufferSamples;
+        for (int t = 0; t < kNumTaps; ++t)
+          rows[i].set(t, stream->read(levels[i], channels[i], start + t, wrap));
+      }
+      return matrix(rows[0], rows[1], rows[2], rows[3]);
+    }
+  }
+
+  //==================  SampleStream Implementation  =======================//
+
+  class SampleStream::Reader : public Thread {
+    public:
+      Reader(SampleStream* stream) : Thread("Sample Stream Reader"), stream_(stream) { }
+
+      void run() override {
+        while (!threadShouldExit()) {
+          stream_->service();
+          wait(kPollMilliseconds);
+        }
+      }
+
+    private:
+      SampleStream* stream_;
+  };
+
+  std::unique_ptr<SampleStream> SampleStream::open(const std::string& path, int max_cached_pages) {
+    File file(path);
+    if (!file.existsAsFile())
+      return nullptr;
+
+    AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+    std::unique_ptr<AudioFormatReader> reader(format_manager.createReaderFor(file));
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->lengthInSamples > kMaxLength ||
+        reader->numChannels == 0 || reader->sampleRate <= 0.0) {
+      return nullptr;
+    }
+
+    std::unique_ptr<SampleStream> stream(new SampleStream(std::move(reader), path, max_cached_pages));
+    stream->computeOverview();
+    stream->preload();
+    stream->reader_thread_->startThread();
+    return stream;
+  }
+
+  SampleStream::SampleStream(std::unique_ptr<AudioFormatReader> reader, const std::string& path,
+                             int max_cached_pages) :
+      path_(path), reader_(std::move(reader)), max_cached_pages_(max_cached_pages), audio_sequence_(0) {
+    length_ = static_cast<int>(reader_->lengthInSamples);
+    sample_rate_ = static_cast<int>(reader_->sampleRate);
+    num_channels_ = std::min<int>(reader_->numChannels, kMaxChannels);
+    num_pages_ = (length_ + kPageSize - 1) / kPageSize;
+    num_pinned_pages_ = std::min(num_pages_, static_cast<int>(kPreloadSeconds * sample_rate_) / kPageSize + 1);
+
+    level_lengths_[0] = 2 * length_;
+    level_lengths_[1] = length_;
+    for (int i = 2; i < kNumLevels; ++i)
+      level_lengths_[i] = (level_lengths_[i - 1] + 1) / 2;
+
+    pages_ = std::make_unique<std::atomic<Page*>[]>(num_pages_);
+    owned_pages_ = std::make_unique<std::unique_ptr<Page>[]>(num_pages_);
+    last_used_ = std::make_unique<std::atomic<int>[]>(num_pages_);
+    wanted_ = std::make_unique<std::atomic<bool>[]>(num_pages_);
+    for (int i = 0; i < num_pages_; ++i) {
+      pages_[i] = nullptr;
+      last_used_[i] = 0;
+      wanted_[i] = false;
+    }
+
+    overview_ = std::make_unique<mono_float[]>(kOverviewSize);
+    eviction_candidates_.reserve(num_pages_ - num_pinned_pages_);
+    reader_thread_ = std::make_unique<Reader>(this);
+  }
+
+  SampleStream::~SampleStream() {
+    reader_thread_->stopThread(-1);
+  }
+
+  void SampleStream::request(int position, bool backward, bool wrap) {
+    int stamp = audio_sequence_.load(std::memory_order_relaxed);
+    int page = position >> kPageBits;
+    int direction = backward ? -1 : 1;
+
+    for (int i = 0; i <= kReadAheadPages; ++i) {
+      int next_page = page + i * direction;
+      if (wrap)
+        next_page = (next_page % num_pages_ + num_pages_) % num_pages_;
+      else if (next_page < 0 || next_page >= num_pages_)
+        break;
+
+      last_used_[next_page].store(stamp, std::memory_order_relaxed);
+      if (pages_[next_page].load(std::memory_order_relaxed) == nullptr)
+        wanted_[next_page].store(true, std::memory_order_relaxed);
+    }
+  }
+
+  int SampleStream::numResidentPages() const {
+    int total = 0;
+    for (int i = 0; i < num_pages_; ++i) {
+      if (pages_[i].load() != nullptr)
+        total++;
+    }
+    return total;
+  }
+
+  void SampleStream::service() {
+    for (int i = num_pinned_pages_; i < num_pages_; ++i) {
+      if (wanted_[i].exchange(false) && owned_pages_[i] == nullptr)
+        loadPage(i);
+    }
+
+    evictPages();
+  }
+
+  void SampleStream::preload() {
+    for (int i = 0; i < num_pinned_pages_; ++i)
+      loadPage(i);
+  }
+
+  void SampleStream::loadPage(int page) {
+    int chunk_size = kPageSize + 2 * kPageMargin;
+    int64 chunk_start = static_cast<int64>(page) * kPageSize - kPageMargin;
+
+    std::unique_ptr<mono_float[]> chunks[kMaxChannels];
+    mono_float* channels[kMaxChannels];
+    for (int c = 0; c < num_channels_; ++c) {
+      chunks[c] = std::make_unique<mono_float[]>(chunk_size);
+      channels[c] = chunks[c].get();
+    }
+    reader_->read(channels, num_channels_, chunk_start, chunk_size);
+
+    std::unique_ptr<Page> result = std::make_unique<Page>();
+    for (int c = 0; c < num_channels_; ++c) {
+      std::unique_ptr<mono_float[]> levels[kNumLevels];
+      int sizes[kNumLevels];
+      sizes[0] = 2 * chunk_size;
+      sizes[1] = chunk_size;
+      levels[0] = std::make_unique<mono_float[]>(sizes[0]);
+      levels[1] = std::move(chunks[c]);
+      upsample(levels[1].get(), levels[0].get(), sizes[1], sizes[0]);
+
+      for (int l = 2; l < kNumLevels; ++l) {
+        sizes[l] = (sizes[l - 1] + 1) / 2;
+        levels[l] = std::make_unique<mono_float[]>(sizes[l]);
+        downsample(levels[l - 1].get(), levels[l].get(), sizes[l - 1], sizes[l]);
+      }
+
+      for (int l = 0; l < kNumLevels; ++l) {
+        int span = (2 * kPageSize) >> l;
+        int offset = (2 * kPageMargin) >> l;
+        result->levels[l][c] = std::make_unique<mono_float[]>(span);
+        memcpy(result->levels[l][c].get(), levels[l].get() + offset, span * sizeof(mono_float));
+      }
+    }
+
+    owned_pages_[page] = std::move(result);
+    pages_[page].store(owned_pages_[page].get(), std::memory_order_release);
+  }
+
+  void SampleStream::evictPages() {
+    std::vector<std::pair<int, int>>& resident = eviction_candidates_;
+    resident.clear();
+    for (int i = num_pinned_pages_; i < num_pages_; ++i) {
+      if (owned_pages_[i])
+        resident.emplace_back(last_used_[i].load(std::memory_order_relaxed), i);
+    }
+
+    int num_evicted = static_cast<int>(resident.size()) - max_cached_pages_;
+    if (num_evicted <= 0)
+      return;
+
+    std::partial_sort(resident.begin(), resident.begin() + num_evicted, resident.end());
+    for (int i = 0; i < num_evicted; ++i)
+      pages_[resident[i].second].store(nullptr);
+
+    waitForAudioThread();
+
+    for (int i = 0; i < num_evicted; ++i)
+      owned_pages_[resident[i].second] = nullptr;
+  }
+
+  void SampleStream::waitForAudioThread() {
+    int sequence = audio_sequence_.load();
+    if (sequence % 2 == 0)
+      return;
+
+    while (audio_sequence_.load() == sequence)
+      std::this_thread::yield(); // Wait for audio thread to finish reading unlinked pages.
+  }
+
+  void SampleStream::computeOverview() {
+    int window = std::min(kOverviewWindow, length_);
+    std::unique_ptr<mono_float[]> buffer = std::make_unique<mono_float[]>(window);
+    mono_float* channels[] = { buffer.get() };
+
+    for (int i = 0; i < kOverviewSize; ++i) {
+      int64 start = static_cast<int64>(length_) * i / kOverviewSize;
+      reader_->read(channels, 1, start, window);
+
+      mono_float max = buffer[0];
+      for (int s = 1; s < window; ++s)
+        max = std::max(max, buffer[s]);
+      overview_[i] = max;
+    }
   }
 
   //=====================  Sample Implementation  ===========================//
@@ -293,8 +510,6 @@ namespace vital {
   }
 
   void Sample::loadSample(const mono_float* buffer, int size, int sample_rate) {
-    static constexpr int kMaxSize = 1764000;
-
     VITAL_ASSERT(active_audio_data_.is_lock_free());
 
     size = std::min(size, kMaxSize);
@@ -318,6 +533,21 @@ namespace vital {
       std::this_thread::yield(); // Wait for audio thread to finish using old_data.
   }
 
+  bool Sample::loadStream(const std::string& path) {
+    std::unique_ptr<SampleStream> stream = SampleStream::open(path);
+    if (stream == nullptr)
+      return false;
+
+    std::unique_ptr<SampleData> old_data = std::move(data_);
+    data_ = std::make_unique<SampleData>(stream->length(), stream->sampleRate(), stream->stereo());
+    data_->stream = std::move(stream);
+
+    current_data_ = data_.get();
+    while (active_audio_data_.load())
+      std::this_thread::yield(); // Wait for audio thread to finish using old_data.
+    return true;
+  }
+
   void Sample::init() {
     // Creates a default noise buffer and loads it
     name_ = kDefaultName;
@@ -330,30 +560,59 @@ namespace vital {
     loadSample(buffer, kDefaultSampleLength, kDefaultSampleRate);
   }
 
+  void Sample::swapData(Sample* other) {
+    VITAL_ASSERT(active_audio_data_.load() == nullptr && other->active_audio_data_.load() == nullptr);
+
+    name_.swap(other->name_);
+    last_browsed_file_.swap(other->last_browsed_file_);
+    data_.swap(other->data_);
+    std::swap(current_data_, other->current_data_);
+  }
+
   json Sample::stateToJson() {
     // Serializes sample data into Base64
     json data;
     data["name"] = name_;
     data["length"] = data_->length;
     data["sample_rate"] = data_->sample_rate;
-    std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(data_->length);
-    utils::floatToPcmData(pcm_data.get(), data_->left_buffers[kUpsampleTimes].get(), data_->length);
-    String encoded = Base64::toBase64(pcm_data.get(), sizeof(int16_t) * data_->length);
-    data["samples"] = encoded.toStdString();
-    if (data_->stereo) {
-      utils::floatToPcmData(pcm_data.get(), data_->right_buffers[kUpsampleTimes].get(), data_->length);
-      String encoded_stereo = Base64::toBase64(pcm_data.get(), sizeof(int16_t) * data_->length);
-      data["samples_stereo"] = encoded_stereo.toStdString();
+    if (data_->stream) {
+      data["stream_file"] = data_->stream->getPath();
+      return data;
+    }
+
+    if (data_->encoded_left.empty()) {
+      std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(data_->length);
+      utils::floatToPcmData(pcm_data.get(), data_->left_buffers[kUpsampleTimes].get(), data_->length);
+      data_->encoded_left = Base64::toBase64(pcm_data.get(), sizeof(int16_t) * data_->length).toStdString();
+      if (data_->stereo) {
+        utils::floatToPcmData(pcm_data.get(), data_->right_buffers[kUpsampleTimes].get(), data_->length);
+        data_->encoded_right = Base64::toBase64(pcm_data.get(), sizeof(int16_t) * data_->length).toStdString();
+      }
     }
+
+    data["samples"] = data_->encoded_left;
+    if (data_->stereo)
+      data["samples_stereo"] = data_->encoded_right;
     return data;
   }
 
+  void Sample::clearStateCache() {
+    data_->encoded_left.clear();
+    data_->encoded_right.clear();
+  }
+
   void Sample::jsonToState(json data) {
     // Deserializes Base64 sample data and loads it
     name_ = "";
     if (data.count("name"))
       name_ = data["name"].get<std::string>();
 
+    if (data.count("stream_file")) {
+      if (!loadStream(data["stream_file"].get<std::string>()))
+        init();
+      return;
+    }
+
     int length = data["length"];
     int sample_rate = data["sample_rate"];
 
@@ -397,6 +656,9 @@ namespace vital {
     // Main audio processing logic: updates sample playback position,
     // handles loop/bounce logic, applies pitch transposition, and fills outputs.
     sample_->markUsed();
+    SampleStream* stream = sample_->activeStream();
+    if (stream)
+      stream->markUsed();
 
     poly_float current_pan_amplitude = pan_amplitude_;
     poly_float input_pan = utils::clamp(input(kPan)->at(0), -1.0f, 1.0f);
@@ -444,11 +706,18 @@ namespace vital {
     else
       bounce_mask_ = 0;
 
+    bool wrap = loop && !bounce;
     const mono_float* audio_buffers[poly_float::kSize];
+    int stream_levels[poly_float::kSize];
+    int stream_channels[poly_float::kSize];
     poly_float phase_mult = 1.0f;
     for (int i = 0; i < poly_float::kSize; ++i) {
       int index = sample_->getActiveIndex(phase_inc_[i]);
-      if (loop && !bounce) {
+      if (stream) {
+        stream_levels[i] = index;
+        stream_channels[i] = stream->stereo() ? i % 2 : 0;
+      }
+      else if (wrap) {
         if (i % 2)
           audio_buffers[i] = sample_->getActiveRightLoopBuffer(index);
         else
@@ -473,6 +742,16 @@ namespace vital {
     poly_float current_index = utils::min(sample_index_, audio_length);
 
     poly_mask current_bounce = bounce_mask_;
+    if (stream) {
+      for (int i = 0; i < poly_float::kSize; i += 2) {
+        bool backward = current_bounce[i];
+        int position = current_index[i];
+        if (backward)
+          position = audio_length - position;
+        stream->request(position >> Sample::kUpsampleTimes, backward, wrap);
+      }
+    }
+
     poly_int length = audio_length;
     for (int i = 0; i < num_samples; ++i) {
       current_phase_inc += delta_phase_inc;
@@ -491,7 +770,11 @@ namespace vital {
       VITAL_ASSERT(poly_float::greaterThan(utils::toFloat(start_indices), audio_length).anyMask() == 0);
 
       matrix interpolation_matrix = utils::getCatmullInterpolationMatrix(t);
-      matrix value_matrix = utils::getValueMatrix(audio_buffers, start_indices);
+      matrix value_matrix;
+      if (stream)
+        value_matrix = getStreamValueMatrix(stream, stream_levels, stream_channels, start_indices, wrap);
+      else
+        value_matrix = utils::getValueMatrix(audio_buffers, start_indices);
       value_matrix.transpose();
       raw_output[i] = interpolation_matrix.multiplyAndSumRows(value_matrix);
       VITAL_ASSERT(utils::isContained(raw_output[i]));
@@ -531,6 +814,8 @@ namespace vital {
     phase = phase * (1.0f / audio_length);
     phase_output_->buffer[0] = utils::encodePhaseAndVoice(phase, input(kNoteCount)->at(0));
 
+    if (stream)
+      stream->markUnused();
     sample_->markUnused();
   }
 
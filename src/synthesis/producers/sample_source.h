@@ -13,6 +13,159 @@
 using json = nlohmann::json;
 
 namespace vital {
+  /**
+   * @class SampleStream
+   * @brief Streams a long sample from an audio file on disk instead of holding it in memory.
+   *
+   * The file is split into pages of kPageSize frames. Each resident page holds its own band-limited
+   * levels, matching the layout Sample builds for the whole buffer, derived from the page plus
+   * kPageMargin frames on either side. The first kPreloadSeconds are loaded up front and never evicted
+   * so attacks are instant. A background reader loads pages that voices request ahead of their playheads
+   * and evicts the least recently used pages once more than kMaxCachedPages are resident.
+   *
+   * The audio thread never blocks or allocates. A page that isn't resident yet reads as silence.
+   */
+  class SampleStream {
+    public:
+      /// Bits in the number of source frames per page.
+      static constexpr int kPageBits = 14;
+      /// Number of source frames per page.
+      static constexpr int kPageSize = 1 << kPageBits;
+      /// Extra source frames read on either side of a page so filtering doesn't see the page edge.
+      static constexpr int kPageMargin = 2048;
+      /// Number of band-limited levels kept for each page (upsampled, original and downsampled).
+      static constexpr int kNumLevels = 7;
+      /// Maximum number of channels streamed.
+      static constexpr int kMaxChannels = 2;
+      /// Seconds at the start of the file that are always resident.
+      static constexpr float kPreloadSeconds = 2.0f;
+      /// Pages requested ahead of each playhead.
+      static constexpr int kReadAheadPages = 2;
+      /// Maximum number of resident pages beyond the preloaded ones.
+      static constexpr int kMaxCachedPages = 96;
+      /// Number of peak values kept for drawing the waveform.
+      static constexpr int kOverviewSize = 1024;
+      /// Frames read per overview value.
+      static constexpr int kOverviewWindow = 256;
+      /// How often the reader checks for requested pages.
+      static constexpr int kPollMilliseconds = 2;
+      /// Longest file we'll stream, so every level length fits in an int.
+      static constexpr int kMaxLength = 1 << 29;
+
+      /**
+       * @struct Page
+       * @brief The band-limited levels for one page of the file.
+       */
+      struct Page {
+        std::unique_ptr<mono_float[]> levels[kNumLevels][kMaxChannels];
+      };
+
+      /**
+       * @brief Opens an audio file for streaming and preloads its start.
+       * @param path             Full path to the audio file.
+       * @param max_cached_pages Maximum number of resident pages beyond the preloaded ones.
+       * @return The stream, or nullptr if the file couldn't be read.
+       */
+      static std::unique_ptr<SampleStream> open(const std::string& path, int max_cached_pages = kMaxCachedPages);
+
+      /**
+       * @brief Destructor. Stops the reader thread.
+       */
+      ~SampleStream();
+
+      /// Returns the file path being streamed.
+      const std::string& getPath() const { return path_; }
+      /// Returns the length of the file in frames.
+      int length() const { return length_; }
+      /// Returns the file's sample rate.
+      int sampleRate() const { return sample_rate_; }
+      /// Returns true if the file has more than one channel.
+      bool stereo() const { return num_channels_ > 1; }
+      /// Returns kOverviewSize approximate peaks of the left channel for display.
+      const mono_float* overview() const { return overview_.get(); }
+
+      /**
+       * @brief Reads one value from a band-limited level.
+       * @param level   The band-limited level, 0 is upsampled and 1 is the original rate.
+       * @param channel The channel to read.
+       * @param index   The index into the level.
+       * @param wrap    If true indices outside the level wrap around, otherwise they read zero.
+       * @return The value, or zero if its page isn't resident.
+       */
+      force_inline mono_float read(int level, int channel, int index, bool wrap) const {
+        int level_length = level_lengths_[level];
+        if (index < 0 || index >= level_length) {
+          if (!wrap)
+            return 0.0f;
+          index = (index % level_length + level_length) % level_length;
+        }
+
+        int bits = kPageBits + 1 - level;
+        Page* page = pages_[index >> bits].load(std::memory_order_acquire);
+        if (page == nullptr)
+          return 0.0f;
+        return page->levels[level][channel][index & ((1 << bits) - 1)];
+      }
+
+      /**
+       * @brief Asks the reader to keep the pages around a playhead resident.
+       * @param position The playhead position in source frames.
+       * @param backward True if the playhead is moving backward.
+       * @param wrap     True if playback loops around the end of the file.
+       */
+      void request(int position, bool backward, bool wrap);
+
+      /// Marks the stream as being read by the audio thread.
+      force_inline void markUsed() { audio_sequence_.fetch_add(1); }
+      /// Marks the stream as no longer being read by the audio thread.
+      force_inline void markUnused() { audio_sequence_.fetch_add(1); }
+
+      /// Returns the number of pages currently resident.
+      int numResidentPages() const;
+
+      /// Returns the number of pages that are preloaded and never evicted.
+      int numPinnedPages() const { return num_pinned_pages_; }
+
+      /// Returns true if the given page is resident.
+      bool isResident(int page) const { return pages_[page].load() != nullptr; }
+
+      /// Loads requested pages and evicts old ones. Called by the reader thread.
+      void service();
+
+    private:
+      class Reader;
+
+      SampleStream(std::unique_ptr<AudioFormatReader> reader, const std::string& path, int max_cached_pages);
+
+      void loadPage(int page);
+      void evictPages();
+      void waitForAudioThread();
+      void computeOverview();
+      void preload();
+
+      std::string path_;
+      std::unique_ptr<AudioFormatReader> reader_;
+      std::unique_ptr<Reader> reader_thread_;
+      int length_;
+      int sample_rate_;
+      int num_channels_;
+      int num_pages_;
+      int num_pinned_pages_;
+      int max_cached_pages_;
+      int level_lengths_[kNumLevels];
+
+      std::unique_ptr<std::atomic<Page*>[]> pages_;
+      std::unique_ptr<std::unique_ptr<Page>[]> owned_pages_;
+      std::unique_ptr<std::atomic<int>[]> last_used_;
+      std::unique_ptr<std::atomic<bool>[]> wanted_;
+      std::unique_ptr<mono_float[]> overview_;
+      std::vector<std::pair<int, int>> eviction_candidates_;
+
+      std::atomic<int> audio_sequence_;
+
+      JUCE_LEAK_DETECTOR(SampleStream)
+  };
+
   /**
    * @class Sample
    * @brief Holds and manages a single sampled waveform, including stereo or mono data
@@ -32,6 +185,8 @@ namespace vital {
       static constexpr int kBufferSamples = 4;
       /// Minimum sample size for further downsampling.
       static constexpr int kMinSize = 4;
+      /// Longest sample kept in memory, longer files should be streamed.
+      static constexpr int kMaxSize = 1764000;
 
       /**
        * @struct SampleData
@@ -51,6 +206,9 @@ namespace vital {
         int sample_rate; ///< Original sample rate of the data.
         bool stereo;     ///< True if the sample is stereo, false if mono.
 
+        /// Stream reading the sample from disk, or nullptr if the sample is held in memory.
+        std::unique_ptr<SampleStream> stream;
+
         /// Collection of band-limited upsample/downsample buffers for the left channel.
         std::vector<std::unique_ptr<mono_float[]>> left_buffers;
         /// Collection of band-limited upsample/downsample loop buffers for the left channel.
@@ -60,6 +218,11 @@ namespace vital {
         /// Collection of band-limited upsample/downsample loop buffers for the right channel (stereo only).
         std::vector<std::unique_ptr<mono_float[]>> right_loop_buffers;
 
+        /// Base64 encoded left channel saved with presets, filled the first time the sample is saved.
+        std::string encoded_left;
+        /// Base64 encoded right channel saved with presets (stereo only).
+        std::string encoded_right;
+
         JUCE_LEAK_DETECTOR(SampleData)
       };
 
@@ -85,6 +248,22 @@ namespace vital {
        */
       void loadSample(const mono_float* left_buffer, const mono_float* right_buffer, int size, int sample_rate);
 
+      /**
+       * @brief Streams a sample from an audio file instead of loading it into memory.
+       * @param path Full path to the audio file.
+       * @return True if the file could be opened, otherwise the current sample is kept.
+       */
+      bool loadStream(const std::string& path);
+
+      /// Returns true if the current sample is streamed from disk.
+      bool isStreaming() const { return current_data_->stream != nullptr; }
+
+      /// Returns the stream of the current sample, or nullptr if it's held in memory.
+      SampleStream* stream() const { return current_data_->stream.get(); }
+
+      /// Returns the stream of the sample in active use, or nullptr if it's held in memory.
+      force_inline SampleStream* activeStream() const { return active_audio_data_.load()->stream.get(); }
+
       /// Sets the user-facing name of the sample.
       void setName(const std::string& name) { name_ = name; }
       /// Returns the user-facing name of the sample.
@@ -132,7 +311,9 @@ namespace vital {
        */
       int getActiveIndex(mono_float delta) {
         int octaves = utils::ilog2(std::max<int>(delta, 1));
-        return std::min(octaves, (int)active_audio_data_.load()->left_buffers.size() - 1);
+        SampleData* data = active_audio_data_.load();
+        int num_levels = data->stream ? SampleStream::kNumLevels : (int)data->left_buffers.size();
+        return std::min(octaves, num_levels - 1);
       }
 
       /**
@@ -184,8 +365,21 @@ namespace vital {
       /// Marks this sample as "not in use," clearing the active_audio_data_ pointer.
       force_inline void markUnused() { active_audio_data_ = nullptr; }
 
+      /**
+       * @brief Exchanges the audio data and names with another sample without allocating.
+       *
+       * Lets a sample decoded off the audio thread be swapped in between blocks, when neither sample is in use.
+       *
+       * @param other The sample to exchange data with.
+       */
+      void swapData(Sample* other);
+
       /**
        * @brief Exports the sample state (metadata and sample data) to a JSON object.
+       *
+       * Streamed samples store the file path instead of the audio. The audio data never changes once loaded,
+       * so it's only encoded on the first save and reused after that.
+       *
        * @return A JSON object containing the sample's state.
        */
       json stateToJson();
@@ -196,6 +390,11 @@ namespace vital {
        */
       void jsonToState(json data);
 
+      /**
+       * @brief Drops the encoded audio so the next stateToJson() encodes it again.
+       */
+      void clearStateCache();
+
     protected:
       std::string name_;              ///< The user-facing name of the sample.
       std::string last_browsed_file_; ///< The last browsed file path for this sample (if any).
@@ -272,6 +471,11 @@ namespace vital {
        */
       virtual Processor* clone() const override { return new SampleSource(*this); }
 
+      /**
+       * @brief Restarts the random start position sequence from its seed.
+       */
+      virtual void hardReset() override { random_generator_.reset(); }
+
       /**
        * @brief Provides access to the owned Sample object.
        * @return A pointer to the Sample owned by this SampleSource.
@@ -903,6 +903,43 @@ namespace vital {
       audio_out[i] += utils::swapVoices(audio_out[i]);
   }
 
+  void SynthOscillator::hardReset() {
+    // Return to the constructed state so the next note doesn't blend from the last one.
+    last_quantized_transpose_ = 0.0f;
+    last_quantize_ratio_ = 1.0f;
+    pan_amplitude_ = 0.0f;
+    center_amplitude_ = 0.0f;
+    detuned_amplitude_ = 0.0f;
+    distortion_phase_ = 0.0f;
+    blend_stereo_multiply_ = 0.0f;
+    blend_center_multiply_ = 0.0f;
+
+    for (int i = 0; i < kNumPolyPhase; ++i) {
+      phases_[i] = 0;
+      phase_inc_mults_[i] = 1.0f;
+      from_phase_inc_mults_[i] = 1.0f;
+      shepard_double_masks_[i] = 0;
+      shepard_half_masks_[i] = 0;
+      waiting_shepard_double_masks_[i] = 0;
+      waiting_shepard_half_masks_[i] = 0;
+      detunings_[i] = 1.0f;
+      spectral_morph_values_[i] = 0.0f;
+      last_spectral_morph_values_[i] = 1.0f;
+      distortion_values_[i] = 0.0f;
+      last_distortion_values_[i] = 0.0f;
+    }
+
+    for (int i = 0; i < kNumBuffers + 1; ++i) {
+      for (int j = 0; j < kSpectralBufferSize; ++j) {
+        fourier_frames1_[i][j] = 0.0f;
+        fourier_frames2_[i][j] = 0.0f;
+      }
+    }
+
+    resetWavetableBuffers();
+    random_generator_.reset();
+  }
+
   force_inline void SynthOscillator::resetWavetableBuffers() {
     const mono_float* default_buffer = Wavetable::null_waveform();
     for (int i = 0; i < kNumBuffers; ++i) {
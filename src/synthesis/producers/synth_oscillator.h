@@ -345,6 +345,11 @@ namespace vital {
        */
       void reset(poly_mask reset_mask) override;
 
+      /**
+       * @brief Returns the oscillator to its constructed state and restarts the random phase sequence.
+       */
+      void hardReset() override;
+
       /**
        * @brief Sets the spectral morph values for internal morphing.
        * @param spectral_morph The type of spectral morph.
@@ -10,8 +10,11 @@
 #include "peak_meter.h"
 #include "operators.h"
 #include "reorderable_effect_chain.h"
+#include "reverb_module.h"
 #include "value_switch.h"
 
+#include <chrono>
+
 namespace vital {
 
   SoundEngine::SoundEngine() : SynthModule(0, 1), voice_handler_(nullptr), effect_chain_(nullptr),
@@ -20,6 +23,7 @@ namespace vital {
     SoundEngine::init();
     bps_ = data_->controls["beats_per_minute"];
     modulation_processors_.reserve(kMaxModulationConnections);
+    reserveModulationRouting();
   }
 
   SoundEngine::~SoundEngine() {
@@ -53,6 +57,7 @@ namespace vital {
     voice_handler_->plug(voice_override, VoiceHandler::kVoiceOverride);
 
     addProcessor(voice_handler_);
+    addProfiledProcessor("voice_handler", voice_handler_);
 
     createBaseControl("pitch_wheel");
     createBaseControl("mod_wheel");
@@ -61,6 +66,7 @@ namespace vital {
     effect_chain_ = new ReorderableEffectChain(beats_per_second, voice_handler_->midi_offset_output());
     addSubmodule(effect_chain_);
     addProcessor(effect_chain_);
+    addProfiledProcessor("effects", effect_chain_);
     effect_chain_->plug(voice_handler_, ReorderableEffectChain::kAudio);
     effect_chain_->plug(effect_chain_order, ReorderableEffectChain::kOrder);
 
@@ -123,6 +129,73 @@ namespace vital {
     SynthModule::init();
     disableUnnecessaryModSources();
     setOversamplingAmount(kDefaultOversamplingAmount, kDefaultSampleRate);
+
+  #if VITAL_PROFILE
+    createProfileOutputs();
+  #endif
+  }
+
+#if VITAL_PROFILE
+  void SoundEngine::createProfileOutputs() {
+    window_start_cycles_ = profile()->cycles.load();
+    window_seconds_ = 0.0;
+    window_samples_ = 0;
+    total_seconds_ = 0.0;
+    total_samples_ = 0;
+    createStatusOutput("engine_cpu", &engine_load_);
+
+    for (auto& profiled : getProfiledProcessors()) {
+      std::unique_ptr<ProfileReadout> readout = std::make_unique<ProfileReadout>();
+      readout->name = profiled.first;
+      readout->profile = profiled.second->profile();
+      readout->last_cycles = readout->profile->cycles.load();
+      createStatusOutput(profiled.first + "_cpu", &readout->output);
+      profile_readouts_.push_back(std::move(readout));
+    }
+  }
+
+  void SoundEngine::updateProfileOutputs(int num_samples, double seconds) {
+    window_seconds_ += seconds;
+    window_samples_ += num_samples;
+    total_seconds_ += seconds;
+    total_samples_ += num_samples;
+    if (window_samples_ < getSampleRate() / kProfileUpdatesPerSecond)
+      return;
+
+    // Cycle counter units vary by platform so convert them using the wall clock time of the whole engine.
+    uint64_t engine_cycles = profile()->cycles.load(std::memory_order_relaxed);
+    uint64_t window_cycles = engine_cycles - window_start_cycles_;
+    double audio_seconds = window_samples_ / (1.0 * getSampleRate());
+    double load_per_cycle = 0.0;
+    if (window_cycles)
+      load_per_cycle = window_seconds_ / (audio_seconds * window_cycles);
+
+    engine_load_.buffer[0] = window_seconds_ / audio_seconds;
+    for (auto& readout : profile_readouts_) {
+      uint64_t cycles = readout->profile->cycles.load(std::memory_order_relaxed);
+      readout->output.buffer[0] = (cycles - readout->last_cycles) * load_per_cycle;
+      readout->last_cycles = cycles;
+    }
+
+    window_start_cycles_ = engine_cycles;
+    window_seconds_ = 0.0;
+    window_samples_ = 0;
+  }
+#endif
+
+  std::map<std::string, float> SoundEngine::getProcessorLoads() const {
+    std::map<std::string, float> loads;
+  #if VITAL_PROFILE
+    uint64_t engine_cycles = profile()->cycles.load();
+    if (total_samples_ == 0 || engine_cycles == 0)
+      return loads;
+
+    double engine_load = total_seconds_ * getSampleRate() / total_samples_;
+    loads["engine"] = engine_load;
+    for (auto& readout : profile_readouts_)
+      loads[readout->name] = engine_load * readout->profile->cycles.load() / engine_cycles;
+  #endif
+    return loads;
   }
 
   void SoundEngine::connectModulation(const modulation_change& change) {
@@ -234,6 +307,10 @@ namespace vital {
   void SoundEngine::process(int num_samples) {
     // Process the audio block.
     VITAL_ASSERT(num_samples <= output()->buffer_size);
+  #if VITAL_PROFILE
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    uint64_t start_cycles = profile::readCycles();
+  #endif
 
     FloatVectorOperations::disableDenormalisedNumberSupport();
     voice_handler_->setLegato(legato_->value());
@@ -248,6 +325,12 @@ namespace vital {
       }
     }
 
+  #if VITAL_PROFILE
+    profile()->add(profile::readCycles() - start_cycles);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    updateProfileOutputs(num_samples, elapsed.count());
+  #endif
+
     // Update status outputs.
     for (auto& status_source : data_->status_outputs)
       status_source.second->update();
@@ -261,6 +344,15 @@ namespace vital {
 
   void SoundEngine::allSoundsOff() {
     voice_handler_->allSoundsOff();
+    clearEffects();
+  }
+
+  void SoundEngine::hardReset() {
+    voice_handler_->allSoundsOff();
+    SynthModule::hardReset();
+  }
+
+  void SoundEngine::clearEffects() {
     effect_chain_->hardReset();
     decimator_->hardReset();
   }
@@ -321,6 +413,10 @@ namespace vital {
     return effect_chain_->getEqualizerMemory();
   }
 
+  void SoundEngine::enableEqualizerMemory(bool enable) {
+    effect_chain_->enableEqualizerMemory(enable);
+  }
+
   void SoundEngine::setAftertouch(mono_float note, mono_float value, int sample, int channel) {
     voice_handler_->setAftertouch(note, value, sample, channel);
   }
@@ -355,6 +451,11 @@ namespace vital {
     return voice_handler_->getSample();
   }
 
+  ImpulseResponse* SoundEngine::getReverbImpulseResponse() {
+    ReverbModule* reverb = static_cast<ReverbModule*>(effect_chain_->getEffect(constants::kReverb));
+    return reverb->getImpulseResponse();
+  }
+
   LineGenerator* SoundEngine::getLfoSource(int index) {
     return voice_handler_->getLfoSource(index);
   }
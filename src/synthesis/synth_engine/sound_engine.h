@@ -9,6 +9,7 @@ class Tuning;
 
 namespace vital {
     class Decimator;
+    class ImpulseResponse;
     class PeakMeter;
     class Sample;
     class ReorderableEffectChain;
@@ -119,6 +120,19 @@ namespace vital {
          */
         void allSoundsOff() override;
 
+        /**
+         * @brief Clears the effect tails and the output decimator without touching the voices.
+         */
+        void clearEffects();
+
+        /**
+         * @brief Kills all voices and returns every processor in the engine to its initial state.
+         *
+         * Unlike allSoundsOff() this also rewinds modulator phases and random generators, so rendering the
+         * same input after a hard reset produces the same audio.
+         */
+        void hardReset() override;
+
         /**
          * @brief Sends all voices a note-off command at a given sample.
          * @param sample The sample index to apply the note-off command.
@@ -216,6 +230,12 @@ namespace vital {
          */
         const StereoMemory* getEqualizerMemory();
 
+        /**
+         * @brief Turns recording the equalizer output into its memory on or off.
+         * @param enable True if something reads the equalizer memory.
+         */
+        void enableEqualizerMemory(bool enable);
+
         /**
          * @brief Sets the BPM (beats per minute) value for the engine.
          * @param bpm The new BPM value.
@@ -278,6 +298,22 @@ namespace vital {
          */
         Sample* getSample();
 
+        /**
+         * @brief Gets a pointer to the impulse response used by the convolution reverb.
+         * @return A pointer to the ImpulseResponse object.
+         */
+        ImpulseResponse* getReverbImpulseResponse();
+
+        /**
+         * @brief Gets the average CPU load of each profiled module since the engine was created.
+         *
+         * Loads are fractions of real time, so 0.1 means the module took a tenth of the time the audio lasted.
+         * The map includes "engine" for the whole engine and is empty unless built with VITAL_PROFILE.
+         *
+         * @return A map of module names to their average loads.
+         */
+        std::map<std::string, float> getProcessorLoads() const;
+
         /**
          * @brief Gets a pointer to an LFO source by index.
          * @param index The index of the LFO source.
@@ -353,6 +389,42 @@ namespace vital {
         void checkOversampling();
 
     private:
+    #if VITAL_PROFILE
+        /// Number of times per second the CPU status outputs are refreshed.
+        static constexpr int kProfileUpdatesPerSecond = 8;
+
+        /**
+         * @struct ProfileReadout
+         * @brief Publishes the load of one profiled Processor through a StatusOutput.
+         */
+        struct ProfileReadout {
+            std::string name;                ///< The name the Processor is reported under.
+            const ProcessorProfile* profile; ///< The Processor's running totals.
+            uint64_t last_cycles;            ///< Total cycles at the last refresh.
+            cr::Output output;               ///< Output holding the load over the last refresh window.
+        };
+
+        /**
+         * @brief Creates a "<name>_cpu" StatusOutput for each profiled Processor.
+         */
+        void createProfileOutputs();
+
+        /**
+         * @brief Accumulates the time of the last block and refreshes the CPU outputs when a window completes.
+         * @param num_samples The number of samples in the block.
+         * @param seconds The wall clock time the block took.
+         */
+        void updateProfileOutputs(int num_samples, double seconds);
+
+        std::vector<std::unique_ptr<ProfileReadout>> profile_readouts_; ///< Readouts for profiled Processors.
+        cr::Output engine_load_;       ///< Load of the whole engine over the last refresh window.
+        uint64_t window_start_cycles_; ///< Engine cycles at the start of the refresh window.
+        double window_seconds_;        ///< Wall clock time spent processing in the refresh window.
+        int window_samples_;           ///< Samples processed in the refresh window.
+        double total_seconds_;         ///< Wall clock time spent processing since creation.
+        int64_t total_samples_;        ///< Samples processed since creation.
+    #endif
+
         /**
          * @brief Sets the oversampling amount and adjusts the sample rate accordingly.
          * @param oversampling_amount The new oversampling amount.
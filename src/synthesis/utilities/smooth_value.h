@@ -71,6 +71,11 @@ namespace vital {
             current_value_ = value;
         }
 
+        /**
+         * @brief Jumps straight to the target value, dropping any smoothing in progress.
+         */
+        void hardReset() override { setHard(value_); }
+
     private:
         /// The current smoothed value at the end of the last processing block.
         poly_float current_value_;
@@ -123,6 +128,14 @@ namespace vital {
                 current_value_ = value;
             }
 
+            /**
+             * @brief Jumps straight to the target value, dropping any smoothing in progress.
+             */
+            void hardReset() override {
+                Value::set(value_);
+                current_value_ = value_;
+            }
+
         private:
             /// The current smoothed control-rate value at the end of the last processing block.
             poly_float current_value_;
@@ -62,5 +62,6 @@
 #include "compressor.cpp"
 #include "delay.cpp"
 #include "reverb.cpp"
+#include "convolution_reverb.cpp"
 #include "sound_engine.cpp"
 #include "synth_voice_handler.cpp"
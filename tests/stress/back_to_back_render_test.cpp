@@ -0,0 +1,103 @@
+/**
+ * @file back_to_back_render_test.cpp
+ * @brief Implements the BackToBackRenderTest class, rendering one job twice on a reused synth.
+ */
+
+#include "back_to_back_render_test.h"
+#include "sound_engine.h"
+#include "synth_base.h"
+
+namespace {
+    /// Seconds of held notes in each render.
+    constexpr float kJobSeconds = 0.5f;
+    /// Tempo of each render.
+    constexpr float kJobBpm = 120.0f;
+
+    /// A SynthBase that only renders offline, like the render daemon's.
+    class BackToBackSynth : public SynthBase {
+    public:
+        using SynthBase::loadFromJson;
+
+        const CriticalSection& getCriticalSection() override { return critical_section_; }
+        void pauseProcessing(bool pause) override { }
+        SynthGuiInterface* getGuiInterface() override { return nullptr; }
+
+        json getState() { return saveToJson(); }
+
+    private:
+        CriticalSection critical_section_;
+    };
+
+    json createJobPreset() {
+        BackToBackSynth source;
+        source.valueChangedInternal("lfo_1_sync", 0.0f);
+        source.valueChangedInternal("lfo_1_frequency", 1.3f);
+        source.connectModulation("lfo_1", "osc_1_transpose");
+        source.valueChangedInternal("modulation_1_amount", 0.3f);
+        source.connectModulation("env_2", "osc_1_level");
+        source.valueChangedInternal("modulation_2_amount", -0.4f);
+        source.connectModulation("random_1", "osc_1_pan");
+        source.valueChangedInternal("modulation_3_amount", 0.5f);
+        source.valueChangedInternal("chorus_on", 1.0f);
+        source.valueChangedInternal("delay_on", 1.0f);
+        source.valueChangedInternal("reverb_on", 1.0f);
+        return source.getState();
+    }
+
+    /// Runs one job the way the render daemon does: load the preset, hard reset the engine, render.
+    bool renderJob(BackToBackSynth& synth, const json& preset, const File& file) {
+        if (!synth.loadFromJson(preset))
+            return false;
+
+        synth.getEngine()->hardReset();
+        return synth.renderAudioToFile(file, kJobSeconds, kJobBpm, { 48, 60 }, false);
+    }
+
+    bool readRender(const File& file, AudioSampleBuffer& buffer) {
+        AudioFormatManager format_manager;
+        format_manager.registerBasicFormats();
+        std::unique_ptr<AudioFormatReader> reader(format_manager.createReaderFor(file));
+        if (reader == nullptr)
+            return false;
+
+        int length = static_cast<int>(reader->lengthInSamples);
+        buffer.setSize(2, length);
+        reader->read(&buffer, 0, length, 0, true, true);
+        return true;
+    }
+}
+
+void BackToBackRenderTest::runTest() {
+    beginTest("Identical Jobs Render Identically");
+
+    json preset = createJobPreset();
+    BackToBackSynth synth;
+    TemporaryFile first_file(".wav");
+    TemporaryFile second_file(".wav");
+    expect(renderJob(synth, preset, first_file.getFile()));
+    expect(renderJob(synth, preset, second_file.getFile()));
+
+    AudioSampleBuffer first;
+    AudioSampleBuffer second;
+    expect(readRender(first_file.getFile(), first));
+    expect(readRender(second_file.getFile(), second));
+    expectEquals(second.getNumSamples(), first.getNumSamples());
+    if (second.getNumSamples() != first.getNumSamples())
+        return;
+
+    int mismatches = 0;
+    for (int channel = 0; channel < 2; ++channel) {
+        const float* first_samples = first.getReadPointer(channel);
+        const float* second_samples = second.getReadPointer(channel);
+        for (int i = 0; i < first.getNumSamples(); ++i) {
+            if (first_samples[i] != second_samples[i])
+                mismatches++;
+        }
+    }
+
+    expect(first.getMagnitude(0, 0, first.getNumSamples()) > 0.0f, "Render is silent.");
+    expectEquals(mismatches, 0, "Second job rendered differently.");
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static BackToBackRenderTest back_to_back_render_test;
@@ -0,0 +1,29 @@
+/**
+ * @file back_to_back_render_test.h
+ * @brief Declares the BackToBackRenderTest class, which checks a reused synth renders the same job identically.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class BackToBackRenderTest
+ * @brief A test that renders the same preset twice in a row on one synth, the way the render daemon reuses its
+ *        synths between jobs, and compares the two files.
+ *
+ * The preset keeps the oscillator's random phase and uses a free running LFO, a random LFO, an envelope, chorus,
+ * delay and reverb so any state or random sequence left over from the first render shows up in the second one.
+ */
+class BackToBackRenderTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a BackToBackRenderTest with the specified test name and category.
+     */
+    BackToBackRenderTest() : UnitTest("Back To Back Renders", "Stress") { }
+
+    /**
+     * @brief Renders the same job twice on one synth and compares the output.
+     */
+    void runTest() override;
+};
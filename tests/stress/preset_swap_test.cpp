@@ -0,0 +1,151 @@
+/**
+ * @file preset_swap_test.cpp
+ * @brief Implements the PresetSwapTest class, loading presets into a synth while audio keeps running.
+ */
+
+#include "preset_swap_test.h"
+#include "convolution_reverb.h"
+#include "load_save.h"
+#include "sound_engine.h"
+#include "synth_base.h"
+
+namespace {
+    /// Samples processed per block by the test audio thread.
+    constexpr int kSwapBlockSamples = vital::kMaxBufferSize;
+    /// Length of the impulse response loaded into the source preset.
+    constexpr int kSwapResponseLength = 4000;
+
+    /// A SynthBase with its own lock that a test can drive like an audio callback would.
+    class PresetSwapSynth : public SynthBase {
+    public:
+        PresetSwapSynth() : buffer_(vital::kNumChannels, kSwapBlockSamples), min_fade_gain_(1.0f) { }
+
+        const CriticalSection& getCriticalSection() override { return critical_section_; }
+
+        void pauseProcessing(bool pause) override {
+            if (pause)
+                critical_section_.enter();
+            else
+                critical_section_.exit();
+        }
+
+        SynthGuiInterface* getGuiInterface() override { return nullptr; }
+
+        using SynthBase::loadFromJson;
+        using SynthBase::loadFromJsonWithFade;
+
+        json getState() { return saveToJson(); }
+
+        float processBlock() {
+            ScopedLock lock(critical_section_);
+            processAudio(&buffer_, vital::kNumChannels, kSwapBlockSamples, 0);
+            min_fade_gain_ = std::min(min_fade_gain_, swap_fade_gain_);
+            return buffer_.getMagnitude(0, kSwapBlockSamples);
+        }
+
+        float getMinFadeGain() const { return min_fade_gain_; }
+
+    private:
+        CriticalSection critical_section_;
+        AudioSampleBuffer buffer_;
+        float min_fade_gain_;
+    };
+
+    /// Calls processBlock() on a synth about once a millisecond, like a small host buffer would.
+    class PresetSwapAudioThread : public Thread {
+    public:
+        PresetSwapAudioThread(PresetSwapSynth* synth) :
+                Thread("Preset Swap Audio"), synth_(synth), max_magnitude_(0.0f) { }
+
+        void run() override {
+            while (!threadShouldExit()) {
+                max_magnitude_ = std::max(max_magnitude_, synth_->processBlock());
+                Thread::sleep(1);
+            }
+        }
+
+        float getMaxMagnitude() const { return max_magnitude_; }
+
+    private:
+        PresetSwapSynth* synth_;
+        float max_magnitude_;
+    };
+
+    json createSourcePreset() {
+        PresetSwapSynth source;
+        source.valueChangedInternal("reverb_on", 1.0f);
+        source.valueChangedInternal("filter_1_on", 1.0f);
+        source.valueChangedInternal("osc_1_level", 0.3f);
+
+        std::unique_ptr<vital::mono_float[]> response = std::make_unique<vital::mono_float[]>(kSwapResponseLength);
+        for (int i = 0; i < kSwapResponseLength; ++i)
+            response[i] = (i % 7 == 0) ? 1.0f / (i + 1) : 0.0f;
+        source.getReverbImpulseResponse()->loadSample(response.get(), kSwapResponseLength, vital::kDefaultSampleRate);
+        return source.getState();
+    }
+}
+
+void PresetSwapTest::runPrepareTest() {
+    beginTest("Prepare Leaves Synth Untouched");
+
+    json preset = createSourcePreset();
+    PresetSwapSynth synth;
+    json before = synth.getState();
+
+    std::map<std::string, String> save_info;
+    LoadSave::PreparedState prepared;
+    expect(LoadSave::prepareState(&synth, save_info, preset, prepared));
+    expect(prepared.impulse_response != nullptr);
+    expect(synth.getReverbImpulseResponse()->isDefault(), "Preparing changed the live impulse response.");
+    expect(synth.getState() == before, "Preparing changed the synth state.");
+}
+
+void PresetSwapTest::runMatchesLoadTest() {
+    beginTest("Faded Load Matches Load");
+
+    json preset = createSourcePreset();
+    PresetSwapSynth loaded;
+    PresetSwapSynth faded;
+    expect(loaded.loadFromJson(preset));
+    expect(faded.loadFromJsonWithFade(preset));
+
+    expect(faded.getState() == loaded.getState(), "Faded load ended in a different state.");
+    expect(!faded.getReverbImpulseResponse()->isDefault());
+    expectEquals(faded.getReverbImpulseResponse()->length(), kSwapResponseLength);
+}
+
+void PresetSwapTest::runHeldNotesTest() {
+    beginTest("Held Notes Survive Swap");
+
+    json preset = createSourcePreset();
+    PresetSwapSynth synth;
+    synth.getEngine()->noteOn(60, 1.0f, 0, 0);
+    for (int i = 0; i < 8; ++i)
+        synth.processBlock();
+
+    PresetSwapAudioThread audio_thread(&synth);
+    audio_thread.startThread();
+    Thread::sleep(20);
+    expect(synth.loadFromJsonWithFade(preset));
+    Thread::sleep(20);
+    audio_thread.stopThread(1000);
+
+    expectEquals(synth.getMinFadeGain(), 0.0f, "Output never faded out around the swap.");
+    expect(audio_thread.getMaxMagnitude() > 0.0f);
+    expect(synth.getEngine()->getNumActiveVoices() > 0, "Held note was cut by the swap.");
+
+    float magnitude = 0.0f;
+    for (int i = 0; i < 8; ++i)
+        magnitude = synth.processBlock();
+    expect(magnitude > 0.0f, "Held note is silent after the swap.");
+    expectEquals(synth.getControls()["osc_1_level"]->value(), 0.3f);
+}
+
+void PresetSwapTest::runTest() {
+    runPrepareTest();
+    runMatchesLoadTest();
+    runHeldNotesTest();
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static PresetSwapTest preset_swap_test;
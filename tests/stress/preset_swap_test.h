@@ -0,0 +1,43 @@
+/**
+ * @file preset_swap_test.h
+ * @brief Declares the PresetSwapTest class, which checks loading a preset into a running synth with a fade.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class PresetSwapTest
+ * @brief Tests SynthBase::loadFromJsonWithFade() and the LoadSave preparation it is built on.
+ *
+ * Checks that preparing a state leaves the synth alone, that the faded load ends in the same state as a
+ * regular load, and that held notes keep sounding while an audio thread fades out and back in around the swap.
+ */
+class PresetSwapTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a PresetSwapTest with the specified test name and category.
+     */
+    PresetSwapTest() : UnitTest("Preset Swap", "Stress") { }
+
+    /**
+     * @brief Runs all preset swap tests.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Checks LoadSave::prepareState() doesn't change the synth it prepares for.
+     */
+    void runPrepareTest();
+
+    /**
+     * @brief Checks a faded load matches a regular load when no audio is running.
+     */
+    void runMatchesLoadTest();
+
+    /**
+     * @brief Checks held notes survive a faded load while an audio thread is running.
+     */
+    void runHeldNotesTest();
+};
@@ -0,0 +1,35 @@
+/**
+ * @file render_block_test.h
+ * @brief Declares the RenderBlockTest class, which checks offline renders don't depend on the render block size.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class RenderBlockTest
+ * @brief A test that renders the same patch to file with different render block sizes and compares the audio.
+ *
+ * The engine steps kMaxBufferSize samples at a time whatever block size the file is written in, so a render with
+ * LFO modulation and a note release has to come out sample for sample the same at every block size.
+ */
+class RenderBlockTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a RenderBlockTest with the specified test name and category.
+     */
+    RenderBlockTest() : UnitTest("Render Block Size", "Stress") { }
+
+    /**
+     * @brief Renders at the default and the largest block size and compares the files.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Renders the test patch to a file.
+     * @param file The file to write.
+     * @param block_size The render block size to use.
+     */
+    void renderPatch(const File& file, int block_size);
+};
@@ -0,0 +1,93 @@
+/**
+ * @file reverb_benchmark_test.cpp
+ * @brief Implements the ReverbBenchmarkTest class, timing the network and convolution reverbs at equal tail lengths.
+ */
+
+#include "reverb_benchmark_test.h"
+#include "convolution_reverb.h"
+#include "memory.h"
+#include "reverb.h"
+#include "value.h"
+
+namespace {
+    /// Tail length (T60) in seconds used for both reverbs.
+    constexpr float kTailSeconds = 3.0f;
+    /// Seconds of audio processed for each timing.
+    constexpr int kBenchmarkSeconds = 10;
+    /// Amplitude at which the tail is considered to have ended.
+    constexpr float kT60Amplitude = 0.001f;
+}
+
+double ReverbBenchmarkTest::timeReverb(vital::Processor* reverb, vital::Output* audio) {
+    vital::utils::RandomGenerator random_generator(-1.0f, 1.0f);
+    int num_blocks = kBenchmarkSeconds * vital::kDefaultSampleRate / vital::kMaxBufferSize;
+
+    double total_seconds = 0.0;
+    for (int b = 0; b < num_blocks; ++b) {
+        for (int i = 0; i < vital::kMaxBufferSize; ++i)
+            audio->buffer[i] = vital::poly_float(random_generator.next(), random_generator.next(), 0.0f, 0.0f);
+
+        int64 start = Time::getHighResolutionTicks();
+        reverb->process(vital::kMaxBufferSize);
+        total_seconds += Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+    }
+
+    vital::Output* output = reverb->output();
+    expect(vital::utils::isContained(output->buffer, vital::kMaxBufferSize), "Reverb output is not finite.");
+    return total_seconds / kBenchmarkSeconds;
+}
+
+void ReverbBenchmarkTest::runTest() {
+    beginTest("Network Versus Convolution");
+
+    vital::Output audio;
+    audio.ensureBufferSize(vital::kMaxBufferSize);
+
+    // Network reverb at the default settings with a kTailSeconds decay.
+    vital::Reverb reverb;
+    reverb.setSampleRate(vital::kDefaultSampleRate);
+    std::vector<vital::Value> reverb_inputs(vital::Reverb::kNumInputs);
+    reverb_inputs[vital::Reverb::kDecayTime].set(kTailSeconds);
+    reverb_inputs[vital::Reverb::kPreHighCutoff].set(110.0f);
+    reverb_inputs[vital::Reverb::kHighCutoff].set(90.0f);
+    reverb_inputs[vital::Reverb::kHighGain].set(-1.0f);
+    reverb_inputs[vital::Reverb::kChorusAmount].set(0.05f);
+    reverb_inputs[vital::Reverb::kChorusFrequency].set(0.25f);
+    reverb_inputs[vital::Reverb::kSize].set(0.5f);
+    reverb_inputs[vital::Reverb::kWet].set(1.0f);
+    reverb.plug(&audio, vital::Reverb::kAudio);
+    for (int i = 1; i < vital::Reverb::kNumInputs; ++i)
+        reverb.plug(&reverb_inputs[i], i);
+
+    // Convolution reverb with decaying noise reaching kT60Amplitude after kTailSeconds.
+    int response_length = kTailSeconds * vital::kDefaultSampleRate;
+    std::unique_ptr<vital::mono_float[]> left = std::make_unique<vital::mono_float[]>(response_length);
+    std::unique_ptr<vital::mono_float[]> right = std::make_unique<vital::mono_float[]>(response_length);
+    vital::utils::RandomGenerator random_generator(-1.0f, 1.0f);
+    vital::mono_float decay = std::pow(kT60Amplitude, 1.0f / response_length);
+    vital::mono_float amplitude = 1.0f;
+    for (int i = 0; i < response_length; ++i) {
+        left[i] = amplitude * random_generator.next();
+        right[i] = amplitude * random_generator.next();
+        amplitude *= decay;
+    }
+
+    std::shared_ptr<vital::ImpulseResponse> impulse_response = std::make_shared<vital::ImpulseResponse>();
+    vital::ConvolutionReverb convolution_reverb(impulse_response);
+    convolution_reverb.setSampleRate(vital::kDefaultSampleRate);
+    impulse_response->loadSample(left.get(), right.get(), response_length, vital::kDefaultSampleRate);
+    vital::Value wet(1.0f);
+    convolution_reverb.plug(&audio, vital::ConvolutionReverb::kAudio);
+    convolution_reverb.plug(&wet, vital::ConvolutionReverb::kWet);
+
+    double network_load = timeReverb(&reverb, &audio);
+    double convolution_load = timeReverb(&convolution_reverb, &audio);
+
+    logMessage("Reverb tail: " + String(kTailSeconds) + " seconds at " + String(vital::kDefaultSampleRate) + " Hz");
+    logMessage("Network reverb real time load: " + String(100.0 * network_load, 3) + "%");
+    logMessage("Convolution reverb real time load (audio thread): " + String(100.0 * convolution_load, 3) + "%");
+    logMessage("Convolution / network: " + String(convolution_load / network_load, 2) + "x");
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static ReverbBenchmarkTest reverb_benchmark_test;
@@ -0,0 +1,41 @@
+/**
+ * @file reverb_benchmark_test.h
+ * @brief Declares the ReverbBenchmarkTest class, which compares the cost of the reverb styles.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+namespace vital {
+    class Processor;
+    struct Output;
+}
+
+/**
+ * @class ReverbBenchmarkTest
+ * @brief A stress test that times the feedback network Reverb against the ConvolutionReverb.
+ *
+ * Both reverbs are set up with the same tail length and process the same noise. The audio thread
+ * time for each is logged as a fraction of real time, and the outputs are checked to stay finite.
+ */
+class ReverbBenchmarkTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a ReverbBenchmarkTest with the specified test name and category.
+     */
+    ReverbBenchmarkTest() : UnitTest("Reverb Benchmark", "Stress") { }
+
+    /**
+     * @brief Runs the benchmark for both reverb styles.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Processes noise through a reverb and returns the fraction of real time it took.
+     * @param reverb The reverb processor, with all inputs plugged.
+     * @param audio The audio output feeding the reverb.
+     * @return Processing time divided by the duration of the processed audio.
+     */
+    double timeReverb(vital::Processor* reverb, vital::Output* audio);
+};
@@ -1,2 +1,6 @@
 #include "stress/modulation_stress_test.cpp"
 #include "stress/engine_launch_test.cpp"
+#include "stress/reverb_benchmark_test.cpp"
+#include "stress/preset_swap_test.cpp"
+#include "stress/render_block_test.cpp"
+#include "stress/back_to_back_render_test.cpp"
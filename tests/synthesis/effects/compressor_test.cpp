@@ -1,10 +1,131 @@
 /**
  * @file compressor_test.cpp
- * @brief Implements the CompressorTest class, running input bounds tests against the Compressor processor.
+ * @brief Implements the CompressorTest class, running input bounds and gain accuracy tests against the Compressor.
  */
 
 #include "compressor_test.h"
 #include "compressor.h"
+#include "futils.h"
+#include "value.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kGainSampleRate = 2 * vital::kDefaultSampleRate;
+    constexpr int kGainBlockSize = 128;
+    constexpr int kNumGainBlocks = 700;
+    constexpr float kBaseAttackMs = 1.4f;
+    constexpr float kBaseReleaseMs = 28.0f;
+    constexpr float kMinCheckedMagnitude = 0.0001f;
+    // Room for the polynomial log2 being applied to the thresholds and envelopes separately.
+    constexpr double kApproximationErrorDb = 0.01;
+
+    /**
+     * @brief Compressor settings for one run of the gain error test.
+     */
+    struct GainSettings {
+        float attack;
+        float release;
+        float upper_threshold;
+        float lower_threshold;
+        float upper_ratio;
+        float lower_ratio;
+    };
+
+    const GainSettings kGainSettings[] = {
+        { 0.5f, 0.5f, -20.0f, -40.0f, 0.8f, 0.5f },
+        { 0.0f, 0.0f, -10.0f, -30.0f, 1.0f, -1.0f },
+        { 1.0f, 1.0f, -30.0f, -60.0f, 0.5f, 0.8f },
+        { 0.2f, 0.8f, -6.0f, -70.0f, 1.0f, 0.0f },
+    };
+
+    /**
+     * @brief The gain curve evaluated every sample with two pow calls, the way the compressor used to.
+     */
+    class ReferenceGain {
+    public:
+        ReferenceGain(const GainSettings& settings) : high_(0.0f), low_(0.0f) {
+            float samples_per_ms = kGainSampleRate / static_cast<float>(vital::kMsPerSec);
+            attack_samples_ = vital::futils::exp(settings.attack * 8.0f - 4.0f) * kBaseAttackMs * samples_per_ms;
+            attack_samples_ = vital::utils::max(attack_samples_, 5.0f);
+            release_samples_ = vital::futils::exp(settings.release * 8.0f - 4.0f) * kBaseReleaseMs * samples_per_ms;
+            release_samples_ = vital::utils::max(release_samples_, 5.0f);
+            upper_threshold_ = vital::futils::dbToMagnitude(vital::poly_float(settings.upper_threshold));
+            upper_threshold_ *= upper_threshold_;
+            lower_threshold_ = vital::futils::dbToMagnitude(vital::poly_float(settings.lower_threshold));
+            lower_threshold_ *= lower_threshold_;
+            upper_ratio_ = settings.upper_ratio * 0.5f;
+            lower_ratio_ = settings.lower_ratio * 0.5f;
+        }
+
+        vital::poly_float next(vital::poly_float sample) {
+            vital::poly_float squared = sample * sample;
+            high_ = follow(squared, high_);
+            high_ = vital::utils::max(high_, upper_threshold_);
+            low_ = follow(squared, low_);
+            low_ = vital::utils::min(low_, lower_threshold_);
+
+            vital::poly_float upper = vital::futils::pow(upper_threshold_ / high_, upper_ratio_);
+            vital::poly_float lower = vital::futils::pow(lower_threshold_ / low_, lower_ratio_);
+            return vital::utils::clamp(upper * lower, 0.0f, 32.0f);
+        }
+
+    private:
+        vital::poly_float follow(vital::poly_float squared, vital::poly_float envelope) {
+            vital::poly_mask attack = vital::poly_float::greaterThan(squared, envelope);
+            vital::poly_float samples = vital::utils::maskLoad(release_samples_, attack_samples_, attack);
+            vital::poly_float scale = vital::poly_float(1.0f) / (samples + 1.0f);
+            return (squared + envelope * samples) * scale;
+        }
+
+        vital::poly_float high_;
+        vital::poly_float low_;
+        vital::poly_float attack_samples_;
+        vital::poly_float release_samples_;
+        vital::poly_float upper_threshold_;
+        vital::poly_float lower_threshold_;
+        vital::poly_float upper_ratio_;
+        vital::poly_float lower_ratio_;
+    };
+
+    /**
+     * @brief Exponential sine sweep from 20Hz to 20kHz rising from -60dB to +6dB, different in each lane.
+     */
+    vital::poly_float sweepSample(int index) {
+        constexpr double kLength = kGainBlockSize * kNumGainBlocks;
+        constexpr double kStartFrequency = 20.0;
+        constexpr double kOctaves = 9.97;
+
+        double t = index / kLength;
+        double phase = kStartFrequency * kLength / (kGainSampleRate * kOctaves * std::log(2.0)) *
+                       (std::exp2(kOctaves * t) - 1.0);
+        double amplitude = std::pow(10.0, (-60.0 + 66.0 * t) / 20.0);
+        double value = amplitude * std::sin(2.0 * vital::kPi * phase);
+
+        vital::poly_float result;
+        for (int i = 0; i < vital::poly_float::kSize; ++i)
+            result.set(i, value * (1.0 - 0.2 * i));
+        return result;
+    }
+
+    /**
+     * @brief Quiet sine with loud noise bursts and single sample clicks, for attacks and releases on transients.
+     */
+    vital::poly_float transientSample(int index, vital::utils::RandomGenerator& random) {
+        constexpr int kBurstPeriod = 3000;
+        constexpr int kBurstLength = 200;
+        constexpr int kClickOffset = 1700;
+
+        int position = index % kBurstPeriod;
+        vital::poly_float result = 0.003f * std::sin(2.0 * vital::kPi * 220.0 * index / kGainSampleRate);
+        if (position < kBurstLength)
+            result += random.polyNext();
+        else if (position == kClickOffset)
+            result += 1.5f;
+
+        return result;
+    }
+}
 
 void CompressorTest::runTest() {
     // Create a Compressor instance with arbitrary parameters.
@@ -13,6 +134,68 @@ void CompressorTest::runTest() {
     // Run a standardized input bounds test to ensure the compressor behaves correctly
     // with extreme and typical input values.
     runInputBoundsTest(&compressor);
+
+    runGainErrorTest(vital::Compressor::kDefaultGainInterval);
+    runGainErrorTest(vital::Compressor::kMaxGainInterval);
+}
+
+void CompressorTest::runGainErrorTest(int gain_interval) {
+    beginTest("Gain Error Interval " + std::to_string(gain_interval));
+
+    for (const GainSettings& settings : kGainSettings) {
+        for (int signal = 0; signal < 2; ++signal) {
+            vital::Compressor compressor(kBaseAttackMs, kBaseReleaseMs, kBaseAttackMs, kBaseReleaseMs);
+            compressor.setSampleRate(kGainSampleRate);
+            compressor.setGainInterval(gain_interval);
+            compressor.reset(vital::constants::kFullMask);
+
+            vital::Value attack(settings.attack, true);
+            vital::Value release(settings.release, true);
+            vital::Value upper_threshold(settings.upper_threshold, true);
+            vital::Value lower_threshold(settings.lower_threshold, true);
+            vital::Value upper_ratio(settings.upper_ratio, true);
+            vital::Value lower_ratio(settings.lower_ratio, true);
+            compressor.plug(&attack, vital::Compressor::kAttack);
+            compressor.plug(&release, vital::Compressor::kRelease);
+            compressor.plug(&upper_threshold, vital::Compressor::kUpperThreshold);
+            compressor.plug(&lower_threshold, vital::Compressor::kLowerThreshold);
+            compressor.plug(&upper_ratio, vital::Compressor::kUpperRatio);
+            compressor.plug(&lower_ratio, vital::Compressor::kLowerRatio);
+
+            ReferenceGain reference(settings);
+            vital::utils::RandomGenerator random(-1.0f, 1.0f);
+            vital::poly_float block[kGainBlockSize];
+            vital::poly_float reference_gains[kGainBlockSize];
+            double max_error = 0.0;
+
+            for (int b = 0; b < kNumGainBlocks; ++b) {
+                for (int i = 0; i < kGainBlockSize; ++i) {
+                    int index = b * kGainBlockSize + i;
+                    block[i] = signal == 0 ? sweepSample(index) : transientSample(index, random);
+                    reference_gains[i] = reference.next(block[i]);
+                }
+
+                compressor.processRms(block, kGainBlockSize);
+                const vital::poly_float* output = compressor.output()->buffer;
+
+                for (int i = 0; i < kGainBlockSize; ++i) {
+                    for (int v = 0; v < vital::poly_float::kSize; ++v) {
+                        float magnitude = std::fabs(block[i][v]);
+                        if (magnitude < kMinCheckedMagnitude)
+                            continue;
+
+                        double gain_db = 20.0 * std::log10(std::fabs(output[i][v]) / magnitude);
+                        double reference_db = 20.0 * std::log10(reference_gains[i][v]);
+                        max_error = std::max(max_error, std::fabs(gain_db - reference_db));
+                    }
+                }
+            }
+
+            std::string description = signal == 0 ? "Sweep" : "Transients";
+            expect(max_error <= vital::Compressor::kMaxGainErrorDb + kApproximationErrorDb,
+                   description + " gain error of " + std::to_string(max_error) + "dB is too large.");
+        }
+    }
 }
 
 // Registers the test instance so it will be automatically discovered and run.
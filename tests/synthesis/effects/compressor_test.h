@@ -13,7 +13,7 @@
  *
  * This test ensures that the Compressor processor handles various input conditions without producing
  * invalid or unexpected output. It uses the ProcessorTest base class to run standardized tests
- * such as input bounds testing.
+ * such as input bounds testing, and checks the interpolated gain against a gain evaluated every sample.
  */
 class CompressorTest : public ProcessorTest {
 public:
@@ -26,4 +26,12 @@ public:
      * @brief Runs the compressor test by performing input bounds checks and verifying the compressor's stability.
      */
     void runTest() override;
+
+private:
+    /**
+     * @brief Checks that the compressor gain stays within Compressor::kMaxGainErrorDb of the per sample gain.
+     *
+     * @param gain_interval The gain interval to run the compressor with.
+     */
+    void runGainErrorTest(int gain_interval);
 };
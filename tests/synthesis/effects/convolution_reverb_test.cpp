@@ -0,0 +1,173 @@
+/**
+ * @file convolution_reverb_test.cpp
+ * @brief Implements the ConvolutionReverbTest class, checking the ConvolutionReverb against direct convolution.
+ */
+
+#include "convolution_reverb_test.h"
+#include "convolution_reverb.h"
+#include "value.h"
+
+#include <cmath>
+
+namespace {
+    /// Response length covering the direct, head and several tail partitions.
+    constexpr int kResponseLength = vital::ConvolutionReverb::kTailOffset + 3 * vital::ConvolutionReverb::kTailPartitionSize + 77;
+    /// Number of samples to convolve and compare.
+    constexpr int kNumComparedSamples = kResponseLength + 2 * vital::ConvolutionReverb::kTailPartitionSize;
+    /// Largest allowed difference from the direct convolution.
+    constexpr double kMaxError = 0.0001;
+    /// Irregular block sizes so partition boundaries land in the middle of blocks.
+    constexpr int kBlockSizes[] = { 1, 37, 128, 64, 5, 100, 128, 3 };
+}
+
+namespace {
+    /// Longest wait for the worker to rebuild the response after a sample rate change.
+    constexpr int kMaxRebuildWaitMs = 2000;
+
+    /**
+     * @brief Fills a stereo response with noise normalized to unit energy so the reverb's own normalization is a no-op.
+     */
+    void createUnitResponse(vital::mono_float* left, vital::mono_float* right, int length) {
+        double left_energy = 0.0;
+        double right_energy = 0.0;
+        for (int i = 0; i < length; ++i) {
+            left[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+            right[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+            left_energy += left[i] * left[i];
+            right_energy += right[i] * right[i];
+        }
+        vital::mono_float scale = 1.0f / std::sqrt(std::max(left_energy, right_energy));
+        for (int i = 0; i < length; ++i) {
+            left[i] *= scale;
+            right[i] *= scale;
+        }
+    }
+
+    /**
+     * @brief Runs noise through the reverb in irregular blocks and returns the largest difference from a direct
+     *        convolution with the response.
+     */
+    double convolutionError(vital::ConvolutionReverb* reverb, vital::Output* audio,
+                            const vital::mono_float* left, const vital::mono_float* right) {
+        std::unique_ptr<vital::mono_float[]> input_left = std::make_unique<vital::mono_float[]>(kNumComparedSamples);
+        std::unique_ptr<vital::mono_float[]> input_right = std::make_unique<vital::mono_float[]>(kNumComparedSamples);
+        for (int i = 0; i < kNumComparedSamples; ++i) {
+            input_left[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+            input_right[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+        }
+
+        double max_error = 0.0;
+        int position = 0;
+        int block = 0;
+        while (position < kNumComparedSamples) {
+            int num_block_samples = std::min(kBlockSizes[block++ % 8], kNumComparedSamples - position);
+            for (int i = 0; i < num_block_samples; ++i)
+                audio->buffer[i] = vital::poly_float(input_left[position + i], input_right[position + i], 0.0f, 0.0f);
+            reverb->process(num_block_samples);
+
+            for (int i = 0; i < num_block_samples; ++i) {
+                int sample = position + i;
+                double expected_left = 0.0;
+                double expected_right = 0.0;
+                for (int t = std::max(0, sample - kResponseLength + 1); t <= sample; ++t) {
+                    expected_left += input_left[t] * (double)left[sample - t];
+                    expected_right += input_right[t] * (double)right[sample - t];
+                }
+
+                vital::poly_float result = reverb->output()->buffer[i];
+                max_error = std::max(max_error, std::abs(result[0] - expected_left));
+                max_error = std::max(max_error, std::abs(result[1] - expected_right));
+            }
+            position += num_block_samples;
+        }
+
+        return max_error;
+    }
+}
+
+void ConvolutionReverbTest::runAccuracyTest() {
+    beginTest("Matches Direct Convolution");
+
+    std::unique_ptr<vital::mono_float[]> left = std::make_unique<vital::mono_float[]>(kResponseLength);
+    std::unique_ptr<vital::mono_float[]> right = std::make_unique<vital::mono_float[]>(kResponseLength);
+    createUnitResponse(left.get(), right.get(), kResponseLength);
+
+    std::shared_ptr<vital::ImpulseResponse> impulse_response = std::make_shared<vital::ImpulseResponse>();
+    vital::ConvolutionReverb reverb(impulse_response);
+    reverb.setSampleRate(vital::kDefaultSampleRate);
+    impulse_response->loadSample(left.get(), right.get(), kResponseLength, vital::kDefaultSampleRate);
+    expectEquals(reverb.getKernelLength(), kResponseLength);
+
+    vital::Output audio;
+    vital::Value wet(1.0f);
+    reverb.plug(&audio, vital::ConvolutionReverb::kAudio);
+    reverb.plug(&wet, vital::ConvolutionReverb::kWet);
+
+    // Settle the wet/dry smoothing on silence.
+    for (int i = 0; i < vital::kMaxBufferSize; ++i)
+        audio.buffer[i] = 0.0f;
+    reverb.process(vital::kMaxBufferSize);
+
+    double max_error = convolutionError(&reverb, &audio, left.get(), right.get());
+    expect(max_error < kMaxError, "Convolution differs from direct convolution by " + String(max_error));
+
+    // Tail history from before a reset must not leak into the output afterwards.
+    reverb.hardReset();
+    max_error = convolutionError(&reverb, &audio, left.get(), right.get());
+    expect(max_error < kMaxError, "Convolution after reset differs from direct convolution by " + String(max_error));
+}
+
+void ConvolutionReverbTest::runSampleRateTest() {
+    beginTest("Rebuilds For Sample Rate");
+
+    std::unique_ptr<vital::mono_float[]> left = std::make_unique<vital::mono_float[]>(kResponseLength);
+    std::unique_ptr<vital::mono_float[]> right = std::make_unique<vital::mono_float[]>(kResponseLength);
+    createUnitResponse(left.get(), right.get(), kResponseLength);
+
+    std::shared_ptr<vital::ImpulseResponse> impulse_response = std::make_shared<vital::ImpulseResponse>();
+    impulse_response->loadSample(left.get(), right.get(), kResponseLength, vital::kDefaultSampleRate);
+    vital::ConvolutionReverb reverb(impulse_response);
+
+    vital::Output audio;
+    vital::Value wet(1.0f);
+    reverb.plug(&audio, vital::ConvolutionReverb::kAudio);
+    reverb.plug(&wet, vital::ConvolutionReverb::kWet);
+    for (int i = 0; i < vital::kMaxBufferSize; ++i)
+        audio.buffer[i] = 0.0f;
+
+    // The worker builds the response for the new rate while processing keeps using the old one.
+    int sample_rate = 2 * vital::kDefaultSampleRate;
+    reverb.setSampleRate(sample_rate);
+    int waited = 0;
+    while (reverb.getKernelSampleRate() != sample_rate && waited < kMaxRebuildWaitMs) {
+        reverb.process(vital::kMaxBufferSize);
+        Thread::sleep(1);
+        waited++;
+    }
+    expectEquals(reverb.getKernelSampleRate(), sample_rate);
+    expectEquals(reverb.getKernelLength(), 2 * kResponseLength);
+
+    // Switching back reuses the same path and the output matches the original response again.
+    reverb.setSampleRate(vital::kDefaultSampleRate);
+    waited = 0;
+    while (reverb.getKernelSampleRate() != vital::kDefaultSampleRate && waited < kMaxRebuildWaitMs) {
+        reverb.process(vital::kMaxBufferSize);
+        Thread::sleep(1);
+        waited++;
+    }
+    reverb.process(vital::kMaxBufferSize);
+
+    double max_error = convolutionError(&reverb, &audio, left.get(), right.get());
+    expect(max_error < kMaxError, "Convolution after rebuild differs from direct convolution by " + String(max_error));
+}
+
+void ConvolutionReverbTest::runTest() {
+    vital::ConvolutionReverb reverb;
+    runInputBoundsTest(&reverb);
+
+    runAccuracyTest();
+    runSampleRateTest();
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static ConvolutionReverbTest convolution_reverb_test;
@@ -0,0 +1,39 @@
+/**
+ * @file convolution_reverb_test.h
+ * @brief Declares the ConvolutionReverbTest class, which tests the ConvolutionReverb processor.
+ */
+
+#pragma once
+
+#include "processor_test.h"
+
+/**
+ * @class ConvolutionReverbTest
+ * @brief A test class that verifies the stability and accuracy of the ConvolutionReverb processor.
+ *
+ * Besides the standard input bounds checks, the output is compared against a direct convolution
+ * with an impulse response long enough to use every partition section, including after a reset and
+ * after the response is rebuilt for a new sample rate.
+ */
+class ConvolutionReverbTest : public ProcessorTest {
+public:
+    /**
+     * @brief Constructs a new ConvolutionReverbTest with a specified test name.
+     */
+    ConvolutionReverbTest() : ProcessorTest("Convolution Reverb") { }
+
+    /**
+     * @brief Runs the input bounds checks and the direct convolution comparison.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Compares the partitioned output with a direct convolution using irregular block sizes.
+     */
+    void runAccuracyTest();
+
+    /**
+     * @brief Checks the response is rebuilt in the background after a sample rate change.
+     */
+    void runSampleRateTest();
+};
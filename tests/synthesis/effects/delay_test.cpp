@@ -6,6 +6,76 @@
 #include "delay_test.h"
 #include "delay.h"
 #include "memory.h"
+#include "value.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kDelayBlockSize = 64;
+    constexpr int kNumWarmupBlocks = 200;
+    constexpr int kNumDelayBlocks = 400;
+    // Only rounding differences are allowed once both delays have settled.
+    constexpr float kMaxDelayDifference = 0.00001f;
+    constexpr float kMaxTestDelay = 0.08f;
+    constexpr int kLargeDelaySamples = 1 << 16;
+} // namespace
+
+void DelayTest::runMaxSamplesTest(int style) {
+    beginTest("Max Samples Style " + String(style));
+
+    vital::MultiDelay sized_delay(kMaxTestDelay * vital::kDefaultSampleRate + 1);
+    vital::MultiDelay large_delay(kLargeDelaySamples);
+
+    vital::Value wet(1.0f);
+    vital::Value feedback(0.6f);
+    vital::Value cutoff(70.0f);
+    vital::Value spread(0.5f);
+    vital::Value damping(0.5f);
+    vital::Value style_value(style);
+    vital::Value frequency;
+
+    vital::MultiDelay* delays[] = { &sized_delay, &large_delay };
+    for (vital::MultiDelay* delay : delays) {
+        delay->plug(&wet, vital::MultiDelay::kWet);
+        delay->plug(&frequency, vital::MultiDelay::kFrequency);
+        delay->plug(&frequency, vital::MultiDelay::kFrequencyAux);
+        delay->plug(&feedback, vital::MultiDelay::kFeedback);
+        delay->plug(&damping, vital::MultiDelay::kDamping);
+        delay->plug(&style_value, vital::MultiDelay::kStyle);
+        delay->plug(&cutoff, vital::MultiDelay::kFilterCutoff);
+        delay->plug(&spread, vital::MultiDelay::kFilterSpread);
+    }
+
+    vital::poly_float audio[kDelayBlockSize];
+    float max_difference = 0.0f;
+    for (int b = -kNumWarmupBlocks; b < kNumDelayBlocks; ++b) {
+        // Sweep the delay time up to the longest delay the memory was sized for.
+        float sweep = 0.5f - 0.5f * std::cos(std::max(b, 0) * 0.05f);
+        vital::poly_float delay_time(0.001f + sweep * (kMaxTestDelay - 0.001f), 0.002f + sweep * 0.03f,
+                                     kMaxTestDelay - sweep * 0.05f, 0.01f);
+        frequency.set(vital::poly_float(1.0f) / delay_time);
+
+        for (int i = 0; i < kDelayBlockSize; ++i)
+            audio[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+
+        sized_delay.processWithInput(audio, kDelayBlockSize);
+        large_delay.processWithInput(audio, kDelayBlockSize);
+
+        // New delays glide in from a period longer than either memory, which each clamps to its own size.
+        if (b < 0)
+            continue;
+
+        const vital::poly_float* sized_out = sized_delay.output()->buffer;
+        const vital::poly_float* large_out = large_delay.output()->buffer;
+        for (int i = 0; i < kDelayBlockSize; ++i) {
+            for (int v = 0; v < vital::poly_float::kSize; ++v)
+                max_difference = std::max(max_difference, std::abs(sized_out[i][v] - large_out[i][v]));
+        }
+    }
+
+    expect(max_difference <= kMaxDelayDifference, "Sized delay output differs from the large delay by " +
+                                                  String(max_difference));
+}
 
 void DelayTest::runTest() {
     // Create delay processors with a specific memory size.
@@ -16,6 +86,10 @@ void DelayTest::runTest() {
     // to ensure they handle extreme input conditions gracefully.
     runInputBoundsTest(&multi_delay);
     runInputBoundsTest(&stereo_delay);
+
+    runMaxSamplesTest(vital::MultiDelay::kMono);
+    runMaxSamplesTest(vital::MultiDelay::kClampedUnfiltered);
+    runMaxSamplesTest(vital::MultiDelay::kClampedDampened);
 }
 
 // Registers the test instance so it will be automatically discovered and run.
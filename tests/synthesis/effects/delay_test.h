@@ -13,7 +13,8 @@
  *
  * This class tests various delay processors, such as MultiDelay and StereoDelay, to ensure they
  * produce stable output and handle extreme input values properly. By extending ProcessorTest,
- * it leverages standardized testing methods like input bounds tests.
+ * it leverages standardized testing methods like input bounds tests. It also checks that shrinking
+ * the delay memory down to the longest delay time used doesn't change the output.
  */
 class DelayTest : public ProcessorTest {
 public:
@@ -26,4 +27,12 @@ public:
      * @brief Runs the delay test by performing input bounds checks on the tested delay processors.
      */
     void runTest() override;
+
+private:
+    /**
+     * @brief Checks that a delay sized to its longest delay time sounds the same as one with a far larger memory.
+     *
+     * @param style The delay style to run both delays with.
+     */
+    void runMaxSamplesTest(int style);
 };
@@ -5,6 +5,90 @@
 
 #include "distortion_test.h"
 #include "distortion.h"
+#include "fourier_transform.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kSpectrumBits = 12;
+    constexpr int kSpectrumSize = 1 << kSpectrumBits;
+    // An odd block size so frames of two compacted samples cross block boundaries both ways.
+    constexpr int kDistortionBlockSize = 63;
+    // Prime so aliased harmonics don't land on the harmonics that fit below nyquist.
+    constexpr int kHighSineBin = 467;
+    constexpr float kSineAmplitude = 0.7f;
+    constexpr float kMaxMidpointDifference = 0.01f;
+    constexpr float kMinAliasReduction = 10.0f;
+
+    const int kAntiAliasTypes[] = {
+        vital::Distortion::kSoftClip,
+        vital::Distortion::kHardClip,
+        vital::Distortion::kLinearFold,
+        vital::Distortion::kSinFold
+    };
+
+    const float kAntiAliasDrives[] = { 24.0f, 18.0f, 12.0f, 12.0f };
+
+    /**
+     * @brief Runs a sine through a distortion and returns the left channel of the last kSpectrumSize samples.
+     */
+    std::vector<float> renderSine(int type, float drive_db, bool anti_alias, double cycles_per_sample) {
+        vital::Distortion distortion;
+        vital::Output audio;
+        vital::Output drive;
+        audio.ensureBufferSize(vital::kMaxBufferSize);
+        drive.ensureBufferSize(vital::kMaxBufferSize);
+        vital::Value type_value(type);
+        vital::Value anti_alias_value(anti_alias ? 1.0f : 0.0f);
+        distortion.plug(&audio, vital::Distortion::kAudio);
+        distortion.plug(&type_value, vital::Distortion::kType);
+        distortion.plug(&drive, vital::Distortion::kDrive);
+        distortion.plug(&anti_alias_value, vital::Distortion::kAntiAlias);
+
+        // The first period lets the anti-aliased state settle so the analyzed one is exactly periodic.
+        int total_samples = 2 * kSpectrumSize;
+        std::vector<float> result(kSpectrumSize);
+        for (int start = 0; start < total_samples; start += kDistortionBlockSize) {
+            int num_samples = std::min(kDistortionBlockSize, total_samples - start);
+            for (int i = 0; i < num_samples; ++i) {
+                double phase = cycles_per_sample * (start + i);
+                audio.buffer[i] = kSineAmplitude * std::sin(2.0 * vital::kPi * (phase - std::floor(phase)));
+                drive.buffer[i] = drive_db;
+            }
+
+            distortion.process(num_samples);
+            for (int i = 0; i < num_samples; ++i) {
+                int index = start + i - kSpectrumSize;
+                if (index >= 0)
+                    result[index] = distortion.output(vital::Distortion::kAudioOut)->buffer[i][0];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the aliased energy below the fundamental relative to the harmonics, in dB.
+     *
+     * Aliases below the fundamental aren't masked by any harmonic so they're the most audible ones.
+     */
+    float aliasRatio(const std::vector<float>& samples, int fundamental_bin) {
+        vital::FourierTransform transform(kSpectrumBits);
+        std::vector<float> data(2 * kSpectrumSize, 0.0f);
+        std::copy(samples.begin(), samples.end(), data.begin());
+        transform.transformRealForward(data.data());
+
+        double harmonic_energy = 0.0;
+        double alias_energy = 0.0;
+        for (int bin = 1; bin < kSpectrumSize / 2; ++bin) {
+            double energy = data[2 * bin] * data[2 * bin] + data[2 * bin + 1] * data[2 * bin + 1];
+            if (bin % fundamental_bin == 0)
+                harmonic_energy += energy;
+            else if (bin < fundamental_bin)
+                alias_energy += energy;
+        }
+        return 10.0f * std::log10(alias_energy / harmonic_energy);
+    }
+} // namespace
 
 void DistortionTest::runTest() {
     // Create a Distortion processor instance.
@@ -17,6 +101,50 @@ void DistortionTest::runTest() {
     // Run input bounds tests on the distortion processor, ensuring that for extreme inputs,
     // the processor outputs remain finite. We ignore certain outputs that aren't crucial to the main test.
     runInputBoundsTest(&distortion, std::set<int>(), ignored_outputs);
+
+    runAntiAliasAccuracyTest();
+    runAntiAliasSpectrumTest();
+}
+
+void DistortionTest::runAntiAliasAccuracyTest() {
+    beginTest("Anti-Alias Accuracy");
+
+    // On a slow sine the average of the shaper between two samples is the shaper at their midpoint.
+    double cycles_per_sample = 1.0 / kSpectrumSize;
+    for (int t = 0; t < 4; ++t) {
+        int type = kAntiAliasTypes[t];
+        float drive = kAntiAliasDrives[t];
+        std::vector<float> output = renderSine(type, drive, true, cycles_per_sample);
+        vital::poly_float drive_mult = vital::Distortion::getDriveValue(type, drive);
+
+        float max_difference = 0.0f;
+        for (int i = 1; i < kSpectrumSize; ++i) {
+            double midpoint_phase = cycles_per_sample * (kSpectrumSize + i - 0.5);
+            float midpoint = kSineAmplitude * std::sin(2.0 * vital::kPi * midpoint_phase);
+            float expected = vital::Distortion::getDrivenValue(type, midpoint, drive_mult)[0];
+            max_difference = std::max(max_difference, std::abs(output[i] - expected));
+        }
+
+        expect(max_difference < kMaxMidpointDifference,
+               "Anti-aliased distortion type " + String(type) + " differs from its shaper by " + String(max_difference));
+    }
+}
+
+void DistortionTest::runAntiAliasSpectrumTest() {
+    beginTest("Anti-Alias Spectrum");
+
+    double cycles_per_sample = static_cast<double>(kHighSineBin) / kSpectrumSize;
+    for (int t = 0; t < 4; ++t) {
+        int type = kAntiAliasTypes[t];
+        float plain = aliasRatio(renderSine(type, kAntiAliasDrives[t], false, cycles_per_sample), kHighSineBin);
+        float anti_aliased = aliasRatio(renderSine(type, kAntiAliasDrives[t], true, cycles_per_sample), kHighSineBin);
+        logMessage("Distortion type " + String(type) + " aliasing: " + String(plain, 1) + " dB plain, " +
+                   String(anti_aliased, 1) + " dB anti-aliased");
+
+        expect(plain - anti_aliased >= kMinAliasReduction,
+               "Anti-aliased distortion type " + String(type) + " only reduced aliasing by " +
+               String(plain - anti_aliased) + " dB");
+    }
 }
 
 // Registers the test instance so it will be automatically discovered and run.
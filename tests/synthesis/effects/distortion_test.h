@@ -13,7 +13,9 @@
  *
  * This test ensures that the Distortion processor handles a wide range of input values without producing
  * invalid outputs (such as NaNs or infinities). It uses the ProcessorTest framework to run standardized
- * input bounds tests, ignoring certain outputs that aren't relevant to the main distortion output.
+ * input bounds tests, ignoring certain outputs that aren't relevant to the main distortion output. It also checks
+ * that the anti-aliased waveshapers follow the plain ones and measures their aliasing against the plain ones
+ * at 1x.
  */
 class DistortionTest : public ProcessorTest {
 public:
@@ -27,4 +29,15 @@ public:
      *        output remains valid under extreme input conditions.
      */
     void runTest() override;
+
+private:
+    /**
+     * @brief Checks the anti-aliased shapers against the plain shapers on a slow sine.
+     */
+    void runAntiAliasAccuracyTest();
+
+    /**
+     * @brief Checks that the anti-aliased shapers alias less than the plain ones on a high sine.
+     */
+    void runAntiAliasSpectrumTest();
 };
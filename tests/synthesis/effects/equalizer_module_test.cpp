@@ -0,0 +1,155 @@
+/**
+ * @file equalizer_module_test.cpp
+ * @brief Implements the EqualizerModuleTest class, comparing the EqualizerModule against its filters run separately.
+ */
+
+#include "equalizer_module_test.h"
+#include "digital_svf.h"
+#include "equalizer_module.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kNumEqBlocks = 200;
+    constexpr int kEqBlockSize = 64;
+    // The chain steps the same filters in the same order, so only rounding differences are allowed.
+    constexpr float kMaxChainDifference = 0.00001f;
+    constexpr float kMaxEqOutput = 8.0f;
+
+    /**
+     * @brief Equalizer that can also run its filters as three separate processors like it used to.
+     */
+    class SeparateEqualizer : public vital::EqualizerModule {
+    public:
+        void processSeparately(const vital::poly_float* audio_in, int num_samples) {
+            vital::SynthModule::process(num_samples);
+
+            vital::Processor* low_processor = low_mode_->value() ? high_pass_ : low_shelf_;
+            vital::Processor* band_processor = band_mode_->value() ? notch_ : band_shelf_;
+            vital::Processor* high_processor = high_mode_->value() ? low_pass_ : high_shelf_;
+
+            low_processor->processWithInput(audio_in, num_samples);
+            band_processor->processWithInput(low_processor->output()->buffer, num_samples);
+            high_processor->processWithInput(band_processor->output()->buffer, num_samples);
+            vital::utils::copyBuffer(output()->buffer, high_processor->output()->buffer, num_samples);
+        }
+    };
+
+    void setControl(vital::SynthModule* module, const std::string& name, vital::mono_float value) {
+        module->getControls()[name]->set(value);
+    }
+
+    void setBothControls(vital::SynthModule* one, vital::SynthModule* two, const std::string& name, vital::mono_float value) {
+        setControl(one, name, value);
+        setControl(two, name, value);
+    }
+
+    void fillNoise(vital::poly_float* buffer, int num_samples) {
+        for (int i = 0; i < num_samples; ++i)
+            buffer[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+    }
+
+    float maxDifference(const vital::poly_float* one, const vital::poly_float* two, int num_samples) {
+        float result = 0.0f;
+        for (int i = 0; i < num_samples; ++i) {
+            for (int v = 0; v < vital::poly_float::kSize; ++v)
+                result = std::max(result, std::abs(one[i][v] - two[i][v]));
+        }
+        return result;
+    }
+} // namespace
+
+void EqualizerModuleTest::runChainTest() {
+    beginTest("Equalizer Chain");
+
+    vital::EqualizerModule equalizer;
+    SeparateEqualizer reference;
+    equalizer.init();
+    reference.init();
+
+    vital::poly_float audio[kEqBlockSize];
+    float max_difference = 0.0f;
+    int num_modes = 1 << vital::EqualizerModule::kNumBands;
+    for (int mode = 0; mode < num_modes; ++mode) {
+        setBothControls(&equalizer, &reference, "eq_low_mode", mode & 1);
+        setBothControls(&equalizer, &reference, "eq_band_mode", (mode >> 1) & 1);
+        setBothControls(&equalizer, &reference, "eq_high_mode", (mode >> 2) & 1);
+        setBothControls(&equalizer, &reference, "eq_low_gain", 6.0f);
+        setBothControls(&equalizer, &reference, "eq_band_gain", -9.0f);
+        setBothControls(&equalizer, &reference, "eq_high_gain", 3.0f);
+        setBothControls(&equalizer, &reference, "eq_low_resonance", 0.2f + 0.1f * mode);
+        setBothControls(&equalizer, &reference, "eq_band_resonance", 0.6f);
+        setBothControls(&equalizer, &reference, "eq_high_resonance", 0.8f - 0.1f * mode);
+
+        for (int b = 0; b < kNumEqBlocks; ++b) {
+            // Move the band cutoff part way through so the chain sees smoothed, audio rate cutoffs.
+            if (b == kNumEqBlocks / 2)
+                setBothControls(&equalizer, &reference, "eq_band_cutoff", 40.0f + 10.0f * mode);
+
+            fillNoise(audio, kEqBlockSize);
+            equalizer.processWithInput(audio, kEqBlockSize);
+            reference.processSeparately(audio, kEqBlockSize);
+            max_difference = std::max(max_difference,
+                                      maxDifference(equalizer.output()->buffer, reference.output()->buffer, kEqBlockSize));
+        }
+    }
+
+    expect(max_difference <= kMaxChainDifference, "Equalizer chain differs from separate filters by " +
+                                                  String(max_difference));
+}
+
+void EqualizerModuleTest::runFlatTest() {
+    beginTest("Equalizer Flat Shelves");
+
+    vital::EqualizerModule equalizer;
+    equalizer.init();
+    setControl(&equalizer, "eq_low_mode", 0.0f);
+    setControl(&equalizer, "eq_band_mode", 0.0f);
+    setControl(&equalizer, "eq_high_mode", 0.0f);
+    setControl(&equalizer, "eq_low_gain", 0.0f);
+    setControl(&equalizer, "eq_band_gain", 0.0f);
+    setControl(&equalizer, "eq_high_gain", 0.0f);
+
+    // The first block fades the shelves in from their reset state, after that they're flat and skipped.
+    vital::poly_float audio[kEqBlockSize];
+    fillNoise(audio, kEqBlockSize);
+    equalizer.processWithInput(audio, kEqBlockSize);
+
+    float flat_difference = 0.0f;
+    for (int b = 0; b < kNumEqBlocks; ++b) {
+        fillNoise(audio, kEqBlockSize);
+        equalizer.processWithInput(audio, kEqBlockSize);
+        flat_difference = std::max(flat_difference, maxDifference(equalizer.output()->buffer, audio, kEqBlockSize));
+    }
+
+    expect(flat_difference == 0.0f, "Flat equalizer changes audio by " + String(flat_difference));
+
+    // Bring each shelf in and out of the chain on its own and all together.
+    const std::string gains[] = { "eq_low_gain", "eq_band_gain", "eq_high_gain" };
+    float max_output = 0.0f;
+    for (int b = 0; b < kNumEqBlocks; ++b) {
+        for (int g = 0; g < vital::EqualizerModule::kNumBands; ++g) {
+            bool on = ((b >> g) & 1) != 0;
+            setControl(&equalizer, gains[g], on ? 12.0f - 9.0f * g : 0.0f);
+        }
+
+        fillNoise(audio, kEqBlockSize);
+        equalizer.processWithInput(audio, kEqBlockSize);
+        for (int i = 0; i < kEqBlockSize; ++i) {
+            vital::poly_float sample = equalizer.output()->buffer[i];
+            expect(vital::utils::isFinite(sample), "Equalizer output is not finite");
+            for (int v = 0; v < vital::poly_float::kSize; ++v)
+                max_output = std::max(max_output, std::abs(sample[v]));
+        }
+    }
+
+    expect(max_output <= kMaxEqOutput, "Equalizer output reached " + String(max_output));
+}
+
+void EqualizerModuleTest::runTest() {
+    runChainTest();
+    runFlatTest();
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static EqualizerModuleTest equalizer_module_test;
@@ -0,0 +1,39 @@
+/**
+ * @file equalizer_module_test.h
+ * @brief Declares the EqualizerModuleTest class, which tests the EqualizerModule processor.
+ */
+
+#pragma once
+
+#include "processor_test.h"
+
+/**
+ * @class EqualizerModuleTest
+ * @brief A test class that verifies the EqualizerModule's single pass filter chain.
+ *
+ * Checks the equalizer against its filters run one after another as separate processors, and that shelves
+ * sitting at 0 dB pass audio through unchanged.
+ */
+class EqualizerModuleTest : public ProcessorTest {
+public:
+    /**
+     * @brief Constructs a new EqualizerModuleTest with the specified test name.
+     */
+    EqualizerModuleTest() : ProcessorTest("Equalizer Module") { }
+
+    /**
+     * @brief Runs the chain and flat shelf tests.
+     */
+    void runTest() override;
+
+private:
+    /**
+     * @brief Checks the equalizer output against the filters processed separately.
+     */
+    void runChainTest();
+
+    /**
+     * @brief Checks that flat shelves pass audio through and that the equalizer stays stable as gains move.
+     */
+    void runFlatTest();
+};
@@ -6,6 +6,78 @@
 #include "comb_filter_test.h"
 #include "comb_filter.h"
 
+#include <cmath>
+
+namespace {
+    constexpr int kMaxCombSamples = 25000;
+    constexpr int kReservedCombSize = 4096;
+    constexpr int kLongPeriod = 10000;
+    constexpr int kCombBlockSize = 64;
+    constexpr int kMaxGrowthWaitMs = 2000;
+    constexpr int kMaxEchoError = 2;
+} // namespace
+
+void CombFilterTest::runMemoryGrowthTest() {
+    beginTest("Memory Growth");
+
+    vital::CombFilter comb_filter(kMaxCombSamples);
+    expectEquals(comb_filter.getMemorySize(), kReservedCombSize);
+
+    vital::Output audio;
+    vital::Output midi_cutoff;
+    audio.ensureBufferSize(vital::kMaxBufferSize);
+    midi_cutoff.ensureBufferSize(vital::kMaxBufferSize);
+    vital::Value style(vital::CombFilter::kComb);
+    vital::Value resonance(1.0f);
+    vital::Value blend(1.0f);
+    vital::Value reset(0.0f);
+    comb_filter.plug(&audio, vital::CombFilter::kAudio);
+    comb_filter.plug(&midi_cutoff, vital::CombFilter::kMidiCutoff);
+    comb_filter.plug(&style, vital::CombFilter::kStyle);
+    comb_filter.plug(&resonance, vital::CombFilter::kResonance);
+    comb_filter.plug(&blend, vital::CombFilter::kPassBlend);
+    comb_filter.plug(&reset, vital::CombFilter::kReset);
+
+    float frequency = vital::kDefaultSampleRate / (1.0f * kLongPeriod);
+    float midi = vital::utils::frequencyToMidiNote(frequency);
+    for (int i = 0; i < kCombBlockSize; ++i) {
+        audio.buffer[i] = 0.0f;
+        midi_cutoff.buffer[i] = midi;
+    }
+
+    // The first block asks for more memory, which shows up on a later block.
+    int waited = 0;
+    while (comb_filter.getMemorySize() < kLongPeriod && waited < kMaxGrowthWaitMs) {
+        comb_filter.process(kCombBlockSize);
+        Thread::sleep(1);
+        waited++;
+    }
+    int expected_size = vital::utils::nextPowerOfTwo(kLongPeriod);
+    expectEquals(comb_filter.getMemorySize(), expected_size);
+
+    // Send an impulse through and find its first echo.
+    comb_filter.hardReset();
+    int echo_index = 0;
+    float echo = 0.0f;
+    int total_samples = kLongPeriod + kCombBlockSize * 4;
+    for (int start = 0; start < total_samples; start += kCombBlockSize) {
+        for (int i = 0; i < kCombBlockSize; ++i)
+            audio.buffer[i] = start + i == 0 ? 1.0f : 0.0f;
+
+        comb_filter.process(kCombBlockSize);
+        for (int i = 0; i < kCombBlockSize; ++i) {
+            float value = std::abs(comb_filter.output()->buffer[i][0]);
+            if (start + i > kLongPeriod / 2 && value > echo) {
+                echo = value;
+                echo_index = start + i;
+            }
+        }
+    }
+
+    expect(std::abs(echo_index - kLongPeriod) <= kMaxEchoError,
+           "Comb echo came after " + String(echo_index) + " samples instead of " + String(kLongPeriod));
+}
+
 void CombFilterTest::runTest() {
     // Create a CombFilter processor with a certain memory size.
     vital::CombFilter comb_filter(5000);
@@ -23,6 +95,8 @@ void CombFilterTest::runTest() {
         style.set(i);
         runInputBoundsTest(&comb_filter, ignored_inputs, std::set<int>());
     }
+
+    runMemoryGrowthTest();
 }
 
 // Registers the test instance so it will be automatically discovered and run.
@@ -13,7 +13,8 @@
  *
  * This test runs input bounds checks on the CombFilter under various filter styles. By doing so,
  * it ensures that the CombFilter remains stable and produces finite outputs across a wide range
- * of input conditions and filter types.
+ * of input conditions and filter types. It also checks that the delay memory starts small and grows
+ * when a longer period is requested.
  */
 class CombFilterTest : public ProcessorTest {
 public:
@@ -27,4 +28,10 @@ public:
      *        applying input bounds tests, and ensuring the output is stable.
      */
     void runTest() override;
+
+private:
+    /**
+     * @brief Checks that the delay memory grows in the background and then delays by the full period.
+     */
+    void runMemoryGrowthTest();
 };
@@ -4,7 +4,83 @@
  */
 
 #include "formant_filter_test.h"
+#include "digital_svf.h"
 #include "formant_filter.h"
+#include "formant_manager.h"
+#include "value.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kNumBankBlocks = 200;
+    constexpr int kBankBlockSize = 64;
+    // The bank steps the same filters in the same order, so only rounding differences are allowed.
+    constexpr float kMaxBankDifference = 0.00001f;
+} // namespace
+
+void FormantFilterTest::runBankTest() {
+    beginTest("Formant Bank");
+
+    vital::FormantManager manager(vital::kNumFormants);
+    vital::DigitalSvf reference[vital::kNumFormants];
+
+    vital::Output audio;
+    audio.ensureBufferSize(vital::kMaxBufferSize);
+    vital::Output midi_cutoffs[vital::kNumFormants];
+    vital::Value resonances[vital::kNumFormants];
+    vital::Value gains[vital::kNumFormants];
+    vital::Value reset(0.0f);
+    vital::Value drive(6.0f);
+    vital::Value style(vital::DigitalSvf::k12Db);
+    vital::Value pass_blend(1.0f);
+
+    for (int f = 0; f < vital::kNumFormants; ++f) {
+        midi_cutoffs[f].ensureBufferSize(vital::kMaxBufferSize);
+        resonances[f].set(0.3f + 0.2f * f);
+        gains[f].set(-4.0f * f);
+        reference[f].setResonanceBounds(vital::FormantManager::kMinResonance, vital::FormantManager::kMaxResonance);
+
+        vital::Processor* formants[] = { manager.getFormant(f), &reference[f] };
+        for (vital::Processor* formant : formants) {
+            formant->plug(&audio, vital::DigitalSvf::kAudio);
+            formant->plug(&reset, vital::DigitalSvf::kReset);
+            formant->plug(&midi_cutoffs[f], vital::DigitalSvf::kMidiCutoff);
+            formant->plug(&resonances[f], vital::DigitalSvf::kResonance);
+            formant->plug(&drive, vital::DigitalSvf::kDriveGain);
+            formant->plug(&gains[f], vital::DigitalSvf::kGain);
+            formant->plug(&style, vital::DigitalSvf::kStyle);
+            formant->plug(&pass_blend, vital::DigitalSvf::kPassBlend);
+        }
+    }
+
+    float max_difference = 0.0f;
+    int sample = 0;
+    for (int b = 0; b < kNumBankBlocks; ++b) {
+        for (int i = 0; i < kBankBlockSize; ++i, ++sample) {
+            audio.buffer[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+            // Each formant sweeps at its own rate, one of them at audio rate.
+            for (int f = 0; f < vital::kNumFormants; ++f)
+                midi_cutoffs[f].buffer[i] = 60.0f + 12.0f * f + 10.0f * std::sin(sample * 0.0005f * (1 << (3 * f)));
+        }
+
+        manager.process(kBankBlockSize);
+        for (int f = 0; f < vital::kNumFormants; ++f)
+            reference[f].process(kBankBlockSize);
+
+        const vital::poly_float* bank_out = manager.output()->buffer;
+        for (int i = 0; i < kBankBlockSize; ++i) {
+            vital::poly_float total = 0.0f;
+            for (int f = 0; f < vital::kNumFormants; ++f)
+                total += reference[f].output()->buffer[i];
+
+            for (int v = 0; v < vital::poly_float::kSize; ++v)
+                max_difference = std::max(max_difference, std::abs(bank_out[i][v] - total[v]));
+        }
+    }
+
+    expect(max_difference <= kMaxBankDifference, "Formant bank differs from separate formants by " +
+                                                 String(max_difference));
+}
 
 void FormantFilterTest::runTest() {
     // Create a FormantFilter processor instance.
@@ -12,6 +88,8 @@ void FormantFilterTest::runTest() {
 
     // Run standardized input bounds tests to ensure the formant filter handles extreme inputs gracefully.
     runInputBoundsTest(&formant_filter);
+
+    runBankTest();
 }
 
 // Registers the test instance so it will be automatically discovered and run.
@@ -12,7 +12,8 @@
  * @brief A test class that verifies the stability and correctness of the FormantFilter processor.
  *
  * This test ensures that the FormantFilter handles a wide range of input values without producing
- * non-finite outputs. It leverages the ProcessorTest framework to run standardized input bounds tests.
+ * non-finite outputs. It leverages the ProcessorTest framework to run standardized input bounds tests,
+ * and checks the FormantManager bank against the same formants run one at a time and summed.
  */
 class FormantFilterTest : public ProcessorTest {
 public:
@@ -26,4 +27,10 @@ public:
      *        filter remains stable and produces finite output under extreme input conditions.
      */
     void runTest() override;
+
+private:
+    /**
+     * @brief Checks that the FormantManager output matches its formants processed separately and summed.
+     */
+    void runBankTest();
 };
@@ -0,0 +1,87 @@
+/**
+ * @file synth_filter_test.cpp
+ * @brief Implements the SynthFilterTest class, checking interpolated filter coefficients against exact ones.
+ */
+
+#include "synth_filter_test.h"
+#include "synth_filter.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kCutoffBlockSize = 128;
+    constexpr int kCutoffSampleRate = vital::kDefaultSampleRate;
+    // Linear interpolation of the coefficient across a stride, relative to the coefficient.
+    constexpr float kMaxCoefficientError = 0.005f;
+
+    typedef vital::SynthFilter::CoefficientLookup CoefficientLookup;
+    typedef vital::SynthFilter::CutoffCoefficients<CoefficientLookup> CutoffCoefficients;
+} // namespace
+
+void SynthFilterTest::checkCoefficients(const String& name, const vital::poly_float* midi_cutoff_buffer,
+                                        int num_samples) {
+    beginTest(name);
+
+    const CoefficientLookup* lookup = vital::SynthFilter::getCoefficientLookup();
+    CutoffCoefficients coefficients(lookup, midi_cutoff_buffer, num_samples, kCutoffSampleRate);
+
+    vital::poly_float base_midi = midi_cutoff_buffer[num_samples - 1];
+    vital::poly_float base_frequency = vital::utils::midiNoteToFrequency(base_midi) * (1.0f / kCutoffSampleRate);
+
+    float max_error = 0.0f;
+    for (int i = 0; i < num_samples; ++i) {
+        vital::poly_float midi_delta = midi_cutoff_buffer[i] - base_midi;
+        vital::poly_float frequency = vital::utils::min(base_frequency * vital::futils::midiOffsetToRatio(midi_delta),
+                                                        1.0f);
+        vital::poly_float exact = lookup->cubicLookup(frequency);
+        vital::poly_float interpolated = coefficients.next();
+
+        for (int v = 0; v < vital::poly_float::kSize; ++v) {
+            expect(std::isfinite(interpolated[v]));
+            float error = std::abs(interpolated[v] - exact[v]) / std::max(std::abs(exact[v]), 0.0001f);
+            max_error = std::max(max_error, error);
+        }
+    }
+
+    expect(max_error <= kMaxCoefficientError, name + " coefficient error: " + String(max_error));
+}
+
+void SynthFilterTest::runTest() {
+    vital::poly_float midi[kCutoffBlockSize];
+
+    for (int i = 0; i < kCutoffBlockSize; ++i)
+        midi[i] = 60.0f;
+    checkCoefficients("Constant Cutoff", midi, kCutoffBlockSize);
+
+    for (int i = 0; i < kCutoffBlockSize; ++i)
+        midi[i] = 40.0f + i * (24.0f / kCutoffBlockSize);
+    checkCoefficients("Slow Ramp", midi, kCutoffBlockSize);
+
+    for (int i = 0; i < kCutoffBlockSize; ++i)
+        midi[i] = 130.0f - i;
+    checkCoefficients("Fast Ramp", midi, kCutoffBlockSize);
+
+    for (int i = 0; i < kCutoffBlockSize; ++i) {
+        float phase = i * (2.0f * vital::kPi / kCutoffBlockSize);
+        midi[i] = vital::poly_float(70.0f + 12.0f * std::sin(phase), 50.0f - 6.0f * std::cos(phase),
+                                    90.0f + 3.0f * std::sin(2.0f * phase), 20.0f);
+    }
+    checkCoefficients("Slow LFO", midi, kCutoffBlockSize);
+
+    for (int i = 0; i < kCutoffBlockSize; ++i) {
+        float phase = i * (2.0f * vital::kPi * 440.0f / kCutoffSampleRate);
+        midi[i] = 80.0f + 36.0f * std::sin(phase);
+    }
+    checkCoefficients("Audio Rate Modulation", midi, kCutoffBlockSize);
+
+    for (int i = 0; i < kCutoffBlockSize; ++i)
+        midi[i] = 120.0f + 20.0f * std::sin(i * 0.02f);
+    checkCoefficients("Above Nyquist", midi, kCutoffBlockSize);
+
+    for (int i = 0; i < 5; ++i)
+        midi[i] = 30.0f + i * 0.5f;
+    checkCoefficients("Short Block", midi, 5);
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static SynthFilterTest synth_filter_test;
@@ -0,0 +1,38 @@
+/**
+ * @file synth_filter_test.h
+ * @brief Declares the SynthFilterTest class, which tests the coefficient evaluation shared by the SynthFilter models.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class SynthFilterTest
+ * @brief A test class for verifying SynthFilter::CutoffCoefficients against coefficients evaluated every sample.
+ *
+ * The interpolated coefficients are compared against the exact lookup for a constant cutoff, slow and fast ramps,
+ * a slow LFO, audio rate cutoff modulation and a cutoff pushed against the top of the lookup range.
+ */
+class SynthFilterTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a new SynthFilterTest instance with a given test name.
+     */
+    SynthFilterTest() : UnitTest("Synth Filter") { }
+
+    /**
+     * @brief Runs the coefficient accuracy tests.
+     */
+    void runTest() override;
+
+private:
+    /**
+     * @brief Checks the interpolated coefficients of a block of cutoff values against exact ones.
+     *
+     * @param name Name of the cutoff curve being checked.
+     * @param midi_cutoff_buffer Per sample cutoff in MIDI notes.
+     * @param num_samples Number of samples in the block.
+     */
+    void checkCoefficients(const String& name, const vital::poly_float* midi_cutoff_buffer, int num_samples);
+};
@@ -0,0 +1,95 @@
+/**
+ * @file upsampler_test.cpp
+ * @brief Implements the UpsamplerTest class, checking the interpolating Upsampler and the Decimator round trip.
+ */
+
+#include "upsampler_test.h"
+#include "decimator.h"
+#include "upsampler.h"
+
+#include <cmath>
+
+namespace {
+    constexpr int kBlockSize = 128;
+    constexpr int kNumBlocks = 32;
+    constexpr double kSineFrequency = 0.1;
+    constexpr double kMinImageRejection = 60.0;
+    constexpr double kMaxLevelError = 0.01;
+
+    /**
+     * @brief Processor that only owns an output buffer, standing in for the oversampled audio source.
+     */
+    class OversampledSource : public vital::Processor {
+    public:
+        OversampledSource() : vital::Processor(0, 1) { }
+        vital::Processor* clone() const override { return nullptr; }
+        void process(int) override { }
+    };
+
+    /**
+     * @brief Returns the amplitude of one frequency in the left channel of a buffer.
+     *
+     * @param buffer The audio to analyze.
+     * @param start The first sample to analyze, everything after it is included.
+     * @param frequency The frequency in cycles per sample.
+     */
+    double getAmplitude(const std::vector<vital::poly_float>& buffer, int start, double frequency) {
+        double real = 0.0;
+        double imaginary = 0.0;
+        int num_samples = static_cast<int>(buffer.size()) - start;
+        for (int i = 0; i < num_samples; ++i) {
+            double phase = 2.0 * vital::kPi * frequency * i;
+            real += buffer[start + i][0] * std::cos(phase);
+            imaginary += buffer[start + i][0] * std::sin(phase);
+        }
+        return 2.0 * std::sqrt(real * real + imaginary * imaginary) / num_samples;
+    }
+}
+
+void UpsamplerTest::runTest() {
+    for (int num_stages = 1; num_stages <= vital::Upsampler::kMaxStages; ++num_stages) {
+        int oversample = 1 << num_stages;
+        beginTest(std::to_string(oversample) + "x Interpolation");
+
+        vital::Upsampler upsampler;
+        upsampler.setSampleRate(vital::kDefaultSampleRate);
+        upsampler.setOversampleAmount(oversample);
+        upsampler.setInterpolate(true);
+
+        OversampledSource source;
+        source.setSampleRate(vital::kDefaultSampleRate);
+        source.setOversampleAmount(oversample);
+
+        vital::Decimator decimator(vital::Decimator::kMaxStages);
+        decimator.setSampleRate(vital::kDefaultSampleRate);
+        decimator.plug(&source, vital::Decimator::kAudio);
+
+        std::vector<vital::poly_float> upsampled;
+        std::vector<vital::poly_float> round_trip;
+        vital::poly_float block[kBlockSize];
+        for (int b = 0; b < kNumBlocks; ++b) {
+            for (int i = 0; i < kBlockSize; ++i)
+                block[i] = std::sin(2.0 * vital::kPi * kSineFrequency * (b * kBlockSize + i));
+
+            upsampler.processWithInput(block, kBlockSize);
+            const vital::poly_float* upsampled_block = upsampler.output()->buffer;
+            upsampled.insert(upsampled.end(), upsampled_block, upsampled_block + kBlockSize * oversample);
+
+            vital::utils::copyBuffer(source.output()->buffer, upsampled_block, kBlockSize * oversample);
+            decimator.process(kBlockSize);
+            round_trip.insert(round_trip.end(), decimator.output()->buffer, decimator.output()->buffer + kBlockSize);
+        }
+
+        // Skip the first half so the filters have settled.
+        double signal = getAmplitude(upsampled, upsampled.size() / 2, kSineFrequency / oversample);
+        double image = getAmplitude(upsampled, upsampled.size() / 2, (1.0 - kSineFrequency) / oversample);
+        expect(std::abs(signal - 1.0) < kMaxLevelError, "Interpolation changed the passband level.");
+        expect(20.0 * std::log10(signal / image) > kMinImageRejection, "Interpolation left an image.");
+
+        double round_trip_signal = getAmplitude(round_trip, round_trip.size() / 2, kSineFrequency);
+        expect(std::abs(round_trip_signal - 1.0) < kMaxLevelError, "Decimating the upsampled signal changed its level.");
+    }
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static UpsamplerTest upsampler_test;
@@ -0,0 +1,29 @@
+/**
+ * @file upsampler_test.h
+ * @brief Declares the UpsamplerTest class, which tests the Upsampler processor.
+ */
+
+#pragma once
+
+#include "processor_test.h"
+
+/**
+ * @class UpsamplerTest
+ * @brief A test class for verifying the interpolating mode of the Upsampler processor.
+ *
+ * This test upsamples a sine wave by 2x, 4x and 8x and checks that the passband keeps its level while the
+ * image above the original Nyquist frequency is removed. It also runs the result back through a Decimator
+ * to check the two cascades round trip.
+ */
+class UpsamplerTest : public ProcessorTest {
+public:
+    /**
+     * @brief Constructs a new UpsamplerTest with a specified test name.
+     */
+    UpsamplerTest() : ProcessorTest("Upsampler") { }
+
+    /**
+     * @brief Runs the Upsampler test for each supported oversampling factor.
+     */
+    void runTest() override;
+};
@@ -0,0 +1,249 @@
+/**
+ * @file modulation_routing_test.cpp
+ * @brief Implements the ModulationRoutingTest class, counting heap operations while modulations are routed.
+ */
+
+#include "modulation_routing_test.h"
+#include "modulation_connection_processor.h"
+#include "operators.h"
+#include "synth_base.h"
+#include "value.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    /// Number of inputs reserved in the reserved input test.
+    constexpr int kNumReservedInputs = 4;
+    /// Number of times modulations are connected and disconnected in the synth test.
+    constexpr int kNumRoutingRounds = 2;
+    /// Number of blocks processed while modulations are connected.
+    constexpr int kNumRoutingBlocks = 4;
+    /// Number of output channels processed in the synth test.
+    constexpr int kNumRoutingChannels = 2;
+    /// Destinations the synth test connects every modulation source to.
+    const std::string kRoutingDestinations[] = { "filter_1_cutoff", "osc_1_level" };
+
+    /// Heap operations on this thread are counted here while a ScopedHeapCounter is active.
+    thread_local int* heap_operation_count = nullptr;
+
+    /**
+     * @class ScopedHeapCounter
+     * @brief Counts heap allocations and frees on this thread for as long as it exists.
+     */
+    class ScopedHeapCounter {
+    public:
+        ScopedHeapCounter() : count_(0), previous_(heap_operation_count) {
+            heap_operation_count = &count_;
+        }
+
+        ~ScopedHeapCounter() {
+            heap_operation_count = previous_;
+        }
+
+        int count() const { return count_; }
+
+    private:
+        int count_;
+        int* previous_;
+    };
+
+    void* countedAllocate(size_t size) noexcept {
+        if (heap_operation_count)
+            (*heap_operation_count)++;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* countedAllocateOrThrow(size_t size) {
+        void* memory = countedAllocate(size);
+        if (memory == nullptr)
+            throw std::bad_alloc();
+        return memory;
+    }
+
+    void countedFree(void* pointer) noexcept {
+        if (heap_operation_count && pointer)
+            (*heap_operation_count)++;
+        std::free(pointer);
+    }
+
+    /**
+     * @class RoutingSynth
+     * @brief A SynthBase without a host or interface that applies queued modulation changes the way the audio
+     *        callback does.
+     */
+    class RoutingSynth : public SynthBase {
+    public:
+        const CriticalSection& getCriticalSection() override { return critical_section_; }
+        void pauseProcessing(bool pause) override { }
+        SynthGuiInterface* getGuiInterface() override { return nullptr; }
+
+        using SynthBase::processModulationChanges;
+        using SynthBase::processAudio;
+
+        int numEnabledModulations() {
+            int enabled = 0;
+            for (int i = 0; i < vital::kMaxModulationConnections; ++i) {
+                if (getModulationBank().atIndex(i)->modulation_processor->enabled())
+                    enabled++;
+            }
+            return enabled;
+        }
+
+    private:
+        CriticalSection critical_section_;
+    };
+} // namespace
+
+void* operator new(size_t size) {
+    return countedAllocateOrThrow(size);
+}
+
+void* operator new[](size_t size) {
+    return countedAllocateOrThrow(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+
+void ModulationRoutingTest::runTest() {
+    testHeapCounter();
+    testReservedInputs();
+    testSynthModulationChanges();
+}
+
+void ModulationRoutingTest::testHeapCounter() {
+    beginTest("Heap Counter");
+
+    int heap_operations = 0;
+    {
+        ScopedHeapCounter counter;
+        int* single = new int(1);
+        delete single;
+        int* array = new int[4];
+        delete[] array;
+        int* single_nothrow = new (std::nothrow) int(1);
+        delete single_nothrow;
+        int* array_nothrow = new (std::nothrow) int[4];
+        delete[] array_nothrow;
+        heap_operations = counter.count();
+    }
+    expectEquals(heap_operations, 8, "Heap counter missed an allocation or free.");
+}
+
+void ModulationRoutingTest::testReservedInputs() {
+    beginTest("Reserved Inputs");
+    vital::VariableAdd sum;
+    vital::Value value(1.0f);
+    sum.reserveInputs(kNumReservedInputs);
+
+    // Failed expectations allocate their messages, so counts are checked after the counters are gone.
+    int reserved_heap_operations = 0;
+    {
+        ScopedHeapCounter counter;
+        for (int i = 0; i < kNumReservedInputs; ++i)
+            sum.plugNext(&value);
+        reserved_heap_operations = counter.count();
+    }
+    expectEquals(reserved_heap_operations, 0, "Plugging into reserved inputs touched the heap.");
+    expectEquals(sum.numInputs(), kNumReservedInputs);
+    expectEquals(sum.connectedInputs(), kNumReservedInputs);
+
+    int extra_heap_operations = 0;
+    {
+        ScopedHeapCounter counter;
+        sum.plugNext(&value);
+        extra_heap_operations = counter.count();
+    }
+    expect(extra_heap_operations > 0, "Plugging past the reserved inputs should allocate.");
+    expectEquals(sum.numInputs(), kNumReservedInputs + 1);
+
+    sum.process(1);
+    expectEquals(sum.output()->buffer[0][0], kNumReservedInputs + 1.0f);
+}
+
+void ModulationRoutingTest::testSynthModulationChanges() {
+    beginTest("Synth Modulation Changes");
+    RoutingSynth synth;
+    AudioSampleBuffer buffer(kNumRoutingChannels, vital::kMaxBufferSize);
+    synth.getEngine()->noteOn(60, 1.0f, 0, 0);
+    synth.processAudio(&buffer, kNumRoutingChannels, vital::kMaxBufferSize, 0);
+
+    std::vector<std::pair<std::string, std::string>> connections;
+    for (const std::string& destination : kRoutingDestinations) {
+        for (auto& source : synth.getEngine()->getModulationSources()) {
+            if (connections.size() < vital::kMaxModulationConnections)
+                connections.push_back({ source.first, destination });
+        }
+    }
+
+    for (int round = 0; round < kNumRoutingRounds; ++round) {
+        // Changes are queued on the message thread and applied at the start of the next audio callback.
+        for (auto& connection : connections)
+            synth.connectModulation(connection.first, connection.second);
+
+        int connect_heap_operations = 0;
+        int process_heap_operations = 0;
+        int disconnect_heap_operations = 0;
+        {
+            ScopedHeapCounter counter;
+            synth.processModulationChanges();
+            connect_heap_operations = counter.count();
+        }
+        expectEquals(synth.numEnabledModulations(), static_cast<int>(connections.size()));
+        {
+            ScopedHeapCounter counter;
+            for (int i = 0; i < kNumRoutingBlocks; ++i)
+                synth.processAudio(&buffer, kNumRoutingChannels, vital::kMaxBufferSize, 0);
+            process_heap_operations = counter.count();
+        }
+
+        for (auto& connection : connections)
+            synth.disconnectModulation(connection.first, connection.second);
+        {
+            ScopedHeapCounter counter;
+            synth.processModulationChanges();
+            disconnect_heap_operations = counter.count();
+        }
+        expectEquals(synth.numEnabledModulations(), 0);
+
+        expectEquals(connect_heap_operations, 0, "Connecting modulations touched the heap.");
+        expectEquals(process_heap_operations, 0, "Processing modulations touched the heap.");
+        expectEquals(disconnect_heap_operations, 0, "Disconnecting modulations touched the heap.");
+    }
+
+    expect(vital::utils::isFinite(synth.getEngine()->output()->buffer, vital::kMaxBufferSize),
+           "Synth output isn't finite.");
+}
+
+// Registers the test instance so it will be discovered and run automatically.
+static ModulationRoutingTest modulation_routing_test;
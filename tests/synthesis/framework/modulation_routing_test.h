@@ -0,0 +1,45 @@
+/**
+ * @file modulation_routing_test.h
+ * @brief Declares the ModulationRoutingTest class for checking that modulation routing doesn't allocate.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class ModulationRoutingTest
+ * @brief A test class verifying that modulation connections can be made and removed on the audio thread without
+ *        touching the heap.
+ *
+ * Heap operations are counted with replacements for every global operator new and delete form that only count
+ * while a counter is active on the calling thread.
+ */
+class ModulationRoutingTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a ModulationRoutingTest with a specified name and category.
+     */
+    ModulationRoutingTest() : UnitTest("Modulation Routing", "Framework") { }
+
+    /**
+     * @brief Runs all modulation routing tests.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Tests that the heap counter sees single, array and nothrow allocations and frees.
+     */
+    void testHeapCounter();
+
+    /**
+     * @brief Tests that plugNext uses reserved inputs before allocating new ones.
+     */
+    void testReservedInputs();
+
+    /**
+     * @brief Tests that applying queued modulation connections and disconnections with
+     *        SynthBase::processModulationChanges, and processing audio in between, doesn't allocate.
+     */
+    void testSynthModulationChanges();
+};
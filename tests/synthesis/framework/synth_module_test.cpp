@@ -0,0 +1,231 @@
+/**
+ * @file synth_module_test.cpp
+ * @brief Implements the SynthModuleTest class, comparing scaled poly mod controls against scaling after the switch.
+ */
+
+#include "synth_module_test.h"
+#include "operators.h"
+#include "synth_module.h"
+#include "synth_parameters.h"
+#include "value.h"
+#include "value_switch.h"
+
+namespace {
+    /// Parameters covering every value scale a control rate poly mod control can have.
+    const std::string kScaledParameters[] = {
+        "osc_1_level",     // Quadratic
+        "env_1_attack",    // Quartic
+        "lfo_1_frequency", // Exponential
+        "volume",          // Square root with a post offset
+        "osc_1_pan"        // Linear
+    };
+    /// Number of parameters in kScaledParameters.
+    constexpr int kNumScaledParameters = sizeof(kScaledParameters) / sizeof(kScaledParameters[0]);
+    /// Number of base values swept across each parameter's range.
+    constexpr int kNumBaseValues = 16;
+    /// Poly modulation amounts, as a fraction of the parameter's range, with different values in each lane.
+    const vital::poly_float kModulationAmounts[] = {
+        vital::poly_float(0.1f, -0.1f, 0.25f, -0.25f),
+        vital::poly_float(-0.5f, 0.5f, 0.0f, 0.75f),
+        vital::poly_float(1.0f, -1.0f, 0.05f, -0.05f)
+    };
+
+    /**
+     * @class ScaledControlModule
+     * @brief Builds poly mod controls either with createPolyModControl or with the scale-after-switch chain.
+     */
+    class ScaledControlModule : public vital::SynthModule {
+    public:
+        explicit ScaledControlModule(bool scale_after_switch) :
+                SynthModule(0, 0), scale_after_switch_(scale_after_switch) { }
+
+        void init() override {
+            for (const std::string& name : kScaledParameters) {
+                if (scale_after_switch_)
+                    controls_.push_back(createScaleAfterSwitchControl(name));
+                else
+                    controls_.push_back(createPolyModControl(name));
+            }
+
+            SynthModule::init();
+        }
+
+        vital::Processor* clone() const override { VITAL_ASSERT(false); return nullptr; }
+
+        vital::poly_float controlValue(int index) const { return controls_[index]->buffer[0]; }
+
+        void setValue(const std::string& name, vital::mono_float value) {
+            getControls()[name]->set(value);
+        }
+
+        void setModulation(const std::string& name, vital::poly_float amount) {
+            modulations_[name]->set(amount);
+            getPolyModulationSwitch(name)->set(1);
+        }
+
+        void clearModulation(const std::string& name) {
+            modulations_[name]->set(0.0f);
+            getPolyModulationSwitch(name)->set(0);
+        }
+
+        void plugModulations() {
+            for (const std::string& name : kScaledParameters) {
+                vital::cr::Value* modulation = new vital::cr::Value(0.0f);
+                addIdleProcessor(modulation);
+                getPolyModulationDestination(name)->plugNext(modulation);
+                modulations_[name] = modulation;
+            }
+        }
+
+    private:
+        /**
+         * @brief Builds a poly mod control that scales the switched output once per voice.
+         *
+         * This is the chain createPolyModControl built before it scaled the mono base value separately.
+         */
+        vital::Output* createScaleAfterSwitchControl(const std::string& name) {
+            vital::ValueDetails details = vital::Parameters::getDetails(name);
+            vital::Output* base_control = createBaseModControl(name);
+
+            vital::Processor* poly_total = new vital::cr::VariableAdd();
+            poly_total->reserveInputs(vital::kMaxModulationConnections);
+            addProcessor(poly_total);
+            data_->poly_mod_destinations[name] = poly_total;
+
+            vital::Processor* modulation_total = new vital::cr::Add();
+            modulation_total->plug(base_control, 0);
+            modulation_total->plug(poly_total, 1);
+            addProcessor(modulation_total);
+
+            vital::ValueSwitch* control_switch = new vital::ValueSwitch(0.0f);
+            control_switch->plugNext(base_control);
+            control_switch->plugNext(modulation_total);
+            control_switch->addProcessor(poly_total);
+            control_switch->addProcessor(modulation_total);
+            control_switch->set(0);
+            addIdleProcessor(control_switch);
+            data_->poly_modulation_switches[name] = control_switch;
+
+            vital::Processor* scale = nullptr;
+            if (details.value_scale == vital::ValueDetails::kQuadratic) {
+                if (details.post_offset)
+                    scale = new vital::cr::Quadratic(details.post_offset);
+                else
+                    scale = new vital::cr::Square();
+            }
+            else if (details.value_scale == vital::ValueDetails::kCubic)
+                scale = new vital::cr::Cube();
+            else if (details.value_scale == vital::ValueDetails::kQuartic)
+                scale = new vital::cr::Quart();
+            else if (details.value_scale == vital::ValueDetails::kExponential)
+                scale = new vital::cr::ExponentialScale(details.min, details.max, 2.0f, details.post_offset);
+            else if (details.value_scale == vital::ValueDetails::kSquareRoot)
+                scale = new vital::cr::Root(details.post_offset);
+
+            vital::Output* control = control_switch->output(vital::ValueSwitch::kSwitch);
+            if (scale == nullptr)
+                return control;
+
+            scale->plug(control);
+            addProcessor(scale);
+            return scale->output();
+        }
+
+        bool scale_after_switch_;
+        std::vector<vital::Output*> controls_;
+        std::map<std::string, vital::cr::Value*> modulations_;
+    };
+
+    /**
+     * @brief Processes a block in both modules.
+     */
+    void processBoth(ScaledControlModule& module, ScaledControlModule& reference) {
+        module.process(vital::kMaxBufferSize);
+        reference.process(vital::kMaxBufferSize);
+    }
+
+    vital::mono_float sweepValue(const std::string& name, int index) {
+        vital::ValueDetails details = vital::Parameters::getDetails(name);
+        vital::mono_float t = index / (kNumBaseValues - 1.0f);
+        return details.min + t * (details.max - details.min);
+    }
+
+    bool controlsMatch(const ScaledControlModule& module, const ScaledControlModule& reference, int index) {
+        vital::poly_float value = module.controlValue(index);
+        vital::poly_float expected = reference.controlValue(index);
+        for (int i = 0; i < vital::poly_float::kSize; ++i) {
+            if (value[i] != expected[i])
+                return false;
+        }
+        return true;
+    }
+} // namespace
+
+void SynthModuleTest::runTest() {
+    testUnmodulatedScaling();
+    testModulatedScaling();
+}
+
+void SynthModuleTest::testUnmodulatedScaling() {
+    beginTest("Unmodulated Poly Mod Scaling");
+    ScaledControlModule module(false);
+    ScaledControlModule reference(true);
+    module.init();
+    reference.init();
+
+    for (int p = 0; p < kNumScaledParameters; ++p) {
+        const std::string& name = kScaledParameters[p];
+        int mismatches = 0;
+        for (int i = 0; i < kNumBaseValues; ++i) {
+            vital::mono_float value = sweepValue(name, i);
+            module.setValue(name, value);
+            reference.setValue(name, value);
+            processBoth(module, reference);
+
+            if (!controlsMatch(module, reference, p))
+                mismatches++;
+        }
+        expectEquals(mismatches, 0, "Unmodulated " + name + " scaled differently.");
+    }
+}
+
+void SynthModuleTest::testModulatedScaling() {
+    beginTest("Modulated Poly Mod Scaling");
+    ScaledControlModule module(false);
+    ScaledControlModule reference(true);
+    module.init();
+    reference.init();
+    module.plugModulations();
+    reference.plugModulations();
+
+    for (int p = 0; p < kNumScaledParameters; ++p) {
+        const std::string& name = kScaledParameters[p];
+        vital::ValueDetails details = vital::Parameters::getDetails(name);
+        vital::mono_float range = details.max - details.min;
+
+        int mismatches = 0;
+        for (int i = 0; i < kNumBaseValues; ++i) {
+            vital::mono_float value = sweepValue(name, i);
+            module.setValue(name, value);
+            reference.setValue(name, value);
+
+            for (vital::poly_float amount : kModulationAmounts) {
+                module.setModulation(name, amount * range);
+                reference.setModulation(name, amount * range);
+                processBoth(module, reference);
+                if (!controlsMatch(module, reference, p))
+                    mismatches++;
+            }
+
+            module.clearModulation(name);
+            reference.clearModulation(name);
+            processBoth(module, reference);
+            if (!controlsMatch(module, reference, p))
+                mismatches++;
+        }
+        expectEquals(mismatches, 0, "Poly modulated " + name + " scaled differently.");
+    }
+}
+
+// Registers the test instance so it will be discovered and run automatically.
+static SynthModuleTest synth_module_test;
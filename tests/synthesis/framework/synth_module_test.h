@@ -0,0 +1,40 @@
+/**
+ * @file synth_module_test.h
+ * @brief Declares the SynthModuleTest class for checking the controls a SynthModule creates.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class SynthModuleTest
+ * @brief A test class verifying that scaled poly mod controls output the same values as scaling the switched
+ *        control after the ValueSwitch.
+ *
+ * createPolyModControl scales the unmodulated value once in the mono router and the modulated sum per voice.
+ * These tests build the scale-after-switch chain next to it and compare both outputs for every value scale.
+ */
+class SynthModuleTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a SynthModuleTest with a specified name and category.
+     */
+    SynthModuleTest() : UnitTest("Synth Module", "Framework") { }
+
+    /**
+     * @brief Runs all synth module tests.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Tests that scaled poly mod controls match the scale-after-switch chain without modulation.
+     */
+    void testUnmodulatedScaling();
+
+    /**
+     * @brief Tests that scaled poly mod controls match the scale-after-switch chain with poly modulation,
+     *        including toggling the modulation off again.
+     */
+    void testModulatedScaling();
+};
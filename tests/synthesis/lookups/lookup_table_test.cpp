@@ -0,0 +1,166 @@
+/**
+ * @file lookup_table_test.cpp
+ * @brief Implements the LookupTableTest class, comparing OneDimLookup tables to their functions.
+ */
+
+#include "lookup_table_test.h"
+#include "digital_svf.h"
+#include "lookup_table.h"
+#include "synth_filter.h"
+
+namespace {
+    constexpr float kQuadraticScale = 4.0f;
+    constexpr int kQuadraticResolution = 256;
+    constexpr int kFilterResolution = 2048;
+    // The SVF coefficient steepens towards Nyquist and is clamped just below it, which the cubic can't follow.
+    constexpr float kMaxSvfRatio = 0.48f;
+
+    vital::mono_float quadratic(vital::mono_float value) {
+        return value * value - 3.0f * value + 1.0f;
+    }
+
+    /**
+     * @brief The input a table's samples are spaced for.
+     *
+     * Tables sample their range at resolution - 1 steps but index it at resolution steps, so a lookup of value
+     * interpolates the function at value * resolution / (resolution - 1).
+     */
+    vital::mono_float sampledInput(vital::mono_float value, int resolution) {
+        return value * resolution / (resolution - 1.0f);
+    }
+
+    /**
+     * @class SampledValueLookup
+     * @brief The sampled value table OneDimLookup used before, interpolating four gathered values per lane.
+     */
+    template<vital::mono_float(*function)(vital::mono_float), int resolution>
+    class SampledValueLookup {
+    public:
+        SampledValueLookup(float scale = 1.0f) {
+            scale_ = resolution / scale;
+            for (int i = 0; i < resolution + 4; ++i) {
+                vital::mono_float t = (i - 1.0f) / (resolution - 1.0f);
+                lookup_[i] = function(t * scale);
+            }
+        }
+
+        vital::poly_float cubicLookup(vital::poly_float value) const {
+            vital::poly_float boost = value * scale_;
+            vital::poly_int indices = vital::utils::clamp(vital::utils::toInt(boost), 0, resolution);
+            vital::poly_float t = boost - vital::utils::toFloat(indices);
+
+            vital::matrix interpolation_matrix = vital::utils::getCatmullInterpolationMatrix(t);
+            vital::matrix value_matrix = vital::utils::getValueMatrix(lookup_, indices);
+            value_matrix.transpose();
+            return interpolation_matrix.multiplyAndSumRows(value_matrix);
+        }
+
+    private:
+        vital::mono_float lookup_[resolution + 4];
+        vital::mono_float scale_;
+    };
+
+    /**
+     * @brief Returns the largest error of a lookup from an expected function relative to the expected value.
+     */
+    template<class Lookup, class Expected>
+    float maxRelativeError(const Lookup* lookup, Expected expected_function, float max_input) {
+        static constexpr int kNumPoints = 20000;
+
+        float max_error = 0.0f;
+        for (int i = 0; i < kNumPoints; i += vital::poly_float::kSize) {
+            vital::poly_float input;
+            for (int v = 0; v < vital::poly_float::kSize; ++v)
+                input.set(v, max_input * (i + v) / kNumPoints);
+
+            vital::poly_float result = lookup->cubicLookup(input);
+            vital::poly_float expected = expected_function(input);
+            for (int v = 0; v < vital::poly_float::kSize; ++v) {
+                float error = std::abs(result[v] - expected[v]) / std::max(1.0f, std::abs(expected[v]));
+                max_error = std::max(max_error, error);
+            }
+        }
+        return max_error;
+    }
+
+    /**
+     * @brief Returns the largest error of a lookup from its function at the input the table is sampled for.
+     */
+    template<class Lookup>
+    float maxFunctionError(const Lookup* lookup, vital::mono_float(*function)(vital::mono_float),
+                           int resolution, float max_input) {
+        return maxRelativeError(lookup, [=](vital::poly_float input) {
+            vital::poly_float expected;
+            for (int v = 0; v < vital::poly_float::kSize; ++v)
+                expected.set(v, function(sampledInput(input[v], resolution)));
+            return expected;
+        }, max_input);
+    }
+} // namespace
+
+void LookupTableTest::runTest() {
+    testQuadratic();
+    testSampledValueInterpolation();
+    testFilterCoefficients();
+}
+
+void LookupTableTest::testQuadratic() {
+    static constexpr float kMaxError = 0.0001f;
+
+    beginTest("Test Quadratic Lookup");
+
+    typedef vital::OneDimLookup<quadratic, kQuadraticResolution> QuadraticLookup;
+    std::unique_ptr<QuadraticLookup> lookup = std::make_unique<QuadraticLookup>(kQuadraticScale);
+
+    float error = maxFunctionError(lookup.get(), quadratic, kQuadraticResolution, kQuadraticScale);
+    expect(error < kMaxError, "Quadratic lookup doesn't match the quadratic.");
+
+    // Segment boundaries and half segments, where the index rounds, different in every lane.
+    vital::mono_float step = kQuadraticScale / kQuadraticResolution;
+    vital::poly_float inputs(0.0f, 0.5f * step, kQuadraticScale * 0.5f + 0.5f * step, kQuadraticScale);
+    vital::poly_float result = lookup->cubicLookup(inputs);
+    for (int i = 0; i < vital::poly_float::kSize; ++i) {
+        float expected = quadratic(sampledInput(inputs[i], kQuadraticResolution));
+        expect(std::abs(result[i] - expected) < kMaxError, "Segment boundary doesn't match.");
+    }
+}
+
+void LookupTableTest::testSampledValueInterpolation() {
+    static constexpr float kMaxError = 0.00001f;
+
+    beginTest("Test Sampled Value Interpolation");
+
+    typedef SampledValueLookup<vital::SynthFilter::computeOnePoleFilterCoefficient, kFilterResolution> OnePole;
+    typedef SampledValueLookup<vital::DigitalSvf::computeSvfOnePoleFilterCoefficient, kFilterResolution> Svf;
+    std::unique_ptr<OnePole> one_pole = std::make_unique<OnePole>();
+    std::unique_ptr<Svf> svf = std::make_unique<Svf>();
+
+    float one_pole_error = maxRelativeError(vital::SynthFilter::getCoefficientLookup(), [&](vital::poly_float input) {
+        return one_pole->cubicLookup(input);
+    }, 1.0f);
+    expect(one_pole_error < kMaxError, "One pole lookup differs from sampled values: " + String(one_pole_error));
+
+    float svf_error = maxRelativeError(vital::DigitalSvf::getSvfCoefficientLookup(), [&](vital::poly_float input) {
+        return svf->cubicLookup(input);
+    }, kMaxSvfRatio);
+    expect(svf_error < kMaxError, "SVF lookup differs from sampled values: " + String(svf_error));
+}
+
+void LookupTableTest::testFilterCoefficients() {
+    static constexpr float kMaxError = 0.00005f;
+
+    beginTest("Test Filter Coefficient Lookups");
+
+    float one_pole_error = maxFunctionError(vital::SynthFilter::getCoefficientLookup(),
+                                            vital::SynthFilter::computeOnePoleFilterCoefficient,
+                                            kFilterResolution, 1.0f);
+    expect(one_pole_error < kMaxError, "One pole coefficient lookup error: " + String(one_pole_error));
+
+    float svf_error = maxFunctionError(vital::DigitalSvf::getSvfCoefficientLookup(),
+                                       vital::DigitalSvf::computeSvfOnePoleFilterCoefficient,
+                                       kFilterResolution, kMaxSvfRatio);
+    expect(svf_error < kMaxError, "SVF coefficient lookup error: " + String(svf_error));
+}
+
+// Register the test so it will be automatically discovered and run.
+static LookupTableTest lookup_table_test;
@@ -0,0 +1,42 @@
+/**
+ * @file lookup_table_test.h
+ * @brief Declares the LookupTableTest class, which tests the OneDimLookup class accuracy.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class LookupTableTest
+ * @brief A test class to verify that OneDimLookup tables match the functions they are built from.
+ */
+class LookupTableTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a new LookupTableTest with a specified test name and category.
+     */
+    LookupTableTest() : UnitTest("Lookup Table", "Lookups") { }
+
+    /**
+     * @brief Runs all tests on the OneDimLookup class.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Tests that a quadratic, which cubic interpolation reproduces exactly, is looked up exactly in every
+     * lane, including on segment boundaries and with a scaled input range.
+     */
+    void testQuadratic();
+
+    /**
+     * @brief Tests the filter coefficient lookups against interpolating their sampled values directly.
+     */
+    void testSampledValueInterpolation();
+
+    /**
+     * @brief Tests the filter coefficient lookups against the analytic coefficient functions at the inputs
+     * their tables are sampled for.
+     */
+    void testFilterCoefficients();
+};
@@ -8,6 +8,7 @@
 
 void WaveFrameTest::runTest() {
     testRandomTimeFrequencyConversion();
+    testLazyDomainConversion();
 }
 
 void WaveFrameTest::testRandomTimeFrequencyConversion() {
@@ -35,5 +36,60 @@ void WaveFrameTest::testRandomTimeFrequencyConversion() {
     }
 }
 
+void WaveFrameTest::testLazyDomainConversion() {
+    static constexpr float kMaxError = 0.0001f;
+
+    beginTest("Test Lazy Wave Frame Domain Conversion");
+
+    vital::WaveFrame eager;
+    vital::WaveFrame lazy;
+    for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
+        float value = 0.5f * ((2.0f * rand()) / RAND_MAX - 1.0f);
+        eager.time_domain[i] = value;
+        lazy.time_domain[i] = value;
+    }
+
+    eager.toFrequencyDomain();
+    lazy.markTimeDomainChanged();
+    expect(lazy.isTimeDomainCurrent() && !lazy.isFrequencyDomainCurrent(), "Marking the time domain didn't stick.");
+
+    // Edit the spectrum of both, only converting the eager one back right away.
+    for (int i = 0; i < vital::WaveFrame::kNumRealComplex; i += 2) {
+        eager.frequency_domain[i] *= 0.5f;
+        lazy.ensureFrequencyDomain();
+        lazy.frequency_domain[i] *= 0.5f;
+    }
+    eager.toTimeDomain();
+    lazy.markFrequencyDomainChanged();
+    expect(!lazy.isTimeDomainCurrent(), "Frequency edit left time domain marked current.");
+
+    // Normalizing needs the time domain and should keep the spectrum consistent without another transform.
+    eager.normalize(true);
+    eager.toFrequencyDomain();
+    lazy.normalize(true);
+    expect(lazy.isTimeDomainCurrent() && lazy.isFrequencyDomainCurrent(), "Normalize lost a current domain.");
+
+    // Copies carry over which domains are current.
+    vital::WaveFrame copied;
+    copied.copy(&lazy);
+    copied.markTimeDomainChanged();
+    vital::WaveFrame combined;
+    combined.addFrom(&copied);
+    combined.addFrom(&eager);
+    combined.multiply(0.5f);
+
+    for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i) {
+        expect(std::abs(lazy.time_domain[i] - eager.time_domain[i]) < kMaxError, "Lazy time domain doesn't match.");
+        expect(std::abs(combined.time_domain[i] - eager.time_domain[i]) < kMaxError, "Combined time domain is off.");
+    }
+    for (int i = 0; i < vital::WaveFrame::kNumRealComplex; ++i) {
+        float scale = std::max(1.0f, std::abs(eager.frequency_domain[i]));
+        expect(std::abs(lazy.frequency_domain[i] - eager.frequency_domain[i]) < kMaxError * scale,
+               "Lazy frequency domain doesn't match.");
+        expect(std::abs(combined.frequency_domain[i] - eager.frequency_domain[i]) < kMaxError * scale,
+               "Combined frequency domain is off.");
+    }
+}
+
 // Register the test so it will be automatically discovered and run.
 static WaveFrameTest wave_frame_test;
@@ -31,4 +31,10 @@ public:
      * inverse-transformed result, ensuring minimal error.
      */
     void testRandomTimeFrequencyConversion();
+
+    /**
+     * @brief Tests that edits marked on one domain are converted lazily and match converting right away,
+     * including through normalize, copy and addFrom.
+     */
+    void testLazyDomainConversion();
 };
@@ -0,0 +1,93 @@
+/**
+ * @file line_generator_test.cpp
+ * @brief Implements the LineGeneratorTest class, comparing partial renders and reader buffers to full renders.
+ */
+
+#include "line_generator_test.h"
+#include "line_generator.h"
+
+namespace {
+    /// Number of points on the edited line.
+    constexpr int kNumLinePoints = 8;
+    /// Number of random edits checked.
+    constexpr int kNumLineEdits = 500;
+}
+
+void LineGeneratorTest::editRandomPoint(LineGenerator& line, Random& random) {
+    int index = random.nextInt(Range<int>(1, line.getNumPoints() - 1));
+    float from = line.getPoint(index - 1).first;
+    float to = line.getPoint(index + 1).first;
+    line.setPoint(index, { from + random.nextFloat() * (to - from), random.nextFloat() });
+    if (random.nextBool())
+        line.setPower(index, 20.0f * random.nextFloat() - 10.0f);
+}
+
+bool LineGeneratorTest::matchesFullRender(LineGenerator& line, const float* buffer) {
+    LineGenerator full_render(line.resolution());
+    full_render.jsonToState(line.stateToJson());
+    const float* expected = full_render.getBuffer() - 1;
+    int size = line.resolution() + LineGenerator::kExtraValues;
+    return memcmp(buffer, expected, size * sizeof(float)) == 0;
+}
+
+void LineGeneratorTest::runPartialRenderTest() {
+    beginTest("Partial Renders Match Full Render");
+
+    Random random = getRandom();
+    LineGenerator line;
+    for (int i = 1; i < kNumLinePoints - 1; ++i)
+        line.addMiddlePoint(i);
+    line.render();
+
+    int render_mismatches = 0;
+    int reader_mismatches = 0;
+    for (int i = 0; i < kNumLineEdits; ++i) {
+        int num_edits = random.nextInt(Range<int>(1, 4));
+        for (int e = 0; e < num_edits; ++e)
+            editRandomPoint(line, random);
+        line.render();
+
+        if (!matchesFullRender(line, line.getBuffer() - 1))
+            render_mismatches++;
+
+        // Readers pick up some renders and skip others, which changes which buffer is written next.
+        if (random.nextBool() && !matchesFullRender(line, line.getCubicInterpolationBuffer()))
+            reader_mismatches++;
+    }
+
+    expectEquals(line.getNumPoints(), kNumLinePoints);
+    expectEquals(render_mismatches, 0, "Partial render differs from a full render.");
+    expectEquals(reader_mismatches, 0, "Reader picked up a buffer that differs from a full render.");
+}
+
+void LineGeneratorTest::runReaderBufferTest() {
+    beginTest("Reader Buffer Stays Put");
+
+    Random random = getRandom();
+    LineGenerator line;
+    line.addMiddlePoint(1);
+    line.addMiddlePoint(1);
+    line.render();
+
+    int size = line.resolution() + LineGenerator::kExtraValues;
+    const float* held = line.getCubicInterpolationBuffer();
+    std::unique_ptr<float[]> copy = std::make_unique<float[]>(size);
+    memcpy(copy.get(), held, size * sizeof(float));
+
+    for (int i = 0; i < 10; ++i) {
+        editRandomPoint(line, random);
+        line.render();
+    }
+
+    expect(memcmp(held, copy.get(), size * sizeof(float)) == 0, "Render wrote into the buffer a reader holds.");
+    expect(line.getCubicInterpolationBuffer() != held);
+    expect(matchesFullRender(line, line.getCubicInterpolationBuffer()));
+}
+
+void LineGeneratorTest::runTest() {
+    runPartialRenderTest();
+    runReaderBufferTest();
+}
+
+// Registers the test instance so it will be automatically discovered and run.
+static LineGeneratorTest line_generator_test;
@@ -0,0 +1,56 @@
+/**
+ * @file line_generator_test.h
+ * @brief Declares the LineGeneratorTest class, which tests LineGenerator rendering and buffer hand over.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+class LineGenerator;
+
+/**
+ * @class LineGeneratorTest
+ * @brief A test class that verifies partial LineGenerator renders and the buffers the audio thread reads.
+ *
+ * Randomly edits points and powers and checks every render, and every buffer picked up by a reader, is bit exact
+ * with a full render of the same line. Also checks the buffer a reader holds isn't written to until it picks up
+ * a newer one.
+ */
+class LineGeneratorTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a new LineGeneratorTest with the specified test name and category.
+     */
+    LineGeneratorTest() : UnitTest("Line Generator", "Modulators") { }
+
+    /**
+     * @brief Runs all LineGenerator tests.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Checks partial renders after random setPoint() and setPower() edits against full renders.
+     */
+    void runPartialRenderTest();
+
+    /**
+     * @brief Checks the buffer held by a reader is left alone by later renders.
+     */
+    void runReaderBufferTest();
+
+private:
+    /**
+     * @brief Moves a random inner point between its neighbors and sometimes changes its power.
+     * @param line The line to edit.
+     * @param random The random generator to draw the edit from.
+     */
+    void editRandomPoint(LineGenerator& line, Random& random);
+
+    /**
+     * @brief Returns true if the buffer matches a full render of the line, extra values included.
+     * @param line The line the buffer was rendered from.
+     * @param buffer The buffer from the leading extra value on.
+     */
+    bool matchesFullRender(LineGenerator& line, const float* buffer);
+};
@@ -0,0 +1,240 @@
+/**
+ * @file parameter_change_scheduler_test.cpp
+ * @brief Implements the ParameterChangeSchedulerTest class, walking blocks split by scheduled host automation.
+ */
+
+#include "parameter_change_scheduler_test.h"
+#include "common.h"
+#include "parameter_change_scheduler.h"
+
+namespace {
+    /// Length of the blocks walked by most tests.
+    constexpr int kSchedulerBlockSize = 512;
+    /// Index of the bypass parameter in the bypass test.
+    constexpr int kBypassIndex = 7;
+
+    /// A change and the sample it was applied at.
+    struct AppliedChange {
+        int parameter_index;
+        float value;
+        int applied_at;
+    };
+
+    /// The chunks one block was processed in and the changes applied along the way.
+    struct BlockRun {
+        std::vector<int> chunks;
+        std::vector<AppliedChange> applied;
+    };
+
+    void applyChanges(ParameterChangeScheduler& scheduler, int sample_offset, int applied_at, BlockRun& run) {
+        ParameterChangeScheduler::Change change;
+        while (scheduler.getNextChange(sample_offset, change))
+            run.applied.push_back({ change.parameter_index, change.value, applied_at });
+    }
+
+    /**
+     * @brief Walks a block the way SynthPlugin::processBlock does.
+     */
+    BlockRun processBlock(ParameterChangeScheduler& scheduler, int total_samples) {
+        BlockRun run;
+        if (total_samples == 0) {
+            applyChanges(scheduler, ParameterChangeScheduler::kEndOfBlock, 0, run);
+            return run;
+        }
+
+        for (int sample_offset = 0; sample_offset < total_samples;) {
+            applyChanges(scheduler, sample_offset, sample_offset, run);
+
+            int max_samples = std::min(total_samples - sample_offset, vital::kMaxBufferSize);
+            int num_samples = scheduler.getSplitSamples(sample_offset, max_samples);
+            run.chunks.push_back(num_samples);
+            sample_offset += num_samples;
+        }
+
+        applyChanges(scheduler, ParameterChangeScheduler::kEndOfBlock, total_samples, run);
+        return run;
+    }
+
+    /**
+     * @brief Walks a bypassed block, which SynthPlugin doesn't split.
+     */
+    BlockRun processBlockBypassed(ParameterChangeScheduler& scheduler) {
+        BlockRun run;
+        applyChanges(scheduler, ParameterChangeScheduler::kEndOfBlock, 0, run);
+        return run;
+    }
+
+    bool hasChunkBoundary(const BlockRun& run, int sample) {
+        int boundary = 0;
+        for (int chunk : run.chunks) {
+            if (boundary == sample)
+                return true;
+            boundary += chunk;
+        }
+        return boundary == sample;
+    }
+
+    int totalSamples(const BlockRun& run) {
+        int total = 0;
+        for (int chunk : run.chunks)
+            total += chunk;
+        return total;
+    }
+} // namespace
+
+void ParameterChangeSchedulerTest::runTest() {
+    testSplitPoints();
+    testMinimumSplit();
+    testChangeOrder();
+    testOverflow();
+    testBypass();
+    testEmptyBlock();
+}
+
+void ParameterChangeSchedulerTest::testSplitPoints() {
+    beginTest("Split Points");
+    const int kChangeSamples[] = { 100, 300, 340 + vital::kMaxBufferSize, kSchedulerBlockSize + 88 };
+
+    ParameterChangeScheduler scheduler;
+    for (int i = 0; i < 4; ++i)
+        expect(scheduler.schedule(i, i * 0.25f, kChangeSamples[i]));
+
+    BlockRun run = processBlock(scheduler, kSchedulerBlockSize);
+    expectEquals(totalSamples(run), kSchedulerBlockSize);
+    for (int chunk : run.chunks) {
+        expect(chunk > 0, "Block has an empty chunk.");
+        expect(chunk <= vital::kMaxBufferSize, "Chunk is longer than the engine's buffer.");
+    }
+
+    expectEquals(static_cast<int>(run.applied.size()), 4);
+    for (int i = 0; i < 3; ++i) {
+        expect(hasChunkBoundary(run, kChangeSamples[i]), "Block wasn't split at a change.");
+        expectEquals(run.applied[i].applied_at, kChangeSamples[i]);
+    }
+    expectEquals(run.applied[3].applied_at, kSchedulerBlockSize, "Change past the block wasn't applied at its end.");
+    expectEquals(scheduler.getNumPendingChanges(), 0);
+}
+
+void ParameterChangeSchedulerTest::testMinimumSplit() {
+    beginTest("Minimum Split");
+    const int kChangeSamples[] = { 5, 10, 20, 21, kSchedulerBlockSize - 3 };
+    static constexpr int kNumChanges = sizeof(kChangeSamples) / sizeof(kChangeSamples[0]);
+    static constexpr int kMin = ParameterChangeScheduler::kMinChangeSamples;
+
+    ParameterChangeScheduler scheduler;
+    for (int i = 0; i < kNumChanges; ++i)
+        scheduler.schedule(i, 1.0f, kChangeSamples[i]);
+
+    BlockRun run = processBlock(scheduler, kSchedulerBlockSize);
+    expectEquals(totalSamples(run), kSchedulerBlockSize);
+    for (int i = 0; i < static_cast<int>(run.chunks.size()) - 1; ++i)
+        expect(run.chunks[i] >= kMin, "Chunk is shorter than the minimum split.");
+
+    expectEquals(static_cast<int>(run.applied.size()), kNumChanges);
+    for (int i = 0; i < kNumChanges; ++i) {
+        expect(run.applied[i].applied_at >= kChangeSamples[i], "Change applied before its sample.");
+        expect(run.applied[i].applied_at < kChangeSamples[i] + kMin, "Change applied too late.");
+    }
+
+    expectEquals(run.applied[0].applied_at, kMin);
+    expectEquals(run.applied[1].applied_at, kMin);
+    expectEquals(run.applied[2].applied_at, 2 * kMin);
+    expectEquals(run.applied[3].applied_at, 2 * kMin);
+    expectEquals(run.applied[4].applied_at, kChangeSamples[4]);
+    expectEquals(run.chunks.back(), 3, "Block end should allow a chunk under the minimum.");
+}
+
+void ParameterChangeSchedulerTest::testChangeOrder() {
+    beginTest("Change Order");
+    ParameterChangeScheduler scheduler;
+    scheduler.schedule(1, 0.1f, 50);
+    scheduler.schedule(2, 0.2f, 50);
+    scheduler.schedule(1, 0.3f, 50);
+    scheduler.schedule(3, 0.4f, 20);
+    scheduler.schedule(2, 0.5f, 200);
+    scheduler.schedule(4, 0.6f, 50);
+
+    BlockRun run = processBlock(scheduler, kSchedulerBlockSize);
+    const AppliedChange kExpected[] = {
+        { 3, 0.4f, 20 }, { 1, 0.1f, 50 }, { 2, 0.2f, 50 }, { 1, 0.3f, 50 }, { 4, 0.6f, 50 }, { 2, 0.5f, 200 }
+    };
+
+    expectEquals(static_cast<int>(run.applied.size()), 6);
+    for (int i = 0; i < std::min(6, static_cast<int>(run.applied.size())); ++i) {
+        expectEquals(run.applied[i].parameter_index, kExpected[i].parameter_index);
+        expectEquals(run.applied[i].value, kExpected[i].value);
+        expectEquals(run.applied[i].applied_at, kExpected[i].applied_at);
+    }
+}
+
+void ParameterChangeSchedulerTest::testOverflow() {
+    beginTest("Overflow");
+    static constexpr int kMaxChanges = ParameterChangeScheduler::kMaxChanges;
+
+    ParameterChangeScheduler scheduler;
+    int scheduled = 0;
+    for (int i = 0; i < kMaxChanges; ++i) {
+        if (scheduler.schedule(i % 100, 1.0f, 1 + (i * 7) % (kSchedulerBlockSize - 1)))
+            scheduled++;
+    }
+    expectEquals(scheduled, kMaxChanges);
+    expect(!scheduler.schedule(0, 1.0f, 10), "Change past kMaxChanges should be applied immediately.");
+    expectEquals(scheduler.getNumPendingChanges(), kMaxChanges);
+
+    BlockRun run = processBlock(scheduler, kSchedulerBlockSize);
+    expectEquals(static_cast<int>(run.applied.size()), kMaxChanges);
+    expectEquals(scheduler.getNumPendingChanges(), 0);
+
+    int out_of_order = 0;
+    for (int i = 1; i < static_cast<int>(run.applied.size()); ++i) {
+        if (run.applied[i].applied_at < run.applied[i - 1].applied_at)
+            out_of_order++;
+    }
+    expectEquals(out_of_order, 0, "Changes were applied out of sample order.");
+
+    expect(scheduler.schedule(0, 1.0f, 10), "Drained scheduler should take new changes.");
+}
+
+void ParameterChangeSchedulerTest::testBypass() {
+    beginTest("Bypass");
+    ParameterChangeScheduler scheduler;
+    scheduler.setBypassParameter(kBypassIndex);
+
+    expect(!scheduler.schedule(kBypassIndex, 1.0f, 100), "Bypass change shouldn't be scheduled.");
+    expect(scheduler.schedule(1, 0.5f, 300));
+    expect(scheduler.schedule(2, 0.25f, 100));
+    expectEquals(scheduler.getNumPendingChanges(), 2);
+
+    BlockRun run = processBlockBypassed(scheduler);
+    expectEquals(static_cast<int>(run.applied.size()), 2);
+    if (run.applied.size() == 2) {
+        expectEquals(run.applied[0].parameter_index, 2);
+        expectEquals(run.applied[1].parameter_index, 1);
+    }
+    expectEquals(scheduler.getNumPendingChanges(), 0);
+
+    BlockRun next_run = processBlock(scheduler, kSchedulerBlockSize);
+    expect(next_run.applied.empty(), "Changes from a bypassed block leaked into the next block.");
+    expectEquals(static_cast<int>(next_run.chunks.size()), kSchedulerBlockSize / vital::kMaxBufferSize);
+}
+
+void ParameterChangeSchedulerTest::testEmptyBlock() {
+    beginTest("Empty Block");
+    ParameterChangeScheduler scheduler;
+    expect(!scheduler.schedule(1, 0.5f, 0), "Change at the block start shouldn't be scheduled.");
+    expect(!scheduler.schedule(1, 0.5f, -4), "Change before the block start shouldn't be scheduled.");
+
+    scheduler.schedule(1, 0.5f, 10);
+    scheduler.schedule(2, 0.5f, kSchedulerBlockSize + 10);
+
+    BlockRun run = processBlock(scheduler, 0);
+    expect(run.chunks.empty(), "Empty block was processed.");
+    expectEquals(static_cast<int>(run.applied.size()), 2);
+    expectEquals(scheduler.getNumPendingChanges(), 0);
+
+    BlockRun next_run = processBlock(scheduler, kSchedulerBlockSize);
+    expect(next_run.applied.empty(), "Changes from an empty block leaked into the next block.");
+}
+
+// Registers the test instance so it will be discovered and run automatically.
+static ParameterChangeSchedulerTest parameter_change_scheduler_test;
@@ -0,0 +1,58 @@
+/**
+ * @file parameter_change_scheduler_test.h
+ * @brief Declares the ParameterChangeSchedulerTest class for checking how host automation splits audio blocks.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class ParameterChangeSchedulerTest
+ * @brief A test class verifying where ParameterChangeScheduler splits a block and when each change is applied.
+ *
+ * Blocks are walked the way SynthPlugin::processBlock walks them, recording every chunk and the sample each
+ * change was applied at.
+ */
+class ParameterChangeSchedulerTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a ParameterChangeSchedulerTest with a specified name and category.
+     */
+    ParameterChangeSchedulerTest() : UnitTest("Parameter Change Scheduler", "Framework") { }
+
+    /**
+     * @brief Runs all parameter change scheduler tests.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Tests that chunks end on change samples and changes past the block apply at its end.
+     */
+    void testSplitPoints();
+
+    /**
+     * @brief Tests that chunks are never shorter than kMinChangeSamples, except at the end of the block.
+     */
+    void testMinimumSplit();
+
+    /**
+     * @brief Tests that changes apply in sample order, and in scheduling order on the same sample.
+     */
+    void testChangeOrder();
+
+    /**
+     * @brief Tests that changes past kMaxChanges are applied immediately and a drained scheduler takes more.
+     */
+    void testOverflow();
+
+    /**
+     * @brief Tests that bypass changes aren't scheduled and a bypassed block applies every change.
+     */
+    void testBypass();
+
+    /**
+     * @brief Tests that changes at the block start aren't scheduled and an empty block applies every change.
+     */
+    void testEmptyBlock();
+};
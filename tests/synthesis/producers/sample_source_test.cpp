@@ -1,10 +1,214 @@
 /**
  * @file sample_source_test.cpp
- * @brief Implements the SampleSourceTest class, performing input bounds tests on the SampleSource processor.
+ * @brief Implements the SampleSourceTest class, performing input bounds tests on the SampleSource processor
+ *        and comparing streamed playback against in-memory playback.
  */
 
 #include "sample_source_test.h"
 #include "sample_source.h"
+#include "value.h"
+
+namespace {
+    /// Sample rate of the streamed test file.
+    constexpr int kStreamSampleRate = 44100;
+    /// Length of the streamed test file, long enough to have pages that aren't preloaded.
+    constexpr int kStreamLength = 4 * kStreamSampleRate;
+    /// Source frames compared, kept inside the preloaded region so the result doesn't depend on the reader.
+    constexpr int kStreamComparedFrames = kStreamSampleRate;
+    /// Block size used while playing back.
+    constexpr int kStreamBlockSize = 64;
+    /// Largest allowed difference between streamed and in-memory playback.
+    constexpr float kMaxStreamError = 0.00001f;
+    /// Transpositions covering the upsampled, original and a downsampled level.
+    constexpr float kStreamTransposes[] = { -7.0f, 0.0f, 12.0f };
+    /// Page budget for the paging test, just enough for one playhead's read ahead.
+    constexpr int kPagingCacheSize = vital::SampleStream::kReadAheadPages + 1;
+    /// Longest wait for the reader thread to load or evict pages.
+    constexpr int kMaxReaderWaitMs = 2000;
+
+    /**
+     * @brief Waits for the reader thread until the stream has exactly the given pages beyond the preloaded ones.
+     */
+    bool waitForResidentPages(vital::SampleStream* stream, int first_page, int num_pages) {
+        for (int waited = 0; waited < kMaxReaderWaitMs; ++waited) {
+            bool resident = stream->numResidentPages() == stream->numPinnedPages() + num_pages;
+            for (int i = 0; i < num_pages; ++i)
+                resident = resident && stream->isResident(first_page + i);
+
+            if (resident)
+                return true;
+            Thread::sleep(1);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the largest difference between a streamed page at the original rate and the source.
+     */
+    float pageError(vital::SampleStream* stream, int page, const vital::mono_float* left,
+                    const vital::mono_float* right) {
+        float max_error = 0.0f;
+        int start = page * vital::SampleStream::kPageSize;
+        int end = std::min(start + vital::SampleStream::kPageSize, stream->length());
+        for (int i = start; i < end; ++i) {
+            max_error = std::max(max_error, std::abs(stream->read(1, 0, i, false) - left[i]));
+            max_error = std::max(max_error, std::abs(stream->read(1, 1, i, false) - right[i]));
+        }
+        return max_error;
+    }
+
+    File writeTestFile(vital::mono_float* left, vital::mono_float* right) {
+        File file = File::createTempFile(".wav");
+        std::unique_ptr<FileOutputStream> stream = file.createOutputStream();
+        WavAudioFormat wav_format;
+        std::unique_ptr<AudioFormatWriter> writer(wav_format.createWriterFor(stream.get(), kStreamSampleRate,
+                                                                             2, 32, {}, 0));
+        if (writer == nullptr)
+            return file;
+
+        stream.release();
+        const float* channels[] = { left, right };
+        writer->writeFromFloatArrays(channels, 2, kStreamLength);
+        return file;
+    }
+}
+
+void SampleSourceTest::runStreamTest() {
+    beginTest("Streaming Matches Memory");
+
+    std::unique_ptr<vital::mono_float[]> left = std::make_unique<vital::mono_float[]>(kStreamLength);
+    std::unique_ptr<vital::mono_float[]> right = std::make_unique<vital::mono_float[]>(kStreamLength);
+    for (int i = 0; i < kStreamLength; ++i) {
+        left[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+        right[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+    }
+    File file = writeTestFile(left.get(), right.get());
+
+    for (float transpose : kStreamTransposes) {
+        vital::SampleSource memory_source;
+        vital::SampleSource stream_source;
+        memory_source.getSample()->loadSample(left.get(), right.get(), kStreamLength, kStreamSampleRate);
+        expect(stream_source.getSample()->loadStream(file.getFullPathName().toStdString()), "Couldn't open stream");
+        expect(stream_source.getSample()->isStreaming());
+        expectEquals(stream_source.getSample()->originalLength(), kStreamLength);
+
+        vital::Value zero(0.0f);
+        vital::Value level(1.0f);
+        vital::Value transpose_value(transpose);
+        vital::SampleSource* sources[] = { &memory_source, &stream_source };
+        for (vital::SampleSource* source : sources) {
+            source->setSampleRate(kStreamSampleRate);
+            for (int i = 0; i < vital::SampleSource::kNumInputs; ++i)
+                source->plug(&zero, i);
+            source->plug(&level, vital::SampleSource::kLevel);
+            source->plug(&transpose_value, vital::SampleSource::kTranspose);
+        }
+
+        float frames_per_sample = std::pow(2.0f, transpose / vital::kNotesPerOctave);
+        int num_samples = kStreamComparedFrames / frames_per_sample;
+        float max_error = 0.0f;
+        for (int position = 0; position < num_samples; position += kStreamBlockSize) {
+            memory_source.process(kStreamBlockSize);
+            stream_source.process(kStreamBlockSize);
+            for (int i = 0; i < kStreamBlockSize; ++i) {
+                vital::poly_float difference = memory_source.output(vital::SampleSource::kRaw)->buffer[i] -
+                                               stream_source.output(vital::SampleSource::kRaw)->buffer[i];
+                for (int c = 0; c < vital::poly_float::kSize; ++c)
+                    max_error = std::max(max_error, std::abs(difference[c]));
+            }
+        }
+
+        expect(max_error < kMaxStreamError, "Streamed playback differs from memory by " + String(max_error));
+    }
+
+    file.deleteFile();
+}
+
+void SampleSourceTest::runStreamPagingTest() {
+    beginTest("Streaming Pages In And Evicts");
+
+    std::unique_ptr<vital::mono_float[]> left = std::make_unique<vital::mono_float[]>(kStreamLength);
+    std::unique_ptr<vital::mono_float[]> right = std::make_unique<vital::mono_float[]>(kStreamLength);
+    for (int i = 0; i < kStreamLength; ++i) {
+        left[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+        right[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+    }
+    File file = writeTestFile(left.get(), right.get());
+
+    std::unique_ptr<vital::SampleStream> stream = vital::SampleStream::open(file.getFullPathName().toStdString(),
+                                                                            kPagingCacheSize);
+    expect(stream != nullptr, "Couldn't open stream");
+    if (stream == nullptr)
+        return;
+
+    // Only the preloaded pages are resident until a playhead asks for more.
+    int first_page = stream->numPinnedPages();
+    int num_pages = (kStreamLength + vital::SampleStream::kPageSize - 1) / vital::SampleStream::kPageSize;
+    expect(first_page + kPagingCacheSize < num_pages, "Test file is too short to evict pages");
+    expectEquals(stream->numResidentPages(), first_page);
+    expectEquals(stream->read(1, 0, first_page * vital::SampleStream::kPageSize, false), 0.0f);
+
+    // The reader loads the requested page and the read ahead.
+    stream->request(first_page * vital::SampleStream::kPageSize, false, false);
+    expect(waitForResidentPages(stream.get(), first_page, kPagingCacheSize), "Reader didn't load requested pages");
+    for (int i = 0; i < kPagingCacheSize; ++i)
+        expectEquals(pageError(stream.get(), first_page + i, left.get(), right.get()), 0.0f);
+
+    // Moving the playhead on goes past the budget, so the least recently used pages are evicted.
+    stream->markUsed();
+    stream->markUnused();
+    int next_page = first_page + kPagingCacheSize - 1;
+    stream->request(next_page * vital::SampleStream::kPageSize, false, false);
+    int num_kept = std::min(kPagingCacheSize, num_pages - next_page);
+    expect(waitForResidentPages(stream.get(), next_page, num_kept), "Reader didn't evict unused pages");
+    for (int i = first_page; i < next_page; ++i)
+        expect(!stream->isResident(i), "Least recently used page wasn't evicted");
+    for (int i = 0; i < num_kept; ++i)
+        expectEquals(pageError(stream.get(), next_page + i, left.get(), right.get()), 0.0f);
+
+    stream = nullptr;
+    file.deleteFile();
+}
+
+void SampleSourceTest::runStreamStateTest() {
+    beginTest("Streaming State Round Trip");
+
+    std::unique_ptr<vital::mono_float[]> left = std::make_unique<vital::mono_float[]>(kStreamLength);
+    std::unique_ptr<vital::mono_float[]> right = std::make_unique<vital::mono_float[]>(kStreamLength);
+    for (int i = 0; i < kStreamLength; ++i) {
+        left[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+        right[i] = (rand() * 2.0f) / RAND_MAX - 1.0f;
+    }
+    File file = writeTestFile(left.get(), right.get());
+    std::string path = file.getFullPathName().toStdString();
+
+    vital::Sample sample;
+    expect(sample.loadStream(path), "Couldn't open stream");
+    sample.setName("Streamed");
+
+    // Streamed samples store the file path instead of the audio.
+    json state = sample.stateToJson();
+    expect(state.count("stream_file") == 1, "Streamed sample didn't save its file");
+    expect(state.count("samples") == 0, "Streamed sample saved its audio");
+    expect(state["stream_file"].get<std::string>() == path);
+
+    vital::Sample loaded;
+    loaded.jsonToState(state);
+    expect(loaded.isStreaming(), "Loaded sample isn't streaming");
+    expect(loaded.getName() == "Streamed");
+    expectEquals(loaded.originalLength(), kStreamLength);
+    expectEquals(loaded.sampleRate(), kStreamSampleRate);
+    expect(loaded.stream() != nullptr && loaded.stream()->getPath() == path);
+    expect(loaded.stateToJson() == state, "Saving the loaded sample gave a different state");
+
+    // A missing file falls back to the default sample.
+    file.deleteFile();
+    vital::Sample missing;
+    missing.loadSample(left.get(), right.get(), 100, kStreamSampleRate);
+    missing.jsonToState(state);
+    expect(!missing.isStreaming(), "Missing file is still streaming");
+    expectEquals(missing.originalLength(), vital::Sample::kDefaultSampleLength);
+}
 
 void SampleSourceTest::runTest() {
     // Create a SampleSource processor instance.
@@ -12,6 +216,10 @@ void SampleSourceTest::runTest() {
 
     // Run a standardized input bounds test to ensure the sample source handles extreme inputs gracefully.
     runInputBoundsTest(&sample_source);
+
+    runStreamTest();
+    runStreamPagingTest();
+    runStreamStateTest();
 }
 
 // Registers the test instance so it will be automatically discovered and run.
@@ -27,4 +27,22 @@ public:
      *        processor output remains stable and finite under extreme input conditions.
      */
     void runTest() override;
+
+    /**
+     * @brief Plays a sample streamed from a temporary file and checks it matches the same sample played
+     *        from memory at several band-limited levels.
+     */
+    void runStreamTest();
+
+    /**
+     * @brief Checks the reader thread loads requested pages beyond the preloaded ones and evicts the least
+     *        recently used pages once the cache budget is full.
+     */
+    void runStreamPagingTest();
+
+    /**
+     * @brief Checks a streamed sample saves its file path and loads back as the same stream, and that a missing
+     *        file falls back to the default sample.
+     */
+    void runStreamStateTest();
 };
@@ -0,0 +1,152 @@
+/**
+ * @file state_cache_test.cpp
+ * @brief Implements the StateCacheTest class, comparing cached and uncached host state saves after edits.
+ */
+
+#include "state_cache_test.h"
+#include "convolution_reverb.h"
+#include "line_generator.h"
+#include "load_save.h"
+#include "modulation_connection_processor.h"
+#include "sample_source.h"
+#include "synth_base.h"
+#include "wave_source.h"
+#include "wave_warp_modifier.h"
+#include "wavetable_creator.h"
+#include "wavetable_group.h"
+
+#include <functional>
+
+namespace {
+    /// Length of the sample and impulse response loaded by the edits.
+    constexpr int kAudioLength = 4096;
+    /// Sample rate of the loaded sample and impulse response.
+    constexpr int kAudioSampleRate = 44100;
+
+    /// A SynthBase without a host or interface that can save its state the way SynthPlugin does.
+    class StateCacheSynth : public SynthBase {
+    public:
+        const CriticalSection& getCriticalSection() override { return critical_section_; }
+        void pauseProcessing(bool pause) override { }
+        SynthGuiInterface* getGuiInterface() override { return nullptr; }
+
+        std::string save() { return LoadSave::stateToJson(this, critical_section_).dump(); }
+
+        void clearStateCaches() {
+            for (int i = 0; i < vital::kNumOscillators; ++i)
+                getWavetableCreator(i)->clearStateCache();
+            for (int i = 0; i < vital::kNumLfos; ++i)
+                getLfoSource(i)->clearStateCache();
+            for (int i = 0; i < vital::kMaxModulationConnections; ++i)
+                getModulationBank().atIndex(i)->modulation_processor->lineMapGenerator()->clearStateCache();
+
+            getSample()->clearStateCache();
+            getReverbImpulseResponse()->clearStateCache();
+        }
+
+    private:
+        CriticalSection critical_section_;
+    };
+
+    /// One edit to the preset, applied without rendering anything afterwards.
+    struct StateEdit {
+        std::string name;
+        std::function<void(StateCacheSynth&)> apply;
+    };
+
+    WavetableGroup* firstGroup(StateCacheSynth& synth) {
+        return synth.getWavetableCreator(0)->getGroup(0);
+    }
+
+    WaveSource* firstWaveSource(StateCacheSynth& synth) {
+        return dynamic_cast<WaveSource*>(firstGroup(synth)->getComponent(0));
+    }
+
+    std::vector<vital::mono_float> createAudio(float frequency) {
+        std::vector<vital::mono_float> audio(kAudioLength);
+        for (int i = 0; i < kAudioLength; ++i)
+            audio[i] = 0.5f * sinf(2.0f * vital::kPi * frequency * i / kAudioSampleRate);
+        return audio;
+    }
+
+    std::vector<StateEdit> createEdits() {
+        return {
+            { "Control", [](StateCacheSynth& synth) {
+                synth.valueChangedInternal("osc_1_level", 0.3f);
+            } },
+            { "Modulation", [](StateCacheSynth& synth) {
+                synth.connectModulation("lfo_1", "filter_1_cutoff");
+            } },
+            { "Modulation Line Mapping", [](StateCacheSynth& synth) {
+                LineGenerator* mapping = synth.getModulationBank().atIndex(0)->modulation_processor->lineMapGenerator();
+                mapping->setPoint(0, { 0.0f, 0.5f });
+            } },
+            { "LFO Point", [](StateCacheSynth& synth) {
+                synth.getLfoSource(0)->setPoint(1, { 0.4f, 0.2f });
+            } },
+            { "Wavetable Component Added", [](StateCacheSynth& synth) {
+                WaveWarpModifier* warp = new WaveWarpModifier();
+                warp->insertNewKeyframe(0);
+                firstGroup(synth)->addComponent(warp);
+            } },
+            { "Wavetable Keyframe Setting", [](StateCacheSynth& synth) {
+                WaveWarpModifier* warp = dynamic_cast<WaveWarpModifier*>(firstGroup(synth)->getComponent(1));
+                warp->getKeyframe(0)->setHorizontalPower(3.0f);
+            } },
+            { "Wavetable Keyframe Inserted", [](StateCacheSynth& synth) {
+                firstWaveSource(synth)->insertNewKeyframe(128);
+            } },
+            { "Wavetable Keyframe Moved", [](StateCacheSynth& synth) {
+                WaveSource* wave_source = firstWaveSource(synth);
+                WavetableKeyframe* keyframe = wave_source->getKeyframe(1);
+                keyframe->setPosition(200);
+                wave_source->reposition(keyframe);
+            } },
+            { "Wavetable Interpolation Style", [](StateCacheSynth& synth) {
+                firstWaveSource(synth)->setInterpolationStyle(WavetableComponent::kCubic);
+            } },
+            { "Wavetable Keyframe Data", [](StateCacheSynth& synth) {
+                // Editors draw into the wave frame directly and then mark the component changed.
+                WaveSource* wave_source = firstWaveSource(synth);
+                wave_source->getWaveFrame(0)->time_domain[0] = 0.25f;
+                wave_source->markChanged();
+            } },
+            { "Wavetable Component Removed", [](StateCacheSynth& synth) {
+                firstGroup(synth)->removeComponent(1);
+            } },
+            { "Sample Loaded", [](StateCacheSynth& synth) {
+                std::vector<vital::mono_float> audio = createAudio(440.0f);
+                synth.getSample()->loadSample(audio.data(), kAudioLength, kAudioSampleRate);
+            } },
+            { "Impulse Response Loaded", [](StateCacheSynth& synth) {
+                std::vector<vital::mono_float> audio = createAudio(220.0f);
+                synth.getReverbImpulseResponse()->loadSample(audio.data(), kAudioLength, kAudioSampleRate);
+            } }
+        };
+    }
+} // namespace
+
+void StateCacheTest::runTest() {
+    beginTest("Cached Saves Match Uncached Saves");
+
+    StateCacheSynth synth;
+    std::string previous = synth.save();
+    synth.clearStateCaches();
+    expect(synth.save() == previous, "Initial save changed when caches were cleared.");
+
+    for (const StateEdit& edit : createEdits()) {
+        edit.apply(synth);
+
+        std::string cached = synth.save();
+        expect(cached != previous, edit.name + " edit is missing from the cached save.");
+
+        synth.clearStateCaches();
+        std::string uncached = synth.save();
+        expect(cached == uncached, edit.name + " edit saved differently with caches.");
+
+        previous = uncached;
+    }
+}
+
+// Registers the test instance so it will be discovered and run automatically.
+static StateCacheTest state_cache_test;
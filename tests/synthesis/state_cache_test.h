@@ -0,0 +1,29 @@
+/**
+ * @file state_cache_test.h
+ * @brief Declares the StateCacheTest class for checking that cached preset saves match uncached ones.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class StateCacheTest
+ * @brief A test class verifying that host state saves with the serialization caches give the same bytes as saves
+ *        with the caches dropped.
+ *
+ * Each step edits one part of the preset without rendering, saves with the caches warm, then clears every cache
+ * and saves again. Both saves must be byte identical and must include the edit.
+ */
+class StateCacheTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a StateCacheTest with a specified name and category.
+     */
+    StateCacheTest() : UnitTest("State Cache", "Framework") { }
+
+    /**
+     * @brief Runs all state cache tests.
+     */
+    void runTest() override;
+};
@@ -0,0 +1,114 @@
+/**
+ * @file file_source_test.cpp
+ * @brief Implements the FileSourceTest class, comparing vectorized and per point resampling of a FileSource.
+ */
+
+#include "file_source_test.h"
+#include "file_source.h"
+#include "poly_utils.h"
+
+namespace {
+    /// Sample rate of the generated source audio.
+    constexpr int kSourceSampleRate = 44100;
+    /// Length of the generated source audio, the longest a FileSource accepts.
+    constexpr int kSourceLength = FileSource::kMaxFileSourceSamples;
+    /// Largest change per sample of the source audio's interpolated curve, with headroom for overshoot.
+    constexpr double kMaxSourceSlope = 0.2;
+    /// Largest allowed difference from the double precision reference, from float arithmetic alone.
+    constexpr double kMaxResampleError = 0.000001;
+
+    /// A window of evenly spaced output points to resample.
+    struct ResampleCase {
+        std::string name;
+        double start_position;
+        double delta;
+        int num_samples;
+    };
+
+    const ResampleCase kResampleCases[] = {
+        { "Whole Frame At Start", 0.0, 1.0, vital::WaveFrame::kWaveformSize },
+        { "Fractional Window", 1234.37, 0.73, vital::WaveFrame::kWaveformSize },
+        { "Far Into Buffer", 170000.5, 2.1, vital::WaveFrame::kWaveformSize },
+        { "Clamped At End", kSourceLength - 1000.25, 1.3, vital::WaveFrame::kWaveformSize },
+        { "Odd Length Fade", 96000.8, 1.7, 1021 },
+        { "Single Point", 4321.6, 0.0, 1 }
+    };
+
+    float sourceSample(int index) {
+        double phase = 2.0 * vital::kPi * index / kSourceSampleRate;
+        return 0.6f * sin(440.0 * phase) + 0.3f * sin(3001.0 * phase);
+    }
+
+    /// The per point interpolation FileSource used before, with the absolute position rounded to a float.
+    float perPointSample(const FileSource::SampleBuffer* sample_buffer, float position) {
+        float clamped_position = vital::utils::clamp(position, 0.0f, sample_buffer->size - 1);
+        int start_index = clamped_position;
+        float t = clamped_position - start_index;
+
+        vital::matrix interpolation_matrix = vital::utils::getCatmullInterpolationMatrix(t);
+        vital::matrix value_matrix = vital::utils::getValueMatrix(sample_buffer->data.get(), start_index);
+        value_matrix.transpose();
+        return interpolation_matrix.multiplyAndSumRows(value_matrix)[0];
+    }
+
+    /// Catmull-Rom interpolation of the same buffer computed in double precision.
+    double exactSample(const FileSource::SampleBuffer* sample_buffer, double position) {
+        double clamped_position = std::min(std::max(position, 0.0), sample_buffer->size - 1.0);
+        int start_index = clamped_position;
+        double t = clamped_position - start_index;
+        const float* points = sample_buffer->data.get() + start_index;
+
+        double p0 = points[0];
+        double p1 = points[1];
+        double p2 = points[2];
+        double p3 = points[3];
+        return 0.5 * (2.0 * p1 + (p2 - p0) * t + (2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3) * t * t +
+                      (3.0 * (p1 - p2) + p3 - p0) * t * t * t);
+    }
+} // namespace
+
+void FileSourceTest::runTest() {
+    testResampling();
+}
+
+void FileSourceTest::testResampling() {
+    std::unique_ptr<float[]> audio = std::make_unique<float[]>(kSourceLength);
+    for (int i = 0; i < kSourceLength; ++i)
+        audio[i] = sourceSample(i);
+
+    FileSource file_source;
+    file_source.loadBuffer(audio.get(), kSourceLength, kSourceSampleRate);
+    std::unique_ptr<WavetableKeyframe> keyframe(file_source.createKeyframe(0));
+    FileSource::FileSourceKeyframe* file_keyframe = dynamic_cast<FileSource::FileSourceKeyframe*>(keyframe.get());
+    const FileSource::SampleBuffer* sample_buffer = file_source.buffer();
+
+    for (const ResampleCase& resample_case : kResampleCases) {
+        beginTest(resample_case.name);
+
+        std::vector<float> samples(resample_case.num_samples);
+        file_keyframe->getScaledInterpolatedSamples(samples.data(), resample_case.start_position,
+                                                    resample_case.delta, resample_case.num_samples);
+
+        int per_point_mismatches = 0;
+        int reference_mismatches = 0;
+        for (int i = 0; i < resample_case.num_samples; ++i) {
+            double position = resample_case.start_position + i * resample_case.delta;
+
+            // The per point loop rounded the absolute position to a float, which is off by up to half a float
+            // step. That moves its output by at most that distance times the curve's slope.
+            double position_rounding = 0.5 * std::abs(position) * std::numeric_limits<float>::epsilon();
+            double per_point_tolerance = kMaxResampleError + kMaxSourceSlope * position_rounding;
+            if (std::abs(samples[i] - perPointSample(sample_buffer, position)) > per_point_tolerance)
+                per_point_mismatches++;
+
+            if (std::abs(samples[i] - exactSample(sample_buffer, position)) > kMaxResampleError)
+                reference_mismatches++;
+        }
+
+        expectEquals(per_point_mismatches, 0, "Resampled window differs from per point interpolation.");
+        expectEquals(reference_mismatches, 0, "Resampled window differs from the double precision reference.");
+    }
+}
+
+// Registers the test instance so it will be discovered and run automatically.
+static FileSourceTest file_source_test;
@@ -0,0 +1,34 @@
+/**
+ * @file file_source_test.h
+ * @brief Declares the FileSourceTest class, which tests resampling audio into wavetable frames.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+/**
+ * @class FileSourceTest
+ * @brief A test class comparing FileSource's vectorized resampling against per point interpolation.
+ *
+ * getScaledInterpolatedSamples() computes several output points at once with positions relative to the window
+ * start. It's checked against the per point loop it replaced, which rounded each absolute position to a float,
+ * and against a double precision Catmull-Rom reference.
+ */
+class FileSourceTest : public UnitTest {
+public:
+    /**
+     * @brief Constructs a FileSourceTest with a specified name and category.
+     */
+    FileSourceTest() : UnitTest("File Source", "Wavetable") { }
+
+    /**
+     * @brief Runs all file source tests.
+     */
+    void runTest() override;
+
+    /**
+     * @brief Checks resampled windows against the per point interpolation and the double precision reference.
+     */
+    void testResampling();
+};
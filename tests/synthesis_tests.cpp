@@ -1,17 +1,25 @@
 #include "synthesis/note_handler_test.cpp"
+#include "synthesis/parameter_change_scheduler_test.cpp"
 #include "synthesis/processor_test.cpp"
+#include "synthesis/state_cache_test.cpp"
 #include "synthesis/poly_utils_test.cpp"
 #include "synthesis/framework/circular_queue_test.cpp"
 #include "synthesis/framework/matrix_test.cpp"
 #include "synthesis/framework/poly_values_test.cpp"
+#include "synthesis/framework/modulation_routing_test.cpp"
+#include "synthesis/framework/synth_module_test.cpp"
+#include "synthesis/lookups/lookup_table_test.cpp"
 #include "synthesis/lookups/wave_frame_test.cpp"
 #include "synthesis/producers/synth_oscillator_test.cpp"
 #include "synthesis/producers/sample_source_test.cpp"
+#include "synthesis/wavetable/file_source_test.cpp"
 #include "synthesis/effects/distortion_test.cpp"
 #include "synthesis/effects/compressor_test.cpp"
 #include "synthesis/effects/phaser_test.cpp"
 #include "synthesis/effects/delay_test.cpp"
 #include "synthesis/effects/reverb_test.cpp"
+#include "synthesis/effects/convolution_reverb_test.cpp"
+#include "synthesis/effects/equalizer_module_test.cpp"
 #include "synthesis/filters/comb_filter_test.cpp"
 #include "synthesis/filters/decimator_test.cpp"
 #include "synthesis/filters/fir_halfband_decimator_test.cpp"
@@ -25,7 +33,10 @@
 #include "synthesis/filters/iir_halfband_decimator_test.cpp"
 #include "synthesis/filters/ladder_filter_test.cpp"
 #include "synthesis/filters/formant_filter_test.cpp"
+#include "synthesis/filters/upsampler_test.cpp"
+#include "synthesis/filters/synth_filter_test.cpp"
 #include "synthesis/modulators/random_lfo_test.cpp"
+#include "synthesis/modulators/line_generator_test.cpp"
 #include "synthesis/modulators/synth_lfo_test.cpp"
 #include "synthesis/modulators/envelope_test.cpp"
 #include "synthesis/modulators/trigger_random_test.cpp"
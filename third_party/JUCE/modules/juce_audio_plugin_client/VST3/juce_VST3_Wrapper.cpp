@@ -2542,7 +2542,7 @@ public:
     }
 
     //==============================================================================
-    void processParameterChanges (Vst::IParameterChanges& paramChanges)
+    void processParameterChanges (Vst::IParameterChanges& paramChanges, int numSamples)
     {
         if (juceVST3EditController == nullptr)
             return;
@@ -2583,7 +2583,22 @@ public:
 
                         if (auto* param = comPluginInstance->getParamForVSTParamID (vstParamID))
                         {
-                            param->setValue (floatValue);
+                            // A flush without audio may never reach processBlock, so only its last point is applied.
+                            if (numSamples <= 0)
+                            {
+                                param->setValue (floatValue);
+                            }
+                            else
+                            {
+                                for (Steinberg::int32 point = 0; point < numPoints; ++point)
+                                {
+                                    Steinberg::int32 pointOffset = 0;
+                                    double pointValue = 0.0;
+
+                                    if (paramQueue->getPoint (point, pointOffset, pointValue) == kResultTrue)
+                                        param->setValueAtSampleOffset (static_cast<float> (pointValue), (int) pointOffset);
+                                }
+                            }
 
                             inParameterChangedCallback = true;
                             param->sendValueChangedMessageToListeners (floatValue);
@@ -2640,7 +2655,7 @@ public:
         midiBuffer.clear();
 
         if (data.inputParameterChanges != nullptr)
-            processParameterChanges (*data.inputParameterChanges);
+            processParameterChanges (*data.inputParameterChanges, (int) data.numSamples);
 
        #if JucePlugin_WantsMidiInput
         if (isMidiInputBusEnabled && data.inputEvents != nullptr)
@@ -68,6 +68,22 @@ public:
     */
     virtual void setValue (float newValue) = 0;
 
+    /** Called by plugin wrappers that know where in the next audio block a host
+        value change belongs.
+
+        The wrapper calls this on the audio thread just before the processing
+        callback, once for each change, in order. The default implementation ignores
+        the offset and calls setValue(). Override it to apply automation at the
+        sample it was written for.
+
+        The value passed will be between 0 and 1.0.
+    */
+    virtual void setValueAtSampleOffset (float newValue, int sampleOffset)
+    {
+        ignoreUnused (sampleOffset);
+        setValue (newValue);
+    }
+
     /** A processor should call this when it needs to change one of its parameters.
 
         This could happen when the editor or some other internal operation changes